@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/benchmarks/kernels
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2012 - 2021, Joel Bodenmann aka Tectu <joel@ugfx.io>
+ * Copyright (c) 2012 - 2021, Andrew Hannam aka inmarket <inmarket@ugfx.io>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "string.h"
+#include "gfx.h"
+
+/*
+ * Checks that the bulk pixel conversion and blending functions give exactly the same
+ * result as the color macros they are built from. For RGB565 displays the SIMD code for
+ * the instruction set the compiler targets is checked (SSE2/SSSE3/AVX2 or NEON). Build with
+ * GDISP_NEED_SIMD set to GFXOFF, or without those instruction sets, to check the portable code.
+ *
+ * Every run length up to MAX_PIXELS is tried so that both the wide loops and the tails are
+ * covered. Each run starts one entry into its buffers so the SIMD loads and stores are not
+ * aligned, and the entries around the run catch any overrun.
+ */
+
+#define MAX_PIXELS			67			// Covers a 16 pixel loop 4 times plus every tail length
+#define PASSES				200
+#define GUARD				16
+#define GUARD_BYTE			0x5A
+#define RESULT_STR_LENGTH	48
+
+#if GDISP_NEED_SIMD && GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB565
+	#if defined(__AVX2__)
+		#define KERNEL_NAME		"AVX2"
+	#elif defined(__SSSE3__)
+		#define KERNEL_NAME		"SSSE3"
+	#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define KERNEL_NAME		"SSE2"
+	#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		#define KERNEL_NAME		"NEON"
+	#endif
+#endif
+#ifndef KERNEL_NAME
+	#define KERNEL_NAME		"Portable"
+#endif
+
+typedef enum kernelId {
+	K_RGB888, K_BGR888, K_TORGB888, K_LUMA, K_TOLUMA, K_PALETTE, K_BLEND, K_ARGB,
+	K_COUNT
+} kernelId;
+
+static const char *kernelNames[K_COUNT] = {
+	"gdispRGB888ToColors",
+	"gdispBGR888ToColors",
+	"gdispColorsToRGB888",
+	"gdispLumaToColors",
+	"gdispColorsToLuma",
+	"gdispPaletteToColors",
+	"gdispBlendColors",
+	"gdispBlendARGB",
+};
+
+static gU32		failures[K_COUNT];
+static gU32		seed = 1;
+
+// Each run starts one entry into these buffers and is followed by GUARD spare entries
+static gU8		src8[1+MAX_PIXELS*3+GUARD], alpha8[1+MAX_PIXELS+GUARD];
+static gU8		out8[1+MAX_PIXELS*3+GUARD], ref8[1+MAX_PIXELS*3+GUARD];
+static gColor	srcc[1+MAX_PIXELS+GUARD], fgc[1+MAX_PIXELS+GUARD], outc[1+MAX_PIXELS+GUARD], refc[1+MAX_PIXELS+GUARD];
+static gColor	palette[256];
+static gU32		argb[1+MAX_PIXELS+GUARD];
+
+static gU32 random32(void) {
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static void randomize(unsigned pass) {
+	unsigned	i;
+	gU32		r;
+
+	for(i = 0; i < sizeof(src8); i++)
+		src8[i] = (gU8)random32();
+	for(i = 0; i < sizeof(srcc)/sizeof(srcc[0]); i++) {
+		srcc[i] = (gColor)random32();
+		fgc[i] = (gColor)random32();
+	}
+	for(i = 0; i < 256; i++)
+		palette[i] = (gColor)random32();
+
+	// Every other pass uses only fully transparent and fully opaque pixels
+	for(i = 0; i < sizeof(alpha8); i++) {
+		r = random32();
+		alpha8[i] = (pass & 1) ? ((r & 0x100) ? 0xFF : 0x00) : (gU8)r;
+	}
+	for(i = 0; i < sizeof(argb)/sizeof(argb[0]); i++) {
+		r = random32();
+		argb[i] = (pass & 1) ? ((r & 0x00FFFFFF) | ((r & 0x1000000) ? 0xFF000000 : 0)) : r;
+	}
+}
+
+static void checkColors(kernelId k) {
+	if (memcmp(outc, refc, sizeof(outc)))
+		failures[k]++;
+}
+
+static void checkBytes(kernelId k) {
+	if (memcmp(out8, ref8, sizeof(out8)))
+		failures[k]++;
+}
+
+static void clearColors(void) {
+	memset(outc, GUARD_BYTE, sizeof(outc));
+	memset(refc, GUARD_BYTE, sizeof(refc));
+}
+
+static void clearBytes(void) {
+	memset(out8, GUARD_BYTE, sizeof(out8));
+	memset(ref8, GUARD_BYTE, sizeof(ref8));
+}
+
+static void checkRun(unsigned cnt) {
+	unsigned	i;
+	gU16		fr, br;
+
+	clearColors();
+	gdispRGB888ToColors(outc+1, src8+1, cnt);
+	for(i = 0; i < cnt; i++)
+		refc[1+i] = RGB2COLOR(src8[1+i*3], src8[1+i*3+1], src8[1+i*3+2]);
+	checkColors(K_RGB888);
+
+	clearColors();
+	gdispBGR888ToColors(outc+1, src8+1, cnt);
+	for(i = 0; i < cnt; i++)
+		refc[1+i] = RGB2COLOR(src8[1+i*3+2], src8[1+i*3+1], src8[1+i*3]);
+	checkColors(K_BGR888);
+
+	clearBytes();
+	gdispColorsToRGB888(out8+1, srcc+1, cnt);
+	for(i = 0; i < cnt; i++) {
+		ref8[1+i*3] = RED_OF(srcc[1+i]);
+		ref8[1+i*3+1] = GREEN_OF(srcc[1+i]);
+		ref8[1+i*3+2] = BLUE_OF(srcc[1+i]);
+	}
+	checkBytes(K_TORGB888);
+
+	clearColors();
+	gdispLumaToColors(outc+1, src8+1, cnt);
+	for(i = 0; i < cnt; i++)
+		refc[1+i] = LUMA2COLOR(src8[1+i]);
+	checkColors(K_LUMA);
+
+	clearBytes();
+	gdispColorsToLuma(out8+1, srcc+1, cnt);
+	for(i = 0; i < cnt; i++)
+		ref8[1+i] = LUMA_OF(srcc[1+i]);
+	checkBytes(K_TOLUMA);
+
+	clearColors();
+	gdispPaletteToColors(outc+1, src8+1, cnt, palette);
+	for(i = 0; i < cnt; i++)
+		refc[1+i] = palette[src8[1+i]];
+	checkColors(K_PALETTE);
+
+	// The blends work in place so the background goes in the output buffers
+	memcpy(outc, srcc, sizeof(outc));
+	memcpy(refc, srcc, sizeof(refc));
+	gdispBlendColors(outc+1, fgc+1, alpha8+1, cnt);
+	for(i = 0; i < cnt; i++)
+		refc[1+i] = gdispBlendColor(fgc[1+i], refc[1+i], alpha8[1+i]);
+	checkColors(K_BLEND);
+
+	memcpy(outc, srcc, sizeof(outc));
+	memcpy(refc, srcc, sizeof(refc));
+	gdispBlendARGB(outc+1, argb+1, cnt);
+	for(i = 0; i < cnt; i++) {
+		fr = (gU16)(argb[1+i] >> 24) + 1;
+		br = 256 - (gU16)(argb[1+i] >> 24);
+		refc[1+i] = RGB2COLOR(
+			(((argb[1+i] >> 16) & 0xFF) * fr + RED_OF(refc[1+i]) * br) >> 8,
+			(((argb[1+i] >> 8) & 0xFF) * fr + GREEN_OF(refc[1+i]) * br) >> 8,
+			((argb[1+i] & 0xFF) * fr + BLUE_OF(refc[1+i]) * br) >> 8);
+	}
+	checkColors(K_ARGB);
+}
+
+static void showResult(gCoord y, kernelId k, gFont font) {
+	char	str[RESULT_STR_LENGTH];
+
+	memset(str, 0, RESULT_STR_LENGTH);
+	snprintg(str, RESULT_STR_LENGTH, "%s: %s", kernelNames[k], failures[k] ? "FAIL" : "pass");
+	gdispDrawStringBox(0, y, gdispGetWidth(), 14, str, font, failures[k] ? GFX_RED : GFX_WHITE, gJustifyCenter);
+}
+
+void benchmark(void) {
+	gCoord		width, height, fheight;
+	gFont		font;
+	unsigned	pass, cnt, k;
+
+	// Prepare resources
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+	font = gdispOpenFont("UI2");
+	fheight = gdispGetFontMetric(font, gFontHeight);
+
+	// Show intro message
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - Pixel Kernel Check (" KERNEL_NAME ")", font, GFX_WHITE, gJustifyCenter);
+	gdispDrawStringBox(0, height/2, width, 30, "Checking kernels...", font, GFX_WHITE, gJustifyCenter);
+
+	// Run the checks
+	for(pass = 0; pass < PASSES; pass++) {
+		randomize(pass);
+		for(cnt = 0; cnt <= MAX_PIXELS; cnt++)
+			checkRun(cnt);
+	}
+
+	// Show result
+	gdispClear(GFX_BLACK);
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - Pixel Kernel Check (" KERNEL_NAME ")", font, GFX_WHITE, gJustifyCenter);
+	for(k = 0; k < K_COUNT; k++)
+		showResult(30+k*(fheight+4), (kernelId)k, font);
+}
+
+int main(void) {
+	gfxInit();
+
+	benchmark();
+
+	while (gTrue)
+		gfxSleepMilliseconds(500);
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/benchmarks/parallel
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2012 - 2021, Joel Bodenmann aka Tectu <joel@ugfx.io>
+ * Copyright (c) 2012 - 2021, Andrew Hannam aka inmarket <inmarket@ugfx.io>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "string.h"
+#include "gfx.h"
+
+#define RESULT_STR_LENGTH	64
+#define ITERATIONS			50
+
+typedef enum operation {
+	CLEAR,
+	FILL,
+	BLIT,
+	OPERATIONS
+} operation;
+
+static const char *labels[OPERATIONS] = {
+	"Clear",
+	"Fill",
+	"Blit",
+};
+
+// The number of worker threads for 1, 2 and 4 cores
+static const unsigned workers[] = { 0, 1, 3 };
+#define RUNS	(sizeof(workers)/sizeof(workers[0]))
+
+static gTicks measure(operation op, const gPixel *buffer)
+{
+	gTicks		ticksStart;
+	gU32		i;
+	gCoord		width, height;
+
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+
+	ticksStart = gfxSystemTicks();
+	for (i = 0; i < ITERATIONS; i++) {
+		switch(op) {
+		case CLEAR:		gdispClear((gColor)i);											break;
+		case FILL:		gdispFillArea(width/8, height/8, width*3/4, height*3/4, (gColor)i);	break;
+		case BLIT:		gdispBlitArea(0, 0, width, height, buffer);						break;
+		default:																		break;
+		}
+	}
+	return gfxSystemTicks() - ticksStart;
+}
+
+static void showResult(gCoord y, operation op, gTicks *ticks, gFont font)
+{
+	char	str[RESULT_STR_LENGTH];
+	gU32	ms[RUNS];
+	unsigned	r;
+
+	for (r = 0; r < RUNS; r++)
+		ms[r] = ticks[r] * 1000 / gfxMillisecondsToTicks(1000);
+	memset(str, 0, RESULT_STR_LENGTH);
+	snprintg(str, RESULT_STR_LENGTH, "%s: %d / %d / %d ms", labels[op], ms[0], ms[1], ms[2]);
+	gdispDrawStringBox(0, y, gdispGetWidth(), 20, str, font, GFX_WHITE, gJustifyCenter);
+}
+
+void benchmark(void)
+{
+	gCoord		width, height, fheight;
+	gFont		font;
+	gPixel		*buffer;
+	gTicks		ticks[OPERATIONS][RUNS];
+	gU32		i;
+	unsigned	r;
+	int			op;
+
+	// Prepare resources
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+	font = gdispOpenFont("*");
+	fheight = gdispGetFontMetric(font, gFontHeight);
+
+	// A full screen image to blit
+	if (!(buffer = gfxAlloc((gU32)width * height * sizeof(gPixel)))) {
+		gdispDrawStringBox(0, height/2, width, 30, "Not enough memory", font, GFX_WHITE, gJustifyCenter);
+		return;
+	}
+	for (i = 0; i < (gU32)width * height; i++)
+		buffer[i] = (gPixel)(i * 7);
+
+	// Show intro message
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - Parallel Drawing Benchmark", font, GFX_WHITE, gJustifyCenter);
+	gdispDrawStringBox(0, height/2, width, 30, "Large fills and blits on 1, 2 and 4 cores", font, GFX_WHITE, gJustifyCenter);
+	gfxSleepMilliseconds(3000);
+
+	// Run the measurements
+	for (r = 0; r < RUNS; r++) {
+		gdispSetParallelThreads(workers[r]);
+		for (op = 0; op < OPERATIONS; op++)
+			ticks[op][r] = measure((operation)op, buffer);
+	}
+	gdispSetParallelThreads(workers[RUNS-1]);
+	gfxFree(buffer);
+
+	// Show result
+	gdispClear(GFX_BLACK);
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - Parallel Drawing Benchmark", font, GFX_WHITE, gJustifyCenter);
+	gdispDrawStringBox(0, height/4-fheight-10, width, 20, "1 / 2 / 4 cores", font, GFX_WHITE, gJustifyCenter);
+	for (op = 0; op < OPERATIONS; op++)
+		showResult(height/4+op*(fheight+10), (operation)op, ticks[op], font);
+}
+
+int main(void) {
+	gfxInit();
+
+	benchmark();
+
+	while (gTrue)
+		gfxSleepMilliseconds(500);
+
+	return 0;
+}
@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/benchmarks/primitives
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
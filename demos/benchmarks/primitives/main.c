@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2012 - 2021, Joel Bodenmann aka Tectu <joel@ugfx.io>
+ * Copyright (c) 2012 - 2021, Andrew Hannam aka inmarket <inmarket@ugfx.io>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "stdlib.h"
+#include "string.h"
+#include "gfx.h"
+
+#define RESULT_STR_LENGTH	48
+#define ITERATIONS			1000
+
+typedef enum primitive {
+	FILL_CIRCLE,
+	DRAW_CIRCLE,
+	FILL_ELLIPSE,
+	DRAW_ELLIPSE,
+	FILL_ROUNDEDBOX,
+	FILL_STAR,
+	PRIMITIVES
+} primitive;
+
+static const char *labels[PRIMITIVES] = {
+	"Filled circles",
+	"Circles",
+	"Filled ellipses",
+	"Ellipses",
+	"Filled rounded boxes",
+	"Filled stars",
+};
+
+// A self-intersecting five pointed star (x 256)
+static const gPoint star[5] = { {0, -256}, {150, 207}, {-243, -79}, {243, -79}, {-150, 207} };
+
+static gTicks measure(primitive p)
+{
+	gPoint		pts[5];
+	unsigned	cnt, j;
+	gTicks		ticksStart;
+	gU32		i;
+	gCoord		width, height, x, y, a, b;
+	gColor		color;
+
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+
+	// The same shapes are drawn each time the benchmark is run. Some of them are partly off the screen.
+	srand(0);
+	gdispClear(GFX_BLACK);
+	ticksStart = gfxSystemTicks();
+	for (i = 0; i < ITERATIONS; i++) {
+		color = (rand() % 65535);
+		x = (rand() % width);
+		y = (rand() % height);
+		a = (rand() % (width/4))+1;
+		b = (rand() % (height/4))+1;
+
+		switch(p) {
+		case FILL_CIRCLE:		gdispFillCircle(x, y, b, color);						break;
+		case DRAW_CIRCLE:		gdispDrawCircle(x, y, b, color);						break;
+		case FILL_ELLIPSE:		gdispFillEllipse(x, y, a, b, color);					break;
+		case DRAW_ELLIPSE:		gdispDrawEllipse(x, y, a, b, color);					break;
+		case FILL_ROUNDEDBOX:	gdispFillRoundedBox(x-a, y-b, 2*a, 2*b, b/2, color);	break;
+		case FILL_STAR:
+			for (j = 0; j < 5; j++) {
+				pts[j].x = star[j].x * a / 256;
+				pts[j].y = star[j].y * b / 256;
+			}
+			cnt = 5;
+			gdispFillPoly(x, y, pts, &cnt, 1, gFillRuleNonZero, color);
+			break;
+		default:																		break;
+		}
+	}
+	return gfxSystemTicks() - ticksStart;
+}
+
+static void showResult(gCoord y, const char *label, gTicks ticks, gFont font)
+{
+	char	str[RESULT_STR_LENGTH];
+	gU32	ms;
+
+	ms = ticks * 1000 / gfxMillisecondsToTicks(1000);
+	memset(str, 0, RESULT_STR_LENGTH);
+	snprintg(str, RESULT_STR_LENGTH, "%s: %d ms", label, ms);
+	gdispDrawStringBox(0, y, gdispGetWidth(), 20, str, font, GFX_WHITE, gJustifyCenter);
+}
+
+void benchmark(void)
+{
+	gCoord	width, height, fheight;
+	gFont	font;
+	gTicks	ticks[PRIMITIVES];
+	int		p;
+
+	// Prepare resources
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+	font = gdispOpenFont("*");
+	fheight = gdispGetFontMetric(font, gFontHeight);
+
+	// Show intro message
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - Primitives Benchmark", font, GFX_WHITE, gJustifyCenter);
+	gdispDrawStringBox(0, height/2, width, 30, "1000 random shapes of each type", font, GFX_WHITE, gJustifyCenter);
+	gfxSleepMilliseconds(3000);
+
+	// Run the measurements
+	for (p = 0; p < PRIMITIVES; p++)
+		ticks[p] = measure((primitive)p);
+
+	// Show result
+	gdispClear(GFX_BLACK);
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - Primitives Benchmark", font, GFX_WHITE, gJustifyCenter);
+	for (p = 0; p < PRIMITIVES; p++)
+		showResult(height/4+p*(fheight+10), labels[p], ticks[p], font);
+}
+
+int main(void) {
+	gfxInit();
+
+	benchmark();
+
+	while (gTrue)
+		gfxSleepMilliseconds(500);
+
+	return 0;
+}
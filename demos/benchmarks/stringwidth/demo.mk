@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/benchmarks/stringwidth
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
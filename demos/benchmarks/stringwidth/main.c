@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2012 - 2021, Joel Bodenmann aka Tectu <joel@ugfx.io>
+ * Copyright (c) 2012 - 2021, Andrew Hannam aka inmarket <inmarket@ugfx.io>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "string.h"
+#include "gfx.h"
+
+#define RESULT_STR_LENGTH	48
+#define ITERATIONS			20000
+
+static const char asciiText[] = "Temperature 23.5C  Pressure 1013hPa  Humidity 45%";
+static const char utf8Text[] = "Temp\xC3\xA9rature 23.5\xC2\xB0" "C  Dru\xC3\xA7k 1013hPa  \xD0\x92\xD0\xBB\xD0\xB0\xD0\xB6\xD0\xBD\xD0\xBE\xD1\x81\xD1\x82\xD1\x8C 45%";
+
+static gTicks measure(const char *str, gFont font)
+{
+	gTicks		ticksStart;
+	gU32		i;
+	volatile gCoord	w;
+
+	ticksStart = gfxSystemTicks();
+	for (i = 0; i < ITERATIONS; i++)
+		w = gdispGetStringWidth(str, font);
+	(void)w;
+	return gfxSystemTicks() - ticksStart;
+}
+
+static void showResult(gCoord y, const char *label, gTicks ticks, gFont font)
+{
+	char	str[RESULT_STR_LENGTH];
+	gU32	ms;
+
+	ms = ticks * 1000 / gfxMillisecondsToTicks(1000);
+	memset(str, 0, RESULT_STR_LENGTH);
+	snprintg(str, RESULT_STR_LENGTH, "%s: %d ms", label, ms);
+	gdispDrawStringBox(0, y, gdispGetWidth(), 20, str, font, GFX_WHITE, gJustifyCenter);
+}
+
+void benchmark(void)
+{
+	gCoord	width, height, fheight;
+	gFont	font, plain;
+	gTicks	tAscii, tUtf8, tAsciiPlain, tUtf8Plain;
+
+	// Prepare resources
+	width = gdispGetWidth();
+	height = gdispGetHeight();
+	font = gdispOpenFont("DejaVuSans12");
+	fheight = gdispGetFontMetric(font, gFontHeight);
+
+	// A 1:1 scaled copy of the font measures the same but has no advance width table
+	plain = gdispScaleFont(font, 1, 1);
+
+	// Show intro message
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - String Width Benchmark", font, GFX_WHITE, gJustifyCenter);
+	gdispDrawStringBox(0, height/2, width, 30, "Measuring strings...", font, GFX_WHITE, gJustifyCenter);
+
+	// Run the measurements
+	tAscii = measure(asciiText, font);
+	tUtf8 = measure(utf8Text, font);
+	tAsciiPlain = measure(asciiText, plain);
+	tUtf8Plain = measure(utf8Text, plain);
+
+	// Show result
+	gdispClear(GFX_BLACK);
+	gdispDrawStringBox(0, 0, width, 30, "uGFX - String Width Benchmark", font, GFX_WHITE, gJustifyCenter);
+	showResult(height/4+0*(fheight+10), "ASCII (width table)", tAscii, font);
+	showResult(height/4+1*(fheight+10), "ASCII (glyph data)", tAsciiPlain, font);
+	showResult(height/4+2*(fheight+10), "Multilingual (width table)", tUtf8, font);
+	showResult(height/4+3*(fheight+10), "Multilingual (glyph data)", tUtf8Plain, font);
+
+	gdispCloseFont(plain);
+}
+
+int main(void) {
+	gfxInit();
+
+	benchmark();
+
+	while (gTrue)
+		gfxSleepMilliseconds(500);
+
+	return 0;
+}
@@ -0,0 +1,4 @@
+DEMODIR = $(GFXLIB)/demos/modules/gdisp/fonts_ttf
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
+LIBS +=		-lfreetype
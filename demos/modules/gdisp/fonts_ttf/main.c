@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2012 - 2021, Joel Bodenmann aka Tectu <joel@ugfx.io>
+ * Copyright (c) 2012 - 2021, Andrew Hannam aka inmarket <inmarket@ugfx.io>
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *    * Neither the name of the <organization> nor the
+ *      names of its contributors may be used to endorse or promote products
+ *      derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL <COPYRIGHT HOLDER> BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * This demo renders a TrueType font at run-time using FreeType.
+ *
+ * The first time it is run the glyphs needed are rasterized and saved to an
+ * atlas file. Subsequent runs load the atlas directly and do not need to
+ * rasterize anything.
+ *
+ * Change TTF_FILE to point to a TrueType font on your system.
+ */
+
+#include "gfx.h"
+
+#define TTF_FILE		"DejaVuSans.ttf"
+#define TTF_HEIGHT		24
+#define ATLAS_FILE		"DejaVuSans24.atlas"
+
+static const char line1[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+static const char line2[] = "0123456789~!@#$%^&*_-+=(){}[]<>|/\\:;,.?'\"`";
+
+int main(void) {
+	gCoord		width, y, fheight;
+	gFont		font, ui;
+	const char	*msg;
+
+	// Initialize and clear the display
+	gfxInit();
+
+	width = gdispGetWidth();
+	ui = gdispOpenFont("UI2*");
+
+	// Try the atlas first. If it isn't there rasterize the font and save the atlas for next time.
+	if ((font = gdispOpenTTFAtlas(ATLAS_FILE))) {
+		msg = "Loaded from atlas";
+	} else if ((font = gdispOpenTTFFont(TTF_FILE, TTF_HEIGHT))) {
+		gdispCacheTTFGlyphs(font, line1);
+		gdispCacheTTFGlyphs(font, line2);
+		msg = gdispSaveTTFAtlas(font, ATLAS_FILE) ? "Rasterized - atlas saved" : "Rasterized - atlas save failed";
+	} else {
+		gdispDrawString(0, 0, "Unable to open " TTF_FILE, ui, GFX_RED);
+		while(1)
+			gfxSleepMilliseconds(500);
+	}
+
+	y = 0;
+	fheight = gdispGetFontMetric(font, gFontHeight)+2;
+	gdispFillStringBox(0, y, width, fheight, line1, font, GFX_BLACK, GFX_WHITE, gJustifyCenter);
+	y += fheight+1;
+	gdispFillStringBox(0, y, width, fheight, line2, font, GFX_BLACK, GFX_WHITE, gJustifyCenter);
+	y += fheight+1;
+	gdispDrawStringBox(0, y, width, fheight, line1, font, GFX_WHITE, gJustifyCenter);
+	y += fheight+1;
+	gdispDrawString(0, y, msg, ui, GFX_YELLOW);
+
+	// Wait forever
+	while(1)
+		gfxSleepMilliseconds(500);
+}
@@ -0,0 +1,3 @@
+DEMODIR = $(GFXLIB)/demos/modules/gwin/occlusion
+GFXINC +=   $(DEMODIR)
+GFXSRC +=	$(DEMODIR)/main.c
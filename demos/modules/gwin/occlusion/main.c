@@ -0,0 +1,94 @@
+#include "gfx.h"
+
+/**
+ * Overlapping frames to show the redraw occlusion of the window manager.
+ *
+ * Press "Redraw" to redraw the whole display. The label shows how many pixels
+ * were written compared with the screen size. Build it with GWIN_REDRAW_OCCLUSION
+ * turned on and then off in gfxconf.h to compare the overdraw.
+ */
+
+#define FRAMES		3
+
+static GListener	gl;
+static GHandle		ghRedraw, ghResult;
+
+static void createWidgets(void) {
+	GWidgetInit	wi;
+	GHandle		ghFrame;
+	int			i;
+	static const char *names[FRAMES] = { "Frame 1", "Frame 2", "Frame 3" };
+
+	gwinWidgetClearInit(&wi);
+	wi.g.show = gTrue;
+
+	// The controls along the top of the screen
+	wi.g.x = 5; wi.g.y = 5; wi.g.width = 80; wi.g.height = 25;
+	wi.text = "Redraw";
+	ghRedraw = gwinButtonCreate(0, &wi);
+
+	wi.g.x = 90; wi.g.width = gdispGetWidth() - 95;
+	wi.text = "Press Redraw to measure";
+	ghResult = gwinLabelCreate(0, &wi);
+
+	// A stack of overlapping frames each with some widgets
+	for(i = 0; i < FRAMES; i++) {
+		wi.g.parent = 0;
+		wi.g.x = 10 + i * 40;
+		wi.g.y = 40 + i * 30;
+		wi.g.width = gdispGetWidth() / 2;
+		wi.g.height = gdispGetHeight() / 2;
+		wi.text = names[i];
+		ghFrame = gwinFrameCreate(0, &wi, GWIN_FRAME_BORDER|GWIN_FRAME_CLOSE_BTN);
+
+		wi.g.parent = ghFrame;
+		wi.g.x = 5; wi.g.y = 5; wi.g.width = 100; wi.g.height = 20;
+		wi.text = "A label";
+		gwinLabelCreate(0, &wi);
+
+		wi.g.y = 30; wi.g.height = 25;
+		wi.text = "A button";
+		gwinButtonCreate(0, &wi);
+
+		wi.g.y = 60; wi.g.height = 20;
+		wi.text = "A checkbox";
+		gwinCheckboxCreate(0, &wi);
+	}
+}
+
+static void measureRedraw(void) {
+	static char	buf[48];
+	gU32		cnt;
+
+	gdispResetPixelCount();
+	gwinRedrawDisplay(0, gFalse);
+
+	// Redraws happen in the background - give them time to complete
+	gfxSleepMilliseconds(500);
+	cnt = gdispGetPixelCount();
+
+	snprintg(buf, sizeof(buf), "%u pixels, screen is %u", (unsigned)cnt, (unsigned)(gdispGetWidth() * gdispGetHeight()));
+	gwinSetText(ghResult, buf, gFalse);
+}
+
+int main(void) {
+	GEvent	*pe;
+
+	gfxInit();
+
+	gwinSetDefaultFont(gdispOpenFont("UI2"));
+	gwinSetDefaultStyle(&WhiteWidgetStyle, gFalse);
+	gdispClear(GFX_WHITE);
+
+	createWidgets();
+
+	geventListenerInit(&gl);
+	gwinAttachListener(&gl);
+
+	while(1) {
+		pe = geventEventWait(&gl, gDelayForever);
+		if (pe->type == GEVENT_GWIN_BUTTON && ((GEventGWinButton *)pe)->gwin == ghRedraw)
+			measureRedraw();
+	}
+	return 0;
+}
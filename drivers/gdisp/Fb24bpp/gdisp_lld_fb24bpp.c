@@ -10,6 +10,7 @@
 #if GFX_USE_GDISP
 
 #define GDISP_DRIVER_VMT			GDISPVMT_fb24bpp
+#define GDISP_DRIVER_VMT_FLAGS		GDISP_VFLG_CONCURRENT
 #include "gdisp_lld_config.h"
 #include "../../../src/gdisp/gdisp_driver.h"
 
@@ -9,8 +9,11 @@
 
 #include <linux/input.h>
 
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <errno.h>
 #include <stdio.h>
 
 #if GFX_USE_GINPUT && GINPUT_NEED_MOUSE
@@ -21,82 +24,294 @@
 // Include the board file
 #include "gmouse_lld_linux_event_board.h"
 
+#ifndef GMOUSE_LINUX_EVENT_NUM_EVENT
+	#define GMOUSE_LINUX_EVENT_NUM_EVENT		64
+#endif
+#ifndef GMOUSE_LINUX_EVENT_QUEUE_SIZE
+	#define GMOUSE_LINUX_EVENT_QUEUE_SIZE		16
+#endif
+
 // Private area definition
 // We need to store the last reading ourselves because we only get events
 // from the Linux system. When touching the touchscreen and then moving around,
 // we only get one z = 1 event. However, the GINPUT module expects z = 1 to be
 // true for the entire touch duration.
+// Each complete frame of events (ended by a SYN_REPORT) is queued by the event
+// thread so that no samples are lost between reads by the GINPUT module.
+// The queue (guarded by evMutex) is the only state the event thread shares with
+// GINPUT. It only jabs the GINPUT poll timer and never touches the mouse flags.
+// With GINPUT_NEED_MULTITOUCH the contacts are tracked using the slots of the
+// multi-touch protocol B. The device must also provide the single touch
+// (pointer emulation) events for the primary contact as the kernel does for
+// all protocol B drivers.
 typedef struct privStruct {
 	int fd;
+	gBool dropped;										// The kernel dropped events - resync at the next SYN_REPORT
+	GMouseReading frame;								// The reading being built from the current frame of events
 	GMouseReading lastReading;
+	unsigned head;										// The oldest queued frame
+	unsigned count;										// The number of queued frames
+	GMouseReading queue[GMOUSE_LINUX_EVENT_QUEUE_SIZE];
+	#if GINPUT_NEED_MULTITOUCH
+		unsigned slot;									// The multi-touch slot the current events refer to
+		GTouchContact slots[GINPUT_TOUCH_MAX_CONTACTS];	// The contact in each slot (id is -1 when the slot is unused)
+	#endif
 } privStruct;
 
+static int		evPoll = -1;							// The epoll instance watching every opened device
+static gMutex	evMutex;								// Protects the frame queues
+
+// Read the current state from the device after the kernel has dropped events
+static void Resync(privStruct* priv)
+{
+	struct input_absinfo ai;
+	gU8 keys[(KEY_MAX+7)/8] = {0};
+
+	if (ioctl(priv->fd, EVIOCGKEY(sizeof(keys)), keys) >= 0)
+		priv->frame.z = (keys[BTN_TOUCH/8] & (1 << (BTN_TOUCH%8))) ? 1 : 0;
+	if (ioctl(priv->fd, EVIOCGABS(ABS_X), &ai) >= 0 && ai.value > 0)
+		priv->frame.x = ai.value;
+	if (ioctl(priv->fd, EVIOCGABS(ABS_Y), &ai) >= 0 && ai.value > 0)
+		priv->frame.y = ai.value;
+
+	#if GINPUT_NEED_MULTITOUCH
+	{
+		struct {
+			__u32 code;
+			__s32 values[GINPUT_TOUCH_MAX_CONTACTS];
+		} mt;
+		unsigned i;
+
+		if (ioctl(priv->fd, EVIOCGABS(ABS_MT_SLOT), &ai) >= 0)
+			priv->slot = ai.value;
+		mt.code = ABS_MT_TRACKING_ID;
+		if (ioctl(priv->fd, EVIOCGMTSLOTS(sizeof(mt)), &mt) >= 0) {
+			for(i = 0; i < GINPUT_TOUCH_MAX_CONTACTS; i++)
+				priv->slots[i].id = mt.values[i] < 0 ? -1 : (gI16)(mt.values[i] & 0x7FFF);
+		}
+		mt.code = ABS_MT_POSITION_X;
+		if (ioctl(priv->fd, EVIOCGMTSLOTS(sizeof(mt)), &mt) >= 0) {
+			for(i = 0; i < GINPUT_TOUCH_MAX_CONTACTS; i++)
+				priv->slots[i].x = mt.values[i];
+		}
+		mt.code = ABS_MT_POSITION_Y;
+		if (ioctl(priv->fd, EVIOCGMTSLOTS(sizeof(mt)), &mt) >= 0) {
+			for(i = 0; i < GINPUT_TOUCH_MAX_CONTACTS; i++)
+				priv->slots[i].y = mt.values[i];
+		}
+	}
+	#endif
+}
+
+// Process one event. Returns gTrue if a frame has been queued.
+// Note: evMutex must be held
+static gBool ProcessEvent(privStruct* priv, const struct input_event* ev)
+{
+	unsigned i;
+
+	switch(ev->type) {
+	case EV_KEY:
+		if (ev->code == BTN_TOUCH) {
+			if (ev->value == 1)
+				priv->frame.z = 1;
+			else if (ev->value == 0)
+				priv->frame.z = 0;
+		}
+		break;
+
+	case EV_ABS:
+		if (ev->code == ABS_X && ev->value > 0)
+			priv->frame.x = ev->value;
+		else if (ev->code == ABS_Y && ev->value > 0)
+			priv->frame.y = ev->value;
+		#if GINPUT_NEED_MULTITOUCH
+			else if (ev->code == ABS_MT_SLOT)
+				priv->slot = ev->value;
+			else if (priv->slot >= GINPUT_TOUCH_MAX_CONTACTS)
+				break;												// Slots we can't track are ignored
+			else if (ev->code == ABS_MT_TRACKING_ID)
+				priv->slots[priv->slot].id = ev->value < 0 ? -1 : (gI16)(ev->value & 0x7FFF);
+			else if (ev->code == ABS_MT_POSITION_X)
+				priv->slots[priv->slot].x = ev->value;
+			else if (ev->code == ABS_MT_POSITION_Y)
+				priv->slots[priv->slot].y = ev->value;
+		#endif
+		break;
+
+	case EV_SYN:
+		if (ev->code == SYN_DROPPED) {
+			priv->dropped = gTrue;
+			break;
+		}
+		if (ev->code != SYN_REPORT)
+			break;
+		if (priv->dropped) {
+			priv->dropped = gFalse;
+			Resync(priv);
+		}
+
+		#if GINPUT_NEED_MULTITOUCH
+			// Gather the contacts currently on the surface
+			priv->frame.contacts = 0;
+			for(i = 0; i < GINPUT_TOUCH_MAX_CONTACTS; i++) {
+				if (priv->slots[i].id >= 0)
+					priv->frame.contact[priv->frame.contacts++] = priv->slots[i];
+			}
+		#endif
+
+		// Queue the frame. If the queue is full merge movement into the newest frame
+		//	and otherwise drop the oldest frame so that touches and releases are never lost.
+		if (priv->count == GMOUSE_LINUX_EVENT_QUEUE_SIZE) {
+			i = (priv->head + priv->count - 1) % GMOUSE_LINUX_EVENT_QUEUE_SIZE;
+			if (priv->queue[i].z == priv->frame.z
+					#if GINPUT_NEED_MULTITOUCH
+						&& priv->queue[i].contacts == priv->frame.contacts
+					#endif
+					) {
+				priv->queue[i] = priv->frame;
+				return gTrue;
+			}
+			priv->head = (priv->head + 1) % GMOUSE_LINUX_EVENT_QUEUE_SIZE;
+			priv->count--;
+		}
+		priv->queue[(priv->head + priv->count) % GMOUSE_LINUX_EVENT_QUEUE_SIZE] = priv->frame;
+		priv->count++;
+		return gTrue;
+	}
+	return gFalse;
+}
+
+// The event thread. It sleeps until a device has events and then jabs the GINPUT poll timer for each frame.
+static GFX_THREAD_STACK(waEventThread, 1024);
+static GFX_THREAD_FUNCTION(EventThread, arg)
+{
+	struct epoll_event pe[4];
+	struct input_event ev[GMOUSE_LINUX_EVENT_NUM_EVENT];
+	GMouse* m;
+	privStruct* priv;
+	gBool queued;
+	int n, i, j, rb;
+	(void)arg;
+
+	while(1) {
+		n = epoll_wait(evPoll, pe, sizeof(pe)/sizeof(pe[0]), -1);
+
+		for(i = 0; i < n; i++) {
+			m = (GMouse *)pe[i].data.ptr;
+			priv = (privStruct*)(m+1);
+
+			// Drain the device
+			while((rb = read(priv->fd, ev, sizeof(ev))) > 0) {
+				queued = gFalse;
+				gfxMutexEnter(&evMutex);
+				for(j = 0; j < rb / (int)sizeof(struct input_event); j++) {
+					if (ProcessEvent(priv, &ev[j]))
+						queued = gTrue;
+				}
+				gfxMutexExit(&evMutex);
+				if (queued)
+					_gmouseWakeup(0);
+			}
+
+			// Stop watching a device that has gone away
+			if (rb == 0 || (errno != EAGAIN && errno != EINTR)) {
+				fprintf(stderr, "GINPUT Mouse: Lost input device (%s)\n", GMOUSE_LINUX_EVENT_DEVICE);
+				epoll_ctl(evPoll, EPOLL_CTL_DEL, priv->fd, 0);
+			}
+		}
+	}
+	return 0;
+}
+
 static gBool _init(GMouse* m, unsigned driverInstance)
 {
+	struct epoll_event pe;
+	gThread hth;
+	#if GINPUT_NEED_MULTITOUCH
+		unsigned i;
+	#endif
 	(void)driverInstance;
 
 	// Retrive the private area struct
     privStruct* priv = (privStruct*)(m+1);
 
+	// Initialize
+	priv->lastReading.buttons = 0;
+	priv->lastReading.x = 0;
+	priv->lastReading.y = 0;
+	priv->lastReading.z = 0;
+	#if GINPUT_NEED_MULTITOUCH
+		priv->lastReading.contacts = 0;
+		priv->slot = 0;
+		for(i = 0; i < GINPUT_TOUCH_MAX_CONTACTS; i++)
+			priv->slots[i].id = -1;
+	#endif
+	priv->frame = priv->lastReading;
+	priv->dropped = gFalse;
+	priv->head = 0;
+	priv->count = 0;
+
 	// Open the device
-	priv->fd = open(GMOUSE_LINUX_EVENT_DEVICE, O_RDONLY | O_NONBLOCK);
+	priv->fd = open(GMOUSE_LINUX_EVENT_DEVICE, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
 	if (priv->fd < 0) {
 		fprintf(stderr, "GINPUT Mouse: Cannot open input device (%s)\n", GMOUSE_LINUX_EVENT_DEVICE);
 		return gFalse;
 	}
 
-	// Initialize
-	priv->lastReading.buttons = 0;
-	priv->lastReading.x = 0;
-	priv->lastReading.y = 0;
-	priv->lastReading.z = 0;
+	// Start the event thread the first time through
+	if (evPoll < 0) {
+		if ((evPoll = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+			fprintf(stderr, "GINPUT Mouse: Cannot create epoll instance\n");
+			close(priv->fd);
+			return gFalse;
+		}
+		gfxMutexInit(&evMutex);
+		if (!(hth = gfxThreadCreate(waEventThread, sizeof(waEventThread), gThreadpriorityHigh, EventThread, 0))) {
+			fprintf(stderr, "GINPUT Mouse: Cannot start the input thread\n");
+			gfxMutexDestroy(&evMutex);
+			close(evPoll);
+			evPoll = -1;
+			close(priv->fd);
+			return gFalse;
+		}
+		gfxThreadClose(hth);
+	}
+
+	// Have the event thread watch it
+	pe.events = EPOLLIN;
+	pe.data.ptr = m;
+	if (epoll_ctl(evPoll, EPOLL_CTL_ADD, priv->fd, &pe) < 0) {
+		fprintf(stderr, "GINPUT Mouse: Cannot watch input device (%s)\n", GMOUSE_LINUX_EVENT_DEVICE);
+		close(priv->fd);
+		return gFalse;
+	}
 
 	return gTrue;
 }
 
 static gBool _read(GMouse* m, GMouseReading* pdr)
 {
-	int i;
-	int rb;
-	struct input_event ev[64];
 	privStruct* priv;
+	gBool more;
 
 	// Retrive the private area struct
     priv = (privStruct*)(m+1);
 
-	// Assume not touched
-	pdr->buttons = 0;
-	pdr->z = priv->lastReading.z;
-	pdr->x = priv->lastReading.x;
-	pdr->y = priv->lastReading.y;
-
-	// Read
-	rb = read(priv->fd, ev, sizeof(struct input_event)*64);
-
-	// Parse	
-	if (rb > 0) {
-		for (i = 0;  i < (int)(rb / sizeof(struct input_event)); i++) {
-			if (ev[i].type == EV_KEY && ev[i].code == 330 && ev[i].value == 1) {
-				pdr->z = 1;
-			}
-			else if (ev[i].type == EV_KEY && ev[i].code == 330 && ev[i].value == 0) {
-				pdr->z = 0;
-			}
-			else if (ev[i].type == EV_ABS && ev[i].code == 0 && ev[i].value > 0) {
-				pdr->x = ev[i].value;
-			}
-			else if (ev[i].type == EV_ABS  && ev[i].code == 1 && ev[i].value > 0) {
-				pdr->y = ev[i].value;
-			}
-		}
+	// Take the oldest frame. With nothing new the last reading still stands.
+	gfxMutexEnter(&evMutex);
+	if (priv->count) {
+		priv->lastReading = priv->queue[priv->head];
+		priv->head = (priv->head + 1) % GMOUSE_LINUX_EVENT_QUEUE_SIZE;
+		priv->count--;
 	}
+	*pdr = priv->lastReading;
+	more = priv->count != 0;
+	gfxMutexExit(&evMutex);
+
+	// Come back for the next frame
+	if (more)
+		_gmouseWakeup(0);
 
-	// Store the current reading
-	priv->lastReading.x = pdr->x;
-	priv->lastReading.y = pdr->y;
-	priv->lastReading.z = pdr->z;
-	priv->lastReading.buttons = pdr->buttons;
-	
 	return gTrue;
 }
 
@@ -108,9 +323,9 @@ const GMouseVMT const GMOUSE_DRIVER_VMT[1] = {{
 		#endif
 		
 		#if GMOUSE_LINUX_EVENT_SELF_CALIBRATE
-			GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_ONLY_DOWN | GMOUSE_VFLG_POORUPDOWN , 
+			GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_ONLY_DOWN , 
 		#else
-			GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_ONLY_DOWN | GMOUSE_VFLG_POORUPDOWN |GMOUSE_VFLG_CALIBRATE,
+			GMOUSE_VFLG_TOUCH | GMOUSE_VFLG_ONLY_DOWN |GMOUSE_VFLG_CALIBRATE,
 		#endif
 		sizeof(GMouse) + sizeof(privStruct),
 		_gmouseInitDriver,
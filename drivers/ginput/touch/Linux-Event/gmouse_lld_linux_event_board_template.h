@@ -18,6 +18,10 @@
 
 #define GMOUSE_LINUX_EVENT_NUM_EVENT				64
 
+// The number of complete touch frames that can wait to be read by GINPUT.
+//	Movement is merged into the newest frame if GINPUT falls this far behind.
+#define GMOUSE_LINUX_EVENT_QUEUE_SIZE				16
+
 // The linux device input used for touchscreen
 #define GMOUSE_LINUX_EVENT_DEVICE					"/dev/input/event0"
 
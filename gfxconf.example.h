@@ -80,25 +80,45 @@
 //#define GDISP_NEED_TIMERFLUSH                        GFXOFF
 //#define GDISP_NEED_VALIDATION                        GFXON
 //#define GDISP_NEED_CLIP                              GFXON
+//    #define GDISP_NEED_CLIP_REGION                   GFXOFF
+//        #define GDISP_CLIP_REGION_MAX                8
 //#define GDISP_NEED_CIRCLE                            GFXOFF
 //#define GDISP_NEED_DUALCIRCLE                        GFXOFF
 //#define GDISP_NEED_ELLIPSE                           GFXOFF
 //#define GDISP_NEED_ARC                               GFXOFF
 //#define GDISP_NEED_ARCSECTORS                        GFXOFF
 //#define GDISP_NEED_CONVEX_POLYGON                    GFXOFF
+//#define GDISP_NEED_COMPLEX_POLYGON                   GFXOFF
+//#define GDISP_NEED_GRADIENT                          GFXOFF
+//#define GDISP_NEED_PATTERN                           GFXOFF
+//#define GDISP_NEED_BLIT_ALPHA                        GFXOFF
+//#define GDISP_NEED_ANTIALIAS_SHAPES                  GFXOFF
 //#define GDISP_NEED_SCROLL                            GFXOFF
 //#define GDISP_NEED_PIXELREAD                         GFXOFF
 //#define GDISP_NEED_CONTROL                           GFXOFF
 //#define GDISP_NEED_QUERY                             GFXOFF
 //#define GDISP_NEED_MULTITHREAD                       GFXOFF
+//#define GDISP_NEED_DRAWCONTEXT                       GFXOFF
+//#define GDISP_NEED_PARALLEL                          GFXOFF
+//    #define GDISP_PARALLEL_THREADS                   3
+//    #define GDISP_PARALLEL_MIN_PIXELS                65536
+//    #define GDISP_PARALLEL_THREAD_WORKAREA_SIZE      1024
 //#define GDISP_NEED_STREAMING                         GFXOFF
+//#define GDISP_NEED_PIXELCOUNT                        GFXOFF
+//#define GDISP_NEED_DISPLAYLIST                       GFXOFF
+//    #define GDISP_NEED_LIST_TILES                    GFXOFF
+//        #define GDISP_LIST_TILE_WIDTH                32
+//        #define GDISP_LIST_TILE_HEIGHT               32
 //#define GDISP_NEED_TEXT                              GFXOFF
 //    #define GDISP_NEED_TEXT_WORDWRAP                 GFXOFF
 //    #define GDISP_NEED_TEXT_BOXPADLR                 1
 //    #define GDISP_NEED_TEXT_BOXPADTB                 1
+//    #define GDISP_NEED_TEXT_BATCH                    GFXOFF
 //    #define GDISP_NEED_ANTIALIAS                     GFXOFF
 //    #define GDISP_NEED_UTF8                          GFXOFF
 //    #define GDISP_NEED_TEXT_KERNING                  GFXOFF
+//    #define GDISP_NEED_TTF                           GFXOFF
+//        #define GDISP_TTF_USE_FREETYPE               GFXON
 //    #define GDISP_INCLUDE_FONT_UI1                   GFXOFF
 //    #define GDISP_INCLUDE_FONT_UI2                   GFXOFF		// The smallest preferred font.
 //    #define GDISP_INCLUDE_FONT_LARGENUMBERS          GFXOFF
@@ -140,6 +160,7 @@
 //        #define GDISP_NEED_IMAGE_PNG_TRANSPARENCY    GFXON
 //        #define GDISP_NEED_IMAGE_PNG_BACKGROUND      GFXON
 //        #define GDISP_NEED_IMAGE_PNG_ALPHACLIFF      32
+//        #define GDISP_NEED_IMAGE_PNG_ALPHABLEND      GFXOFF
 //        #define GDISP_NEED_IMAGE_PNG_PALETTE_124     GFXON
 //        #define GDISP_NEED_IMAGE_PNG_PALETTE_8       GFXON
 //        #define GDISP_NEED_IMAGE_PNG_GRAYSCALE_124   GFXON
@@ -163,6 +184,7 @@
 //#define GDISP_LINEBUF_SIZE                           128
 //#define GDISP_STARTUP_COLOR                          GFX_BLACK
 //#define GDISP_NEED_STARTUP_LOGO                      GFXON
+//#define GDISP_NEED_SIMD                              GFXON
 
 //#define GDISP_TOTAL_DISPLAYS                         1
 
@@ -200,6 +222,14 @@
 //#define GWIN_NEED_WINDOWMANAGER                      GFXOFF
 //    #define GWIN_REDRAW_IMMEDIATE                    GFXOFF
 //    #define GWIN_REDRAW_SINGLEOP                     GFXOFF
+//    #define GWIN_REDRAW_OCCLUSION                    GFXOFF
+//    #define GWIN_REDRAW_FRAMES                       GFXOFF
+//        #define GWIN_REDRAW_FRAME_PERIOD             20
+//        #define GWIN_REDRAW_FRAME_BUDGET             10
+//    #define GWIN_MOVE_BLIT                           GFXOFF
+//    #define GWIN_REDRAW_DAMAGE                       GFXOFF
+//    #define GWIN_NEED_HITGRID                        GFXOFF
+//        #define GWIN_HITGRID_SHIFT                   5
 //    #define GWIN_NEED_FLASHING                       GFXOFF
 //        #define GWIN_FLASHING_PERIOD                 250
 
@@ -211,6 +241,7 @@
 //    #define GWIN_CONSOLE_USE_BASESTREAM              GFXOFF
 //    #define GWIN_CONSOLE_USE_FLOAT                   GFXOFF
 //#define GWIN_NEED_GRAPH                              GFXOFF
+//    #define GWIN_GRAPH_STREAMING                     GFXOFF
 //#define GWIN_NEED_GL3D                               GFXOFF
 
 //#define GWIN_NEED_WIDGET                             GFXOFF
@@ -237,12 +268,15 @@
 //    #define GWIN_NEED_TEXTEDIT                       GFXOFF
 //    #define GWIN_FLAT_STYLING                        GFXOFF
 //    #define GWIN_WIDGET_TAGS                         GFXOFF
+//    #define GWIN_WIDGET_CACHE                        GFXOFF
+//        #define GWIN_WIDGET_CACHE_SIZE               32768
 
 //#define GWIN_NEED_CONTAINERS                         GFXOFF
 //    #define GWIN_NEED_CONTAINER                      GFXOFF
 //    #define GWIN_NEED_FRAME                          GFXOFF
 //    #define GWIN_NEED_TABSET                         GFXOFF
 //        #define GWIN_TABSET_TABHEIGHT                18
+//    #define GWIN_NEED_OFFSCREEN                      GFXOFF
 
 
 ///////////////////////////////////////////////////////////////////////////
@@ -295,6 +329,8 @@
 //    #define GINPUT_TOUCH_CXTCLICK_TIME               700
 //    #define GINPUT_TOUCH_USER_CALIBRATION_LOAD       GFXOFF
 //    #define GINPUT_TOUCH_USER_CALIBRATION_SAVE       GFXOFF
+//    #define GINPUT_NEED_MULTITOUCH                   GFXOFF
+//        #define GINPUT_TOUCH_MAX_CONTACTS            5
 //    #define GMOUSE_DRIVER_LIST                       GMOUSEVMT_Win32, GMOUSEVMT_Win32
 //    #define GINPUT_TOUCH_CALIBRATION_FONT1           "* Double"
 //    #define GINPUT_TOUCH_CALIBRATION_FONT2           "* Narrow"
@@ -130,6 +130,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_DejaVuSans10_char_ranges[]
     },
 };
 
+static const gU8 mf_bwfont_DejaVuSans10_ascii_widths[95] PROGMEM = {
+    0x03, 0x04, 0x05, 0x08, 0x06, 0x0a, 0x09, 0x03, 0x04, 0x04, 0x05, 0x08, 0x03, 0x04, 0x03, 0x03,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x08, 0x08, 0x08, 0x05,
+    0x0b, 0x07, 0x07, 0x08, 0x08, 0x07, 0x06, 0x08, 0x08, 0x03, 0x03, 0x07, 0x06, 0x09, 0x08, 0x08,
+    0x07, 0x08, 0x07, 0x07, 0x05, 0x08, 0x07, 0x09, 0x06, 0x07, 0x06, 0x04, 0x03, 0x04, 0x08, 0x05,
+    0x05, 0x06, 0x06, 0x05, 0x06, 0x06, 0x04, 0x06, 0x06, 0x02, 0x02, 0x05, 0x02, 0x0a, 0x06, 0x06,
+    0x06, 0x06, 0x04, 0x05, 0x04, 0x06, 0x06, 0x08, 0x06, 0x06, 0x05, 0x06, 0x03, 0x06, 0x08,
+};
+
 const struct mf_bwfont_s mf_bwfont_DejaVuSans10 = {
     {
     "DejaVu Sans Book 10",
@@ -145,6 +154,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSans10 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_DejaVuSans10_ascii_widths,
     },
     4, /* version */
     1, /* char range count */
@@ -139,6 +139,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_DejaVuSans12_char_ranges[]
     },
 };
 
+static const gU8 mf_bwfont_DejaVuSans12_ascii_widths[95] PROGMEM = {
+    0x04, 0x05, 0x05, 0x0a, 0x08, 0x0b, 0x0a, 0x03, 0x05, 0x05, 0x06, 0x0a, 0x04, 0x04, 0x04, 0x04,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x06,
+    0x0d, 0x08, 0x08, 0x08, 0x09, 0x08, 0x07, 0x09, 0x09, 0x03, 0x03, 0x07, 0x06, 0x0a, 0x09, 0x09,
+    0x08, 0x09, 0x08, 0x08, 0x07, 0x09, 0x08, 0x0b, 0x07, 0x07, 0x09, 0x05, 0x04, 0x05, 0x0a, 0x06,
+    0x06, 0x08, 0x08, 0x07, 0x08, 0x08, 0x04, 0x08, 0x08, 0x03, 0x03, 0x07, 0x03, 0x0b, 0x08, 0x08,
+    0x08, 0x08, 0x05, 0x07, 0x05, 0x08, 0x06, 0x09, 0x06, 0x06, 0x05, 0x08, 0x04, 0x08, 0x0a,
+};
+
 const struct mf_bwfont_s mf_bwfont_DejaVuSans12 = {
     {
     "DejaVu Sans Book 12",
@@ -154,6 +163,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSans12 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_DejaVuSans12_ascii_widths,
     },
     4, /* version */
     1, /* char range count */
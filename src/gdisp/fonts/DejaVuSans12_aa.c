@@ -208,6 +208,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_DejaVuSans12_aa_char_rang
     {32, 95, mf_rlefont_DejaVuSans12_aa_glyph_offsets_0, mf_rlefont_DejaVuSans12_aa_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_DejaVuSans12_aa_ascii_widths[95] PROGMEM = {
+    0x04, 0x05, 0x05, 0x0a, 0x08, 0x0b, 0x0a, 0x03, 0x05, 0x05, 0x06, 0x0a, 0x04, 0x04, 0x04, 0x04,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x06,
+    0x0d, 0x08, 0x08, 0x08, 0x09, 0x08, 0x07, 0x09, 0x09, 0x03, 0x03, 0x07, 0x06, 0x0a, 0x09, 0x09,
+    0x08, 0x09, 0x08, 0x08, 0x07, 0x09, 0x08, 0x0b, 0x07, 0x07, 0x09, 0x05, 0x04, 0x05, 0x0a, 0x06,
+    0x06, 0x08, 0x08, 0x07, 0x08, 0x08, 0x04, 0x08, 0x08, 0x03, 0x03, 0x07, 0x03, 0x0b, 0x08, 0x08,
+    0x08, 0x08, 0x05, 0x07, 0x05, 0x08, 0x06, 0x09, 0x06, 0x06, 0x05, 0x08, 0x04, 0x08, 0x0a,
+};
+
 const struct mf_rlefont_s mf_rlefont_DejaVuSans12_aa = {
     {
     "DejaVu Sans Book 12",
@@ -223,6 +232,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans12_aa = {
     63, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_DejaVuSans12_aa_ascii_widths,
     },
     4, /* version */
     mf_rlefont_DejaVuSans12_aa_dictionary_data,
@@ -464,6 +464,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_DejaVuSans16_char_ranges[]
     },
 };
 
+static const gU8 mf_bwfont_DejaVuSans16_ascii_widths[95] PROGMEM = {
+    0x05, 0x06, 0x07, 0x0d, 0x0a, 0x0f, 0x0c, 0x04, 0x06, 0x06, 0x08, 0x0d, 0x05, 0x06, 0x05, 0x05,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x0d, 0x0d, 0x0d, 0x09,
+    0x10, 0x0b, 0x0b, 0x0b, 0x0c, 0x0a, 0x09, 0x0c, 0x0c, 0x05, 0x05, 0x0b, 0x09, 0x0e, 0x0c, 0x0d,
+    0x0a, 0x0d, 0x0b, 0x0a, 0x0a, 0x0c, 0x0b, 0x10, 0x0b, 0x0a, 0x0b, 0x06, 0x05, 0x06, 0x0d, 0x08,
+    0x08, 0x0a, 0x0a, 0x09, 0x0a, 0x0a, 0x06, 0x0a, 0x0a, 0x04, 0x04, 0x09, 0x04, 0x10, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x07, 0x08, 0x06, 0x0a, 0x09, 0x0d, 0x09, 0x09, 0x08, 0x0a, 0x05, 0x0a, 0x0d,
+};
+
 const struct mf_bwfont_s mf_bwfont_DejaVuSans16 = {
     {
     "DejaVu Sans Book 16",
@@ -479,6 +488,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSans16 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_DejaVuSans16_ascii_widths,
     },
     4, /* version */
     3, /* char range count */
@@ -260,6 +260,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_DejaVuSans16_aa_char_rang
     {32, 95, mf_rlefont_DejaVuSans16_aa_glyph_offsets_0, mf_rlefont_DejaVuSans16_aa_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_DejaVuSans16_aa_ascii_widths[95] PROGMEM = {
+    0x05, 0x06, 0x06, 0x0d, 0x0a, 0x0f, 0x0c, 0x03, 0x06, 0x06, 0x08, 0x0d, 0x05, 0x06, 0x05, 0x05,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x05, 0x05, 0x0d, 0x0d, 0x0d, 0x09,
+    0x10, 0x0b, 0x0b, 0x0b, 0x0c, 0x0a, 0x09, 0x0c, 0x0c, 0x05, 0x05, 0x0a, 0x09, 0x0d, 0x0c, 0x0d,
+    0x0a, 0x0d, 0x0b, 0x0a, 0x09, 0x0c, 0x0b, 0x11, 0x0b, 0x09, 0x0c, 0x06, 0x05, 0x06, 0x0d, 0x08,
+    0x08, 0x09, 0x0a, 0x09, 0x0a, 0x09, 0x06, 0x0a, 0x0a, 0x03, 0x03, 0x09, 0x03, 0x0f, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x07, 0x09, 0x06, 0x0a, 0x09, 0x0d, 0x0a, 0x09, 0x09, 0x0a, 0x05, 0x0a, 0x0d,
+};
+
 const struct mf_rlefont_s mf_rlefont_DejaVuSans16_aa = {
     {
     "DejaVu Sans Book 16",
@@ -275,6 +284,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans16_aa = {
     63, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_DejaVuSans16_aa_ascii_widths,
     },
     4, /* version */
     mf_rlefont_DejaVuSans16_aa_dictionary_data,
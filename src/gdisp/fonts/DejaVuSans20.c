@@ -170,6 +170,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_DejaVuSans20_char_ranges[
     {32, 95, mf_rlefont_DejaVuSans20_glyph_offsets_0, mf_rlefont_DejaVuSans20_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_DejaVuSans20_ascii_widths[95] PROGMEM = {
+    0x06, 0x08, 0x0a, 0x11, 0x0d, 0x13, 0x0f, 0x06, 0x08, 0x08, 0x0a, 0x11, 0x06, 0x07, 0x06, 0x07,
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x07, 0x07, 0x11, 0x11, 0x11, 0x0b,
+    0x14, 0x0e, 0x0e, 0x0e, 0x0f, 0x0d, 0x0c, 0x10, 0x0f, 0x06, 0x06, 0x0d, 0x0b, 0x11, 0x0f, 0x10,
+    0x0c, 0x10, 0x0e, 0x0d, 0x0c, 0x0f, 0x0e, 0x14, 0x0e, 0x0c, 0x0e, 0x08, 0x07, 0x08, 0x11, 0x0a,
+    0x0a, 0x0c, 0x0d, 0x0b, 0x0d, 0x0c, 0x07, 0x0d, 0x0d, 0x06, 0x06, 0x0c, 0x06, 0x14, 0x0d, 0x0c,
+    0x0d, 0x0d, 0x08, 0x0a, 0x08, 0x0d, 0x0b, 0x11, 0x0b, 0x0b, 0x0b, 0x0d, 0x07, 0x0d, 0x11,
+};
+
 const struct mf_rlefont_s mf_rlefont_DejaVuSans20 = {
     {
     "DejaVu Sans Book 20",
@@ -185,6 +194,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans20 = {
     63, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_DejaVuSans20_ascii_widths,
     },
     4, /* version */
     mf_rlefont_DejaVuSans20_dictionary_data,
@@ -395,6 +395,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_DejaVuSans24_aa_char_rang
     {32, 95, mf_rlefont_DejaVuSans24_aa_glyph_offsets_0, mf_rlefont_DejaVuSans24_aa_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_DejaVuSans24_aa_ascii_widths[95] PROGMEM = {
+    0x08, 0x0a, 0x0b, 0x14, 0x0f, 0x17, 0x13, 0x07, 0x09, 0x09, 0x0c, 0x14, 0x08, 0x09, 0x08, 0x08,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x08, 0x08, 0x14, 0x14, 0x14, 0x0d,
+    0x18, 0x10, 0x10, 0x11, 0x12, 0x0f, 0x0e, 0x13, 0x12, 0x07, 0x07, 0x10, 0x0d, 0x15, 0x12, 0x13,
+    0x0e, 0x13, 0x11, 0x0f, 0x0f, 0x12, 0x10, 0x18, 0x11, 0x0f, 0x10, 0x09, 0x08, 0x09, 0x14, 0x0c,
+    0x0c, 0x0e, 0x0f, 0x0d, 0x0f, 0x0e, 0x08, 0x0f, 0x0f, 0x07, 0x07, 0x0e, 0x06, 0x18, 0x0f, 0x0e,
+    0x0f, 0x0f, 0x0a, 0x0c, 0x09, 0x0f, 0x0f, 0x14, 0x0f, 0x0f, 0x0d, 0x0f, 0x08, 0x0f, 0x14,
+};
+
 const struct mf_rlefont_s mf_rlefont_DejaVuSans24_aa = {
     {
     "DejaVu Sans Book 24",
@@ -410,6 +419,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans24_aa = {
     63, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_DejaVuSans24_aa_ascii_widths,
     },
     4, /* version */
     mf_rlefont_DejaVuSans24_aa_dictionary_data,
@@ -527,6 +527,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_DejaVuSans32_aa_char_rang
     {32, 95, mf_rlefont_DejaVuSans32_aa_glyph_offsets_0, mf_rlefont_DejaVuSans32_aa_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_DejaVuSans32_aa_ascii_widths[95] PROGMEM = {
+    0x0a, 0x0d, 0x0f, 0x1b, 0x14, 0x1e, 0x19, 0x09, 0x0c, 0x0c, 0x10, 0x1b, 0x0a, 0x0c, 0x0a, 0x0b,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0b, 0x0b, 0x1b, 0x1b, 0x1b, 0x11,
+    0x20, 0x16, 0x16, 0x16, 0x19, 0x14, 0x12, 0x19, 0x18, 0x09, 0x09, 0x15, 0x12, 0x1c, 0x18, 0x19,
+    0x13, 0x19, 0x16, 0x14, 0x14, 0x17, 0x16, 0x20, 0x16, 0x14, 0x16, 0x0c, 0x0b, 0x0c, 0x1b, 0x10,
+    0x10, 0x14, 0x14, 0x12, 0x14, 0x14, 0x0b, 0x14, 0x14, 0x09, 0x09, 0x13, 0x09, 0x1f, 0x14, 0x14,
+    0x14, 0x14, 0x0d, 0x11, 0x0d, 0x14, 0x13, 0x1a, 0x13, 0x13, 0x11, 0x14, 0x0b, 0x14, 0x1b,
+};
+
 const struct mf_rlefont_s mf_rlefont_DejaVuSans32_aa = {
     {
     "DejaVu Sans Book 32",
@@ -542,6 +551,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSans32_aa = {
     63, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_DejaVuSans32_aa_ascii_widths,
     },
     4, /* version */
     mf_rlefont_DejaVuSans32_aa_dictionary_data,
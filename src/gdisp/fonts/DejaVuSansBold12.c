@@ -150,6 +150,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_DejaVuSansBold12_char_range
     },
 };
 
+static const gU8 mf_bwfont_DejaVuSansBold12_ascii_widths[95] PROGMEM = {
+    0x04, 0x05, 0x06, 0x0a, 0x08, 0x0c, 0x0a, 0x04, 0x05, 0x05, 0x06, 0x0a, 0x05, 0x05, 0x05, 0x04,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x07,
+    0x0c, 0x09, 0x09, 0x09, 0x0a, 0x08, 0x08, 0x0a, 0x0a, 0x04, 0x04, 0x09, 0x08, 0x0c, 0x0a, 0x0b,
+    0x09, 0x0a, 0x09, 0x09, 0x08, 0x0a, 0x09, 0x0e, 0x09, 0x08, 0x0a, 0x05, 0x04, 0x05, 0x0a, 0x06,
+    0x06, 0x09, 0x09, 0x07, 0x09, 0x09, 0x05, 0x09, 0x09, 0x04, 0x04, 0x08, 0x04, 0x0c, 0x09, 0x09,
+    0x09, 0x09, 0x06, 0x08, 0x06, 0x09, 0x07, 0x0c, 0x07, 0x08, 0x08, 0x09, 0x04, 0x09, 0x0a,
+};
+
 const struct mf_bwfont_s mf_bwfont_DejaVuSansBold12 = {
     {
     "DejaVu Sans Bold 12",
@@ -165,6 +174,7 @@ const struct mf_bwfont_s mf_bwfont_DejaVuSansBold12 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_DejaVuSansBold12_ascii_widths,
     },
     4, /* version */
     1, /* char range count */
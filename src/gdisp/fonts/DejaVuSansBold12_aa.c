@@ -217,6 +217,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_DejaVuSansBold12_aa_char_
     {32, 95, mf_rlefont_DejaVuSansBold12_aa_glyph_offsets_0, mf_rlefont_DejaVuSansBold12_aa_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_DejaVuSansBold12_aa_ascii_widths[95] PROGMEM = {
+    0x04, 0x05, 0x06, 0x0a, 0x08, 0x0c, 0x0a, 0x04, 0x05, 0x05, 0x06, 0x0a, 0x05, 0x05, 0x05, 0x04,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x0a, 0x0a, 0x0a, 0x07,
+    0x0c, 0x09, 0x09, 0x09, 0x0a, 0x08, 0x08, 0x0a, 0x0a, 0x04, 0x04, 0x09, 0x08, 0x0c, 0x0a, 0x0b,
+    0x09, 0x0a, 0x09, 0x09, 0x08, 0x0a, 0x09, 0x0e, 0x09, 0x08, 0x0a, 0x05, 0x04, 0x05, 0x0a, 0x06,
+    0x06, 0x09, 0x09, 0x07, 0x09, 0x09, 0x05, 0x09, 0x09, 0x04, 0x04, 0x08, 0x04, 0x0c, 0x09, 0x09,
+    0x09, 0x09, 0x06, 0x08, 0x06, 0x09, 0x07, 0x0c, 0x07, 0x08, 0x08, 0x09, 0x04, 0x09, 0x0a,
+};
+
 const struct mf_rlefont_s mf_rlefont_DejaVuSansBold12_aa = {
     {
     "DejaVu Sans Bold 12",
@@ -232,6 +241,7 @@ const struct mf_rlefont_s mf_rlefont_DejaVuSansBold12_aa = {
     63, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_DejaVuSansBold12_aa_ascii_widths,
     },
     4, /* version */
     mf_rlefont_DejaVuSansBold12_aa_dictionary_data,
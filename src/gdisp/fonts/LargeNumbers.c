@@ -93,6 +93,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_LargeNumbers_char_ranges[
     {32, 26, mf_rlefont_LargeNumbers_glyph_offsets_0, mf_rlefont_LargeNumbers_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_LargeNumbers_ascii_widths[95] PROGMEM = {
+    0x08, 0x0b, 0x0d, 0x14, 0x11, 0x18, 0x15, 0x07, 0x0b, 0x0b, 0x0d, 0x14, 0x09, 0x0a, 0x09, 0x09,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+};
+
 const struct mf_rlefont_s mf_rlefont_LargeNumbers = {
     {
     "DejaVu Sans Bold 24",
@@ -108,6 +117,7 @@ const struct mf_rlefont_s mf_rlefont_LargeNumbers = {
     32, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_LargeNumbers_ascii_widths,
     },
     4, /* version */
     mf_rlefont_LargeNumbers_dictionary_data,
@@ -217,6 +217,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_UI1_char_ranges[] = {
     {149, 107, mf_rlefont_UI1_glyph_offsets_2, mf_rlefont_UI1_glyph_data_2},
 };
 
+static const gU8 mf_rlefont_UI1_ascii_widths[95] PROGMEM = {
+    0x03, 0x03, 0x05, 0x08, 0x07, 0x0b, 0x09, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x05, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x04, 0x07, 0x07, 0x07, 0x06,
+    0x0a, 0x09, 0x07, 0x08, 0x08, 0x06, 0x06, 0x08, 0x08, 0x03, 0x05, 0x07, 0x06, 0x0b, 0x08, 0x09,
+    0x07, 0x0a, 0x07, 0x06, 0x07, 0x08, 0x09, 0x0d, 0x09, 0x07, 0x08, 0x04, 0x07, 0x04, 0x07, 0x08,
+    0x04, 0x07, 0x07, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x03, 0x04, 0x06, 0x03, 0x0a, 0x07, 0x07,
+    0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x0b, 0x07, 0x07, 0x05, 0x05, 0x03, 0x05, 0x07,
+};
+
 const struct mf_rlefont_s mf_rlefont_UI1 = {
     {
     "UI1",
@@ -232,6 +241,7 @@ const struct mf_rlefont_s mf_rlefont_UI1 = {
     32, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_UI1_ascii_widths,
     },
     4, /* version */
     mf_rlefont_UI1_dictionary_data,
@@ -262,6 +272,7 @@ const struct mf_scaledfont_s mf_rlefont_UI1_Narrow = {
 			32, /* fallback character */
 			&mf_scaled_character_width,
 			&mf_scaled_render_character,
+			0,
 	    },
 	    (struct mf_font_s*)&mf_rlefont_UI1,
 		1, 2,
@@ -282,6 +293,7 @@ const struct mf_scaledfont_s mf_rlefont_UI1_Double = {
 			32, /* fallback character */
 			&mf_scaled_character_width,
 			&mf_scaled_render_character,
+			0,
 	    },
 	    (struct mf_font_s*)&mf_rlefont_UI1,
 		2, 2,
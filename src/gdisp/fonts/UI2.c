@@ -124,6 +124,15 @@ static const struct mf_rlefont_char_range_s mf_rlefont_UI2_char_ranges[] = {
     {32, 95, mf_rlefont_UI2_glyph_offsets_0, mf_rlefont_UI2_glyph_data_0},
 };
 
+static const gU8 mf_rlefont_UI2_ascii_widths[95] PROGMEM = {
+    0x03, 0x03, 0x05, 0x08, 0x07, 0x0b, 0x09, 0x03, 0x04, 0x04, 0x07, 0x07, 0x04, 0x05, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x04, 0x07, 0x07, 0x07, 0x06,
+    0x0a, 0x09, 0x07, 0x08, 0x08, 0x06, 0x06, 0x08, 0x08, 0x03, 0x05, 0x07, 0x06, 0x0b, 0x08, 0x09,
+    0x07, 0x0a, 0x07, 0x06, 0x07, 0x08, 0x09, 0x0d, 0x09, 0x07, 0x08, 0x04, 0x07, 0x04, 0x07, 0x08,
+    0x04, 0x07, 0x07, 0x06, 0x07, 0x06, 0x06, 0x07, 0x07, 0x03, 0x04, 0x06, 0x03, 0x0a, 0x07, 0x07,
+    0x07, 0x07, 0x06, 0x06, 0x06, 0x07, 0x07, 0x0b, 0x07, 0x07, 0x05, 0x05, 0x03, 0x05, 0x07,
+};
+
 const struct mf_rlefont_s mf_rlefont_UI2 = {
     {
     "UI2",
@@ -139,6 +148,7 @@ const struct mf_rlefont_s mf_rlefont_UI2 = {
     32, /* fallback character */
     &mf_rlefont_character_width,
     &mf_rlefont_render_character,
+    mf_rlefont_UI2_ascii_widths,
     },
     4, /* version */
     mf_rlefont_UI2_dictionary_data,
@@ -169,6 +179,7 @@ const struct mf_scaledfont_s mf_rlefont_UI2_Narrow = {
 			32, /* fallback character */
 			&mf_scaled_character_width,
 			&mf_scaled_render_character,
+			0,
 	    },
 	    (struct mf_font_s*)&mf_rlefont_UI2,
 		1, 2,
@@ -189,6 +200,7 @@ const struct mf_scaledfont_s mf_rlefont_UI2_Double = {
 			32, /* fallback character */
 			&mf_scaled_character_width,
 			&mf_scaled_render_character,
+			0,
 	    },
 	    (struct mf_font_s*)&mf_rlefont_UI2,
 		2, 2,
@@ -191,6 +191,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_fixed_10x20_char_ranges[] =
     },
 };
 
+static const gU8 mf_bwfont_fixed_10x20_ascii_widths[95] PROGMEM = {
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+    0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+};
+
 const struct mf_bwfont_s mf_bwfont_fixed_10x20 = {
     {
     "-Misc-Fixed-Medium-R-Normal--20-200-75-75-C-100-ISO8859-15",
@@ -206,6 +215,7 @@ const struct mf_bwfont_s mf_bwfont_fixed_10x20 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_fixed_10x20_ascii_widths,
     },
     4, /* version */
     1, /* char range count */
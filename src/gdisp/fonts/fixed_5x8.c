@@ -59,6 +59,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_fixed_5x8_char_ranges[] = {
     },
 };
 
+static const gU8 mf_bwfont_fixed_5x8_ascii_widths[95] PROGMEM = {
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+};
+
 const struct mf_bwfont_s mf_bwfont_fixed_5x8 = {
     {
     "-Misc-Fixed-Medium-R-Normal--8-80-75-75-C-50-ISO8859-15",
@@ -74,6 +83,7 @@ const struct mf_bwfont_s mf_bwfont_fixed_5x8 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_fixed_5x8_ascii_widths,
     },
     4, /* version */
     1, /* char range count */
@@ -113,6 +113,15 @@ static const struct mf_bwfont_char_range_s mf_bwfont_fixed_7x14_char_ranges[] =
     },
 };
 
+static const gU8 mf_bwfont_fixed_7x14_ascii_widths[95] PROGMEM = {
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+};
+
 const struct mf_bwfont_s mf_bwfont_fixed_7x14 = {
     {
     "-Misc-Fixed-Medium-R-Normal--14-130-75-75-C-70-ISO8859-15",
@@ -128,6 +137,7 @@ const struct mf_bwfont_s mf_bwfont_fixed_7x14 = {
     63, /* fallback character */
     &mf_bwfont_character_width,
     &mf_bwfont_render_character,
+    mf_bwfont_fixed_7x14_ascii_widths,
     },
     4, /* version */
     1, /* char range count */
@@ -12,6 +12,10 @@
 /* Include the low level driver information */
 #include "gdisp_driver.h"
 
+#if GDISP_NEED_DISPLAYLIST || GDISP_NEED_DRAWCONTEXT
+	#include <string.h>			// For memcpy() and memmove()
+#endif
+
 // Number of milliseconds for the startup logo - 0 means disabled.
 #if GDISP_NEED_STARTUP_LOGO
 	#define GDISP_STARTUP_LOGO_TIMEOUT		1000
@@ -64,6 +68,129 @@ GDisplay	*GDISP;
 		if ((g)->p.cx > 0 && (g)->p.cy > 0)
 #endif
 
+#if GDISP_NEED_PIXELCOUNT
+	#define PIXELCOUNT(g, n)		(g)->pixelcount += (gU32)(n)
+#else
+	#define PIXELCOUNT(g, n)
+#endif
+
+#if GDISP_NEED_DISPLAYLIST
+	// A display list operation. A blit is followed by its pixels.
+	typedef struct listop {
+		gU16			op;
+			#define LISTOP_FILL		0x0000
+			#define LISTOP_BLIT		0x0001
+			#define LISTOP_DROPPED	0x8000		// Marked for removal by gdispListOptimize()
+		gColor			color;
+		gCoord			x, y, cx, cy;
+	} listop;
+
+	// Operations only hold 32 bit or smaller members so pixels are padded to 4 bytes
+	#define LIST_ALIGN(n)			(((n) + 3) & ~(gMemSize)3)
+	#define LIST_OPSIZE(po)			(((po)->op & ~LISTOP_DROPPED) == LISTOP_BLIT ? sizeof(listop) + LIST_ALIGN((gMemSize)(po)->cx * (po)->cy * sizeof(gPixel)) : sizeof(listop))
+	#define LIST_OP(pl, pos)		((listop *)((gU8 *)(pl)->ops + (pos)))
+	#define LIST_BLOCK				256
+
+	// Make room for an operation at the end of a display list
+	static listop *listadd(gdispList *pl, gMemSize sz) {
+		gMemSize	size;
+		void *		p;
+
+		if (pl->used + sz > pl->size) {
+			if (pl->failed)
+				return 0;
+			for(size = pl->size ? pl->size : LIST_BLOCK; size < pl->used + sz; size <<= 1);
+			if (!(p = pl->ops ? gfxRealloc(pl->ops, pl->size, size) : gfxAlloc(size))) {
+				pl->failed = gTrue;
+				return 0;
+			}
+			pl->ops = p;
+			pl->size = size;
+		}
+		pl->last = pl->used;
+		pl->used += sz;
+		return LIST_OP(pl, pl->last);
+	}
+
+	// Join a fill on to the previous one if they are the same color and together make a rectangle
+	static gBool listjoin(listop *po, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+		if (po->op != LISTOP_FILL || po->color != color)
+			return gFalse;
+		if (po->x == x && po->cx == cx) {
+			if (y == po->y + po->cy) {
+				po->cy += cy;
+				return gTrue;
+			}
+			if (y + cy == po->y) {
+				po->y = y;
+				po->cy += cy;
+				return gTrue;
+			}
+		}
+		if (po->y == y && po->cy == cy) {
+			if (x == po->x + po->cx) {
+				po->cx += cx;
+				return gTrue;
+			}
+			if (x + cx == po->x) {
+				po->x = x;
+				po->cx += cx;
+				return gTrue;
+			}
+		}
+		return gFalse;
+	}
+
+	static void listfill(gdispList *pl, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color) {
+		listop	*po;
+
+		if (pl->used && listjoin(LIST_OP(pl, pl->last), x, y, cx, cy, color))
+			return;
+		if (!(po = listadd(pl, sizeof(listop))))
+			return;
+		po->op = LISTOP_FILL;
+		po->color = color;
+		po->x = x;
+		po->y = y;
+		po->cx = cx;
+		po->cy = cy;
+	}
+
+	static void listblit(gdispList *pl, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+		listop	*po;
+		gPixel	*pd;
+
+		if (!(po = listadd(pl, sizeof(listop) + LIST_ALIGN((gMemSize)cx * cy * sizeof(gPixel)))))
+			return;
+		po->op = LISTOP_BLIT;
+		po->x = x;
+		po->y = y;
+		po->cx = cx;
+		po->cy = cy;
+		pd = (gPixel *)(po+1);
+		for(buffer += srcy*srccx+srcx; cy; cy--, buffer += srccx, pd += cx)
+			memcpy(pd, buffer, cx * sizeof(gPixel));
+	}
+
+	// Find the color the list has recorded for a pixel. Returns gFalse if nothing recorded covers it.
+	static gBool listpixel(const gdispList *pl, gCoord x, gCoord y, gColor *pc) {
+		const listop *	po;
+		gMemSize		pos;
+		gBool			found;
+
+		// Later operations draw over earlier ones
+		found = gFalse;
+		for(pos = 0; pos < pl->used; pos += LIST_OPSIZE(po)) {
+			po = LIST_OP(pl, pos);
+			if ((po->op & LISTOP_DROPPED) || x < po->x || y < po->y || x >= po->x + po->cx || y >= po->y + po->cy)
+				continue;
+			*pc = po->op == LISTOP_BLIT ? ((const gPixel *)(po+1))[(y - po->y) * po->cx + (x - po->x)] : po->color;
+			found = gTrue;
+		}
+		return found;
+	}
+#endif
+
 /*==========================================================================*/
 /* Internal functions.														*/
 /*==========================================================================*/
@@ -106,6 +233,13 @@ GDisplay	*GDISP;
 // Alters:		cx, cy (if using streaming)
 // Does not clip
 static GFXINLINE void drawpixel(GDisplay *g) {
+	#if GDISP_NEED_DISPLAYLIST
+		if (g->list) {
+			listfill(g->list, g->p.x, g->p.y, 1, 1, g->p.color);
+			return;
+		}
+	#endif
+	PIXELCOUNT(g, 1);
 
 	// Best is hardware accelerated pixel draw
 	#if GDISP_HARDWARE_DRAWPIXEL
@@ -148,6 +282,21 @@ static GFXINLINE void drawpixel(GDisplay *g) {
 	#endif
 }
 
+#if NEED_CLIPPING && GDISP_NEED_CLIP_REGION
+	// inregion(g, x, y, cx, cy)
+	// Returns gTrue if the area lies completely within one rectangle of the clip region
+	static gBool inregion(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		const gdispRegionRect	*r;
+		unsigned				i;
+
+		for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+			if (x >= r->x0 && y >= r->y0 && x+cx <= r->x1 && y+cy <= r->y1)
+				return gTrue;
+		}
+		return gFalse;
+	}
+#endif
+
 // drawpixel_clip(g)
 // Parameters:	x,y
 // Alters:		cx, cy (if using streaming)
@@ -159,6 +308,10 @@ static GFXINLINE void drawpixel(GDisplay *g) {
 		{
 			if (g->p.x < g->clipx0 || g->p.x >= g->clipx1 || g->p.y < g->clipy0 || g->p.y >= g->clipy1)
 				return;
+			#if GDISP_NEED_CLIP_REGION
+				if (g->useregion && !inregion(g, g->p.x, g->p.y, 1, 1))
+					return;
+			#endif
 		}
 		drawpixel(g);
 	}
@@ -166,12 +319,42 @@ static GFXINLINE void drawpixel(GDisplay *g) {
 	#define drawpixel_clip(g)		drawpixel(g)
 #endif
 
+#if GDISP_NEED_PARALLEL
+	// A band of a large fill or blit. Each band is drawn through its own copy of the display.
+	typedef struct parband {
+		gSem		start;				// Signalled when the band is ready to draw
+		GDisplay	ctx;				// The band is in x,y cx,cy and color or x1,y1 x2 ptr for a blit
+	} parband;
+
+	static gMutex	parMutex;							// Only one display can use the workers at a time
+	static gSem		parDone;							// Signalled as each worker finishes its band
+	static gBool	parStarted;
+	static unsigned	parThreads;							// The number of workers that are running
+	static unsigned	parUse = GDISP_PARALLEL_THREADS;	// The number of workers to use
+	static parband	parBands[GDISP_PARALLEL_THREADS+1];	// The last band is drawn by the calling thread
+
+	static gBool parallel(GDisplay *g, const gPixel *buffer);
+#endif
+
 // fillarea(g)
 // Parameters:	x,y cx,cy and color
 // Alters:		nothing
 // Note:		This is not clipped
 // Resets the streaming area if GDISP_HARDWARE_STREAM_WRITE and GDISP_HARDWARE_STREAM_POS is set.
 static GFXINLINE void fillarea(GDisplay *g) {
+	#if GDISP_NEED_DISPLAYLIST
+		if (g->list) {
+			listfill(g->list, g->p.x, g->p.y, g->p.cx, g->p.cy, g->p.color);
+			return;
+		}
+	#endif
+	PIXELCOUNT(g, (gU32)g->p.cx * g->p.cy);
+
+	// Large areas are shared with the worker threads
+	#if GDISP_NEED_PARALLEL
+		if ((gU32)g->p.cx * g->p.cy >= GDISP_PARALLEL_MIN_PIXELS && parallel(g, 0))
+			return;
+	#endif
 
 	// Best is hardware accelerated area fill
 	#if GDISP_HARDWARE_FILLS
@@ -242,26 +425,17 @@ static GFXINLINE void fillarea(GDisplay *g) {
 	#endif
 }
 
-// Parameters:	x,y and x1
+// hline(g)
+// Parameters:	x,y and x1 (x <= x1)
 // Alters:		x,y x1,y1 cx,cy
+// Note:		This is not clipped
 // Assumes the window covers the screen and a write_stop() will occur later
 //	if GDISP_HARDWARE_STREAM_WRITE and GDISP_HARDWARE_STREAM_POS is set.
-static void hline_clip(GDisplay *g) {
-	// Swap the points if necessary so it always goes from x to x1
-	if (g->p.x1 < g->p.x) {
-		g->p.cx = g->p.x; g->p.x = g->p.x1; g->p.x1 = g->p.cx;
-	}
-
-	// Clipping
-	#if NEED_CLIPPING
-		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-			if (!gvmt(g)->setclip)
-		#endif
-		{
-			if (g->p.y < g->clipy0 || g->p.y >= g->clipy1) return;
-			if (g->p.x < g->clipx0) g->p.x = g->clipx0;
-			if (g->p.x1 >= g->clipx1) g->p.x1 = g->clipx1 - 1;
-			if (g->p.x1 < g->p.x) return;
+static void hline(GDisplay *g) {
+	#if GDISP_NEED_DISPLAYLIST
+		if (g->list) {
+			listfill(g->list, g->p.x, g->p.y, g->p.x1 - g->p.x + 1, 1, g->p.color);
+			return;
 		}
 	#endif
 
@@ -274,6 +448,7 @@ static void hline_clip(GDisplay *g) {
 			return;
 		}
 	#endif
+	PIXELCOUNT(g, g->p.x1 - g->p.x + 1);
 
 	// Best is hardware accelerated area fill
 	#if GDISP_HARDWARE_FILLS
@@ -332,24 +507,15 @@ static void hline_clip(GDisplay *g) {
 	#endif
 }
 
-// Parameters:	x,y and y1
+// vline(g)
+// Parameters:	x,y and y1 (y <= y1)
 // Alters:		x,y x1,y1 cx,cy
-static void vline_clip(GDisplay *g) {
-	// Swap the points if necessary so it always goes from y to y1
-	if (g->p.y1 < g->p.y) {
-		g->p.cy = g->p.y; g->p.y = g->p.y1; g->p.y1 = g->p.cy;
-	}
-
-	// Clipping
-	#if NEED_CLIPPING
-		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-			if (!gvmt(g)->setclip)
-		#endif
-		{
-			if (g->p.x < g->clipx0 || g->p.x >= g->clipx1) return;
-			if (g->p.y < g->clipy0) g->p.y = g->clipy0;
-			if (g->p.y1 >= g->clipy1) g->p.y1 = g->clipy1 - 1;
-			if (g->p.y1 < g->p.y) return;
+// Note:		This is not clipped
+static void vline(GDisplay *g) {
+	#if GDISP_NEED_DISPLAYLIST
+		if (g->list) {
+			listfill(g->list, g->p.x, g->p.y, 1, g->p.y1 - g->p.y + 1, g->p.color);
+			return;
 		}
 	#endif
 
@@ -362,6 +528,7 @@ static void vline_clip(GDisplay *g) {
 			return;
 		}
 	#endif
+	PIXELCOUNT(g, g->p.y1 - g->p.y + 1);
 
 	// Best is hardware accelerated area fill
 	#if GDISP_HARDWARE_FILLS
@@ -423,6 +590,134 @@ static void vline_clip(GDisplay *g) {
 	#endif
 }
 
+#if NEED_CLIPPING && GDISP_NEED_CLIP_REGION
+	// fillarea_clip(g)
+	// Parameters:	x,y cx,cy and color (already clipped to the clip area)
+	// Alters:		nothing
+	static void fillarea_clip(GDisplay *g) {
+		const gdispRegionRect	*r;
+		gCoord					x, y, cx, cy;
+		unsigned				i;
+
+		if (!g->useregion) {
+			fillarea(g);
+			return;
+		}
+		x = g->p.x; y = g->p.y;
+		cx = g->p.cx; cy = g->p.cy;
+		for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+			g->p.x = x < r->x0 ? r->x0 : x;
+			g->p.y = y < r->y0 ? r->y0 : y;
+			g->p.cx = (x+cx > r->x1 ? r->x1 : x+cx) - g->p.x;
+			g->p.cy = (y+cy > r->y1 ? r->y1 : y+cy) - g->p.y;
+			if (g->p.cx > 0 && g->p.cy > 0)
+				fillarea(g);
+		}
+		g->p.x = x; g->p.y = y;
+		g->p.cx = cx; g->p.cy = cy;
+	}
+
+	// Parameters:	x,y and x1 (already clipped to the clip area)
+	// Alters:		x,y x1,y1 cx,cy
+	static void hline_region(GDisplay *g) {
+		const gdispRegionRect	*r;
+		gCoord					x, y, x1;
+		unsigned				i;
+
+		x = g->p.x; y = g->p.y; x1 = g->p.x1;
+		for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+			if (y < r->y0 || y >= r->y1 || x >= r->x1 || x1 < r->x0)
+				continue;
+			g->p.x = x < r->x0 ? r->x0 : x;
+			g->p.x1 = x1 >= r->x1 ? r->x1 - 1 : x1;
+			g->p.y = y;
+			hline(g);
+		}
+	}
+
+	// Parameters:	x,y and y1 (already clipped to the clip area)
+	// Alters:		x,y x1,y1 cx,cy
+	static void vline_region(GDisplay *g) {
+		const gdispRegionRect	*r;
+		gCoord					x, y, y1;
+		unsigned				i;
+
+		x = g->p.x; y = g->p.y; y1 = g->p.y1;
+		for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+			if (x < r->x0 || x >= r->x1 || y >= r->y1 || y1 < r->y0)
+				continue;
+			g->p.y = y < r->y0 ? r->y0 : y;
+			g->p.y1 = y1 >= r->y1 ? r->y1 - 1 : y1;
+			g->p.x = x;
+			vline(g);
+		}
+	}
+#else
+	#define fillarea_clip(g)	fillarea(g)
+#endif
+
+// Parameters:	x,y and x1
+// Alters:		x,y x1,y1 cx,cy
+// Assumes the window covers the screen and a write_stop() will occur later
+//	if GDISP_HARDWARE_STREAM_WRITE and GDISP_HARDWARE_STREAM_POS is set.
+static void hline_clip(GDisplay *g) {
+	// Swap the points if necessary so it always goes from x to x1
+	if (g->p.x1 < g->p.x) {
+		g->p.cx = g->p.x; g->p.x = g->p.x1; g->p.x1 = g->p.cx;
+	}
+
+	// Clipping
+	#if NEED_CLIPPING
+		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+			if (!gvmt(g)->setclip)
+		#endif
+		{
+			if (g->p.y < g->clipy0 || g->p.y >= g->clipy1) return;
+			if (g->p.x < g->clipx0) g->p.x = g->clipx0;
+			if (g->p.x1 >= g->clipx1) g->p.x1 = g->clipx1 - 1;
+			if (g->p.x1 < g->p.x) return;
+			#if GDISP_NEED_CLIP_REGION
+				if (g->useregion) {
+					hline_region(g);
+					return;
+				}
+			#endif
+		}
+	#endif
+
+	hline(g);
+}
+
+// Parameters:	x,y and y1
+// Alters:		x,y x1,y1 cx,cy
+static void vline_clip(GDisplay *g) {
+	// Swap the points if necessary so it always goes from y to y1
+	if (g->p.y1 < g->p.y) {
+		g->p.cy = g->p.y; g->p.y = g->p.y1; g->p.y1 = g->p.cy;
+	}
+
+	// Clipping
+	#if NEED_CLIPPING
+		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+			if (!gvmt(g)->setclip)
+		#endif
+		{
+			if (g->p.x < g->clipx0 || g->p.x >= g->clipx1) return;
+			if (g->p.y < g->clipy0) g->p.y = g->clipy0;
+			if (g->p.y1 >= g->clipy1) g->p.y1 = g->clipy1 - 1;
+			if (g->p.y1 < g->p.y) return;
+			#if GDISP_NEED_CLIP_REGION
+				if (g->useregion) {
+					vline_region(g);
+					return;
+				}
+			#endif
+		}
+	#endif
+
+	vline(g);
+}
+
 // Parameters:	x,y and x1,y1
 // Alters:		x,y x1,y1 cx,cy
 static void line_clip(GDisplay *g) {
@@ -565,6 +860,12 @@ static void line_clip(GDisplay *g) {
 
 void _gdispInit(void)
 {
+	// The worker threads are started when they are first needed
+	#if GDISP_NEED_PARALLEL
+		gfxMutexInit(&parMutex);
+		gfxSemInit(&parDone, 0, GDISP_PARALLEL_THREADS);
+	#endif
+
 	// GDISP_DRIVER_LIST is defined - create each driver instance
 	#if defined(GDISP_DRIVER_LIST)
 		{
@@ -713,6 +1014,54 @@ unsigned gdispGetDisplayCount(void) {
 	return gdriverInstanceCount(GDRIVER_TYPE_DISPLAY);
 }
 
+#if GDISP_NEED_DRAWCONTEXT
+	GDisplay *gdispGContextCreate(GDisplay *g) {
+		GDisplay	*ctx;
+
+		// Contexts of contexts are really contexts of the display
+		if (g->parent)
+			g = g->parent;
+
+		// The driver must be able to draw for several contexts at the same time
+		if (!(gvmt(g)->d.flags & GDISP_VFLG_CONCURRENT))
+			return 0;
+		if (!(ctx = gfxAlloc(gvmt(g)->d.objsize)))
+			return 0;
+
+		// Take a copy of the display so the driver sees the same private data and display size.
+		//	Everything that changes while drawing then belongs to the context alone.
+		MUTEX_ENTER(g);
+		memcpy(ctx, g, gvmt(g)->d.objsize);
+		MUTEX_EXIT(g);
+		ctx->d.driverchain = 0;
+		ctx->parent = g;
+		ctx->flags &= ~(GDISP_FLG_INSTREAM|GDISP_FLG_SCRSTREAM);
+		#if GDISP_NEED_DISPLAYLIST
+			ctx->list = 0;
+		#endif
+		#if GDISP_NEED_PIXELCOUNT
+			ctx->pixelcount = 0;
+		#endif
+		MUTEX_INIT(ctx);
+
+		// Start with nothing clipped
+		#if GDISP_NEED_CLIP_REGION && GDISP_HARDWARE_CLIP != GFXON
+			ctx->useregion = gFalse;
+		#endif
+		#if GDISP_NEED_VALIDATION || GDISP_NEED_CLIP
+			gdispGSetClip(ctx, 0, 0, ctx->g.Width, ctx->g.Height);
+		#endif
+		return ctx;
+	}
+
+	void gdispContextDelete(GDisplay *ctx) {
+		if (!ctx || !ctx->parent)
+			return;
+		MUTEX_DEINIT(ctx);
+		gfxFree(ctx);
+	}
+#endif
+
 gCoord gdispGGetWidth(GDisplay *g)				{ return g->g.Width; }
 gCoord gdispGGetHeight(GDisplay *g)			{ return g->g.Height; }
 gPowermode gdispGGetPowerMode(GDisplay *g)		{ return g->g.Powermode; }
@@ -743,8 +1092,25 @@ void gdispGFlush(GDisplay *g) {
 			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
 				if (!gvmt(g)->setclip)
 			#endif
-			// Test if the area is valid - if not then exit
-			if (x < g->clipx0 || x+cx > g->clipx1 || y < g->clipy0 || y+cy > g->clipy1) {
+			{
+				// Test if the area is valid - if not then exit
+				if (x < g->clipx0 || x+cx > g->clipx1 || y < g->clipy0 || y+cy > g->clipy1) {
+					MUTEX_EXIT(g);
+					return;
+				}
+				#if GDISP_NEED_CLIP_REGION
+					if (g->useregion && !inregion(g, x, y, cx, cy)) {
+						MUTEX_EXIT(g);
+						return;
+					}
+				#endif
+			}
+		#endif
+
+		#if GDISP_NEED_DISPLAYLIST
+			// Streamed pixels can't be recorded
+			if (g->list) {
+				g->list->failed = gTrue;
 				MUTEX_EXIT(g);
 				return;
 			}
@@ -797,7 +1163,7 @@ void gdispGFlush(GDisplay *g) {
 	}
 
 	void gdispGStreamColor(GDisplay *g, gColor color) {
-		#if !GDISP_HARDWARE_STREAM_WRITE && GDISP_LINEBUF_SIZE != 0 && GDISP_HARDWARE_BITFILLS
+		#if GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_LINEBUF_SIZE != 0 && GDISP_HARDWARE_BITFILLS
 			gCoord	 sx1, sy1;
 		#endif
 
@@ -806,6 +1172,7 @@ void gdispGFlush(GDisplay *g) {
 		// Ignore this call if we are not streaming
 		if (!(g->flags & GDISP_FLG_INSTREAM))
 			return;
+		PIXELCOUNT(g, 1);
 
 		// Best is hardware streaming
 		#if GDISP_HARDWARE_STREAM_WRITE
@@ -1007,6 +1374,27 @@ void gdispGDrawLine(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gCo
 void gdispGClear(GDisplay *g, gColor color) {
 	// Note - clear() ignores the clipping area. It clears the screen.
 	MUTEX_ENTER(g);
+	#if GDISP_NEED_DISPLAYLIST
+		if (g->list) {
+			listfill(g->list, 0, 0, g->g.Width, g->g.Height, color);
+			MUTEX_EXIT(g);
+			return;
+		}
+	#endif
+	PIXELCOUNT(g, (gU32)g->g.Width * g->g.Height);
+
+	// Large displays are cleared by the worker threads
+	#if GDISP_NEED_PARALLEL
+		g->p.x = g->p.y = 0;
+		g->p.cx = g->g.Width;
+		g->p.cy = g->g.Height;
+		g->p.color = color;
+		if ((gU32)g->p.cx * g->p.cy >= GDISP_PARALLEL_MIN_PIXELS && parallel(g, 0)) {
+			autoflush_stopdone(g);
+			MUTEX_EXIT(g);
+			return;
+		}
+	#endif
 
 	// Best is hardware accelerated clear
 	#if GDISP_HARDWARE_CLEARS
@@ -1095,27 +1483,35 @@ void gdispGFillArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColo
 	g->p.cy = cy;
 	g->p.color = color;
 	TEST_CLIP_AREA(g) {
-		fillarea(g);
+		fillarea_clip(g);
 	}
 	autoflush_stopdone(g);
 	MUTEX_EXIT(g);
 }
 
-void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
-	MUTEX_ENTER(g);
+// blitarea(g, x, y, cx, cy, srcx, srcy, srccx, buffer)
+// Note:		This is not clipped
+static void blitarea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+	#if GDISP_NEED_DISPLAYLIST
+		if (g->list) {
+			listblit(g->list, x, y, cx, cy, srcx, srcy, srccx, buffer);
+			return;
+		}
+	#endif
+	PIXELCOUNT(g, (gU32)cx * cy);
 
-	#if NEED_CLIPPING
-		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-			if (!gvmt(g)->setclip)
-		#endif
-		{
-			// This is a different clipping to fillarea(g) as it needs to take into account srcx,srcy
-			if (x < g->clipx0) { cx -= g->clipx0 - x; srcx += g->clipx0 - x; x = g->clipx0; }
-			if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - x; y = g->clipy0; }
-			if (x+cx > g->clipx1)	cx = g->clipx1 - x;
-			if (y+cy > g->clipy1)	cy = g->clipy1 - y;
-			if (srcx+cx > srccx) cx = srccx - srcx;
-			if (cx <= 0 || cy <= 0) { MUTEX_EXIT(g); return; }
+	// Large areas are shared with the worker threads
+	#if GDISP_NEED_PARALLEL
+		if ((gU32)cx * cy >= GDISP_PARALLEL_MIN_PIXELS) {
+			g->p.x = x;
+			g->p.y = y;
+			g->p.cx = cx;
+			g->p.cy = cy;
+			g->p.x1 = srcx;
+			g->p.y1 = srcy;
+			g->p.x2 = srccx;
+			if (parallel(g, buffer))
+				return;
 		}
 	#endif
 
@@ -1134,8 +1530,6 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			g->p.x2 = srccx;
 			g->p.ptr = (void *)buffer;
 			gdisp_lld_blit_area(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1170,8 +1564,6 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				}
 			}
 			gdisp_lld_write_stop(g);
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1205,8 +1597,6 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 					}
 				}
 			}
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
@@ -1230,23 +1620,444 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 					gdisp_lld_draw_pixel(g);
 				}
 			}
-			autoflush_stopdone(g);
-			MUTEX_EXIT(g);
 			return;
 		}
 	#endif
 }
 
-#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
-	void gdispGSetClip(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
-		MUTEX_ENTER(g);
+// blitarea_clip(g, x, y, cx, cy, srcx, srcy, srccx, buffer)
+// Note:		This is clipped
+static void blitarea_clip(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+	#if NEED_CLIPPING
+		#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+			if (!gvmt(g)->setclip)
+		#endif
+		{
+			// This is a different clipping to fillarea(g) as it needs to take into account srcx,srcy
+			if (x < g->clipx0) { cx -= g->clipx0 - x; srcx += g->clipx0 - x; x = g->clipx0; }
+			if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - y; y = g->clipy0; }
+			if (x+cx > g->clipx1)	cx = g->clipx1 - x;
+			if (y+cy > g->clipy1)	cy = g->clipy1 - y;
+			if (srcx+cx > srccx) cx = srccx - srcx;
+			if (cx <= 0 || cy <= 0)
+				return;
 
-		// Best is using hardware clipping
-		#if GDISP_HARDWARE_CLIP
-			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-				if (gvmt(g)->setclip)
-			#endif
-			{
+			#if GDISP_NEED_CLIP_REGION
+				if (g->useregion) {
+					const gdispRegionRect	*r;
+					gCoord					rx, ry, rcx, rcy;
+					unsigned				i;
+
+					// Blit the part of the area within each rectangle of the region
+					for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+						rx = x < r->x0 ? r->x0 : x;
+						ry = y < r->y0 ? r->y0 : y;
+						rcx = (x+cx > r->x1 ? r->x1 : x+cx) - rx;
+						rcy = (y+cy > r->y1 ? r->y1 : y+cy) - ry;
+						if (rcx > 0 && rcy > 0)
+							blitarea(g, rx, ry, rcx, rcy, srcx+rx-x, srcy+ry-y, srccx, buffer);
+					}
+					return;
+				}
+			#endif
+		}
+	#endif
+
+	blitarea(g, x, y, cx, cy, srcx, srcy, srccx, buffer);
+}
+
+#if GDISP_NEED_PARALLEL
+	static void parbanddraw(GDisplay *ctx) {
+		if (ctx->p.ptr)
+			blitarea(ctx, ctx->p.x, ctx->p.y, ctx->p.cx, ctx->p.cy, ctx->p.x1, ctx->p.y1, ctx->p.x2, (const gPixel *)ctx->p.ptr);
+		else
+			fillarea(ctx);
+	}
+
+	static GFX_THREAD_FUNCTION(parThread, param) {
+		parband	*pb;
+
+		pb = (parband *)param;
+		while(1) {
+			gfxSemWait(&pb->start, gDelayForever);
+			parbanddraw(&pb->ctx);
+			gfxSemSignal(&parDone);
+		}
+		gfxThreadReturn(0);
+	}
+
+	// parallel(g, buffer)
+	// Parameters:	The area (already clipped) in x,y cx,cy and color for a fill (buffer = NULL)
+	//				or x1,y1 x2 (=srcx,srcy srccx) for a blit
+	// Alters:		nothing
+	// Returns:		gFalse if the area has not been drawn because it can't be shared
+	// Splits the area into bands of rows and waits for them all to be drawn.
+	static gBool parallel(GDisplay *g, const gPixel *buffer) {
+		GDisplay	*ctx;
+		gThread		t;
+		unsigned	n, i;
+		gCoord		y, h;
+
+		// Bands draw through draw contexts so they can't be split again
+		if (g->parent || !(gvmt(g)->d.flags & GDISP_VFLG_CONCURRENT))
+			return gFalse;
+
+		gfxMutexEnter(&parMutex);
+
+		// Start the workers the first time they are needed
+		if (!parStarted) {
+			parStarted = gTrue;
+			for(; parThreads < GDISP_PARALLEL_THREADS; parThreads++) {
+				gfxSemInit(&parBands[parThreads].start, 0, 1);
+				if (!(t = gfxThreadCreate(0, GDISP_PARALLEL_THREAD_WORKAREA_SIZE, gThreadpriorityNormal, parThread, &parBands[parThreads]))) {
+					gfxSemDestroy(&parBands[parThreads].start);
+					break;
+				}
+				gfxThreadClose(t);
+			}
+		}
+
+		// Every band has at least one row. The first band also gets the left over rows.
+		n = (parUse < parThreads ? parUse : parThreads) + 1;
+		if ((gCoord)n > g->p.cy)
+			n = g->p.cy;
+		if (n < 2) {
+			gfxMutexExit(&parMutex);
+			return gFalse;
+		}
+		h = g->p.cy / n;
+		y = g->p.y + g->p.cy - h * (n-1);
+
+		// Give the other bands to the workers
+		for(i = 0; i < n-1; i++, y += h) {
+			ctx = &parBands[i].ctx;
+			memcpy(ctx, g, sizeof(GDisplay));
+			ctx->parent = g;
+			ctx->p.ptr = (void *)buffer;
+			if (buffer)
+				ctx->p.y1 += y - g->p.y;
+			ctx->p.y = y;
+			ctx->p.cy = h;
+			gfxSemSignal(&parBands[i].start);
+		}
+
+		// Draw the first band ourselves
+		ctx = &parBands[GDISP_PARALLEL_THREADS].ctx;
+		memcpy(ctx, g, sizeof(GDisplay));
+		ctx->parent = g;
+		ctx->p.ptr = (void *)buffer;
+		ctx->p.cy -= h * (n-1);
+		parbanddraw(ctx);
+
+		for(i = 0; i < n-1; i++)
+			gfxSemWait(&parDone, gDelayForever);
+		gfxMutexExit(&parMutex);
+		return gTrue;
+	}
+
+	void gdispSetParallelThreads(unsigned threads) {
+		gfxMutexEnter(&parMutex);
+		parUse = threads;
+		gfxMutexExit(&parMutex);
+	}
+#endif
+
+void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
+	MUTEX_ENTER(g);
+	blitarea_clip(g, x, y, cx, cy, srcx, srcy, srccx, buffer);
+	autoflush_stopdone(g);
+	MUTEX_EXIT(g);
+}
+
+#if GDISP_NEED_GRADIENT
+	// gradientspan(g, x, y, cx, cy, dir, from, to, color)
+	// Fill the rows (or columns) from..to-1 of the area with a single color
+	static void gradientspan(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gGradient dir, gCoord from, gCoord to, gColor color) {
+		if (dir == gGradientHorizontal) {
+			g->p.x = x + from;
+			g->p.y = y;
+			g->p.cx = to - from;
+			g->p.cy = cy;
+		} else {
+			g->p.x = x;
+			g->p.y = y + from;
+			g->p.cx = cx;
+			g->p.cy = to - from;
+		}
+		g->p.color = color;
+		TEST_CLIP_AREA(g) {
+			fillarea_clip(g);
+		}
+	}
+
+	void gdispGFillGradientStops(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gGradient dir, const gGradientStop *stops, unsigned cnt) {
+		gCoord		len, i, p0, p1, start;
+		gI32		r, gr, b, dr, dg, db;
+		gColor		c0, c1, c, last;
+		unsigned	k;
+
+		if (!cnt || cx <= 0 || cy <= 0)
+			return;
+		len = dir == gGradientHorizontal ? cx : cy;
+
+		MUTEX_ENTER(g);
+		last = c0 = stops[0].color;
+		start = p0 = 0;
+		for(k = 0; k <= cnt; k++) {
+			// The color stays the same after the last stop
+			if (k < cnt) {
+				p1 = (gCoord)(((gI32)stops[k].pos * (len - 1)) / 255);
+				c1 = stops[k].color;
+			} else {
+				p1 = len;
+				c1 = c0;
+			}
+
+			// Step the color components in 16.16 fixed point from c0 towards c1
+			if (p1 > p0) {
+				r = (gI32)RED_OF(c0) * 65536 + 32768;
+				gr = (gI32)GREEN_OF(c0) * 65536 + 32768;
+				b = (gI32)BLUE_OF(c0) * 65536 + 32768;
+				dr = ((gI32)RED_OF(c1) - (gI32)RED_OF(c0)) * 65536 / (p1 - p0);
+				dg = ((gI32)GREEN_OF(c1) - (gI32)GREEN_OF(c0)) * 65536 / (p1 - p0);
+				db = ((gI32)BLUE_OF(c1) - (gI32)BLUE_OF(c0)) * 65536 / (p1 - p0);
+				for(i = p0; i < p1; i++, r += dr, gr += dg, b += db) {
+					c = RGB2COLOR(r >> 16, gr >> 16, b >> 16);
+					if (c != last) {
+						gradientspan(g, x, y, cx, cy, dir, start, i, last);
+						start = i;
+						last = c;
+					}
+				}
+				p0 = p1;
+			}
+			c0 = c1;
+		}
+		gradientspan(g, x, y, cx, cy, dir, start, len, last);
+		autoflush_stopdone(g);
+		MUTEX_EXIT(g);
+	}
+
+	void gdispGFillGradient(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gGradient dir, gColor from, gColor to) {
+		gGradientStop	stops[2];
+
+		stops[0].pos = 0;
+		stops[0].color = from;
+		stops[1].pos = 255;
+		stops[1].color = to;
+		gdispGFillGradientStops(g, x, y, cx, cy, dir, stops, 2);
+	}
+#endif
+
+#if GDISP_NEED_PATTERN
+	// The width of the expanded pattern. It must be a multiple of 8.
+	#define PATTERN_WIDTH		32
+
+	void gdispGFillPattern(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const gU8 *pattern, gColor fg, gColor bg) {
+		gPixel		buf[8 * PATTERN_WIDTH];
+		gPixel *	pb;
+		gU8			bits;
+		gCoord		r, c, tx, ty;
+
+		if (cx <= 0 || cy <= 0)
+			return;
+
+		// A solid pattern is just a fill
+		for(r = 1; r < 8 && pattern[r] == pattern[0]; r++);
+		if (fg == bg || (r == 8 && (pattern[0] == 0x00 || pattern[0] == 0xFF))) {
+			gdispGFillArea(g, x, y, cx, cy, (fg == bg || pattern[0]) ? fg : bg);
+			return;
+		}
+
+		// Expand 8 rows of the pattern once. As it repeats every 8 pixels the same
+		// buffer can then be blitted across and down the whole area.
+		for(pb = buf, r = 0; r < 8; r++) {
+			bits = pattern[(y + r) & 7];
+			for(c = 0; c < PATTERN_WIDTH; c++)
+				*pb++ = (bits & (0x80 >> ((x + c) & 7))) ? fg : bg;
+		}
+
+		MUTEX_ENTER(g);
+		for(ty = 0; ty < cy; ty += 8) {
+			for(tx = 0; tx < cx; tx += PATTERN_WIDTH)
+				blitarea_clip(g, x + tx, y + ty, cx - tx > PATTERN_WIDTH ? PATTERN_WIDTH : cx - tx, cy - ty > 8 ? 8 : cy - ty, 0, 0, PATTERN_WIDTH, buf);
+		}
+		autoflush_stopdone(g);
+		MUTEX_EXIT(g);
+	}
+
+	#undef PATTERN_WIDTH
+#endif
+
+#if GDISP_NEED_BLIT_ALPHA
+	// The number of pixels blended at a time when the display is read by streaming
+	#define ALPHA_CHUNK		32
+
+	// blendrun(g, x, y, cx, buffer, alpha)
+	// Blend a run of partially transparent pixels of a line over the display.
+	// Note:		This is not clipped
+	static void blendrun(GDisplay *g, gCoord x, gCoord y, gCoord cx, const gPixel *buffer, const gU8 *alpha) {
+		#if GDISP_NEED_DISPLAYLIST
+			// What is on the display is not what the list will be drawn over so use the nearest of opaque or transparent
+			if (g->list) {
+				for(g->p.y = y; cx; cx--, x++, buffer++, alpha++) {
+					if (*alpha >= 128) {
+						g->p.x = x;
+						g->p.color = *buffer;
+						drawpixel(g);
+					}
+				}
+				return;
+			}
+		#endif
+
+		// Best is reading and writing each pixel in place. This is what frame buffers and pixmaps do.
+		#if GDISP_HARDWARE_PIXELREAD
+			#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
+				if (gvmt(g)->get)
+			#endif
+			{
+				for(; cx; cx--, x++, buffer++, alpha++) {
+					g->p.x = x;
+					g->p.y = y;
+					g->p.color = gdispBlendColor(*buffer, gdisp_lld_get_pixel_color(g), *alpha);
+					drawpixel(g);
+				}
+				return;
+			}
+		#endif
+
+		// Next best is reading a chunk of the line back by streaming, blending it and writing it out again
+		#if GDISP_HARDWARE_PIXELREAD != GFXON && GDISP_HARDWARE_STREAM_READ
+			#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
+				if (gvmt(g)->readstart)
+			#endif
+			{
+				gPixel		chunk[ALPHA_CHUNK];
+				gCoord		n, j;
+
+				for(; cx; cx -= n, x += n, buffer += n, alpha += n) {
+					n = cx > ALPHA_CHUNK ? ALPHA_CHUNK : cx;
+					g->p.x = x;
+					g->p.y = y;
+					g->p.cx = n;
+					g->p.cy = 1;
+					#if GDISP_HARDWARE_STREAM_POS && GDISP_HARDWARE_STREAM_WRITE
+						// A pixel write stream left open by drawpixel() or hline() must be closed first
+						if ((g->flags & GDISP_FLG_SCRSTREAM)) {
+							gdisp_lld_write_stop(g);
+							g->flags &= ~GDISP_FLG_SCRSTREAM;
+						}
+					#endif
+					gdisp_lld_read_start(g);
+					for(j = 0; j < n; j++)
+						chunk[j] = gdisp_lld_read_color(g);
+					gdisp_lld_read_stop(g);
+					gdispBlendColors(chunk, buffer, alpha, n);
+					blitarea(g, x, y, n, 1, 0, 0, n, chunk);
+				}
+				return;
+			}
+		#endif
+
+		// Worst is a display that can't be read. Use the nearest of opaque or transparent.
+		#if GDISP_HARDWARE_PIXELREAD != GFXON && GDISP_HARDWARE_STREAM_READ != GFXON
+			for(g->p.y = y; cx; cx--, x++, buffer++, alpha++) {
+				if (*alpha >= 128) {
+					g->p.x = x;
+					g->p.color = *buffer;
+					drawpixel(g);
+				}
+			}
+		#endif
+	}
+
+	// blitalpha(g, x, y, cx, cy, srcx, srcy, srccx, buffer, alpha)
+	// Note:		This is not clipped
+	static void blitalpha(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer, const gU8 *alpha) {
+		const gU8 *		pa;
+		gCoord			r, c, c0;
+
+		for(r = 0; r < cy; r++) {
+			pa = alpha + (srcy + r) * srccx + srcx;
+			for(c = 0; c < cx; ) {
+				// Transparent pixels are skipped
+				if (!pa[c]) {
+					c++;
+					continue;
+				}
+
+				// Opaque pixels are a normal blit
+				if (pa[c] == 255) {
+					for(c0 = c; c < cx && pa[c] == 255; c++);
+					blitarea(g, x + c0, y + r, c - c0, 1, srcx + c0, srcy + r, srccx, buffer);
+					continue;
+				}
+
+				// Everything else is blended with what is already there
+				for(c0 = c; c < cx && pa[c] && pa[c] != 255; c++);
+				blendrun(g, x + c0, y + r, c - c0, buffer + (srcy + r) * srccx + srcx + c0, pa + c0);
+			}
+		}
+	}
+
+	void gdispGBlitAreaAlpha(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer, const gU8 *alpha) {
+		MUTEX_ENTER(g);
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (x < g->clipx0) { cx -= g->clipx0 - x; srcx += g->clipx0 - x; x = g->clipx0; }
+				if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - y; y = g->clipy0; }
+				if (x+cx > g->clipx1)	cx = g->clipx1 - x;
+				if (y+cy > g->clipy1)	cy = g->clipy1 - y;
+				if (srcx+cx > srccx) cx = srccx - srcx;
+				if (cx <= 0 || cy <= 0) {
+					MUTEX_EXIT(g);
+					return;
+				}
+
+				#if GDISP_NEED_CLIP_REGION
+					if (g->useregion) {
+						const gdispRegionRect	*r;
+						gCoord					rx, ry, rcx, rcy;
+						unsigned				i;
+
+						for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+							rx = x < r->x0 ? r->x0 : x;
+							ry = y < r->y0 ? r->y0 : y;
+							rcx = (x+cx > r->x1 ? r->x1 : x+cx) - rx;
+							rcy = (y+cy > r->y1 ? r->y1 : y+cy) - ry;
+							if (rcx > 0 && rcy > 0)
+								blitalpha(g, rx, ry, rcx, rcy, srcx+rx-x, srcy+ry-y, srccx, buffer, alpha);
+						}
+						autoflush(g);
+						MUTEX_EXIT(g);
+						return;
+					}
+				#endif
+			}
+		#endif
+
+		blitalpha(g, x, y, cx, cy, srcx, srcy, srccx, buffer, alpha);
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
+
+	#undef ALPHA_CHUNK
+#endif
+
+#if GDISP_NEED_CLIP || GDISP_NEED_VALIDATION
+	void gdispGSetClip(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		MUTEX_ENTER(g);
+
+		// Best is using hardware clipping
+		#if GDISP_HARDWARE_CLIP
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (gvmt(g)->setclip)
+			#endif
+			{
 				g->p.x = x;
 				g->p.y = y;
 				g->p.cx = cx;
@@ -1269,56 +2080,467 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				g->clipx1 = x+cx;	if (g->clipx1 > g->g.Width) g->clipx1 = g->g.Width;
 				g->clipy1 = y+cy;	if (g->clipy1 > g->g.Height) g->clipy1 = g->g.Height;
 			}
-		#endif
-		MUTEX_EXIT(g);
+		#endif
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_CLIP_REGION
+	void gdispRegionInit(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		if (cx <= 0 || cy <= 0) {
+			rgn->cnt = 0;
+			return;
+		}
+		rgn->cnt = 1;
+		rgn->r[0].x0 = x;
+		rgn->r[0].y0 = y;
+		rgn->r[0].x1 = x + cx;
+		rgn->r[0].y1 = y + cy;
+	}
+
+	gBool gdispRegionSubtract(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gdispRegionRect			out[GDISP_CLIP_REGION_MAX];
+		const gdispRegionRect	*r;
+		unsigned				i, cnt;
+		gCoord					x1, y1, top, bottom;
+
+		#define ADDRECT(rx0, ry0, rx1, ry1)	{							\
+				if (cnt >= GDISP_CLIP_REGION_MAX) return gFalse;		\
+				out[cnt].x0 = (rx0); out[cnt].y0 = (ry0);				\
+				out[cnt].x1 = (rx1); out[cnt].y1 = (ry1);				\
+				cnt++;													\
+			}
+
+		if (cx <= 0 || cy <= 0)
+			return gTrue;
+		x1 = x + cx;
+		y1 = y + cy;
+
+		// Split each overlapped rectangle into up to 4 pieces - the bands above and below
+		//	the removed area and the parts to the left and right of it.
+		for(i = cnt = 0, r = rgn->r; i < rgn->cnt; i++, r++) {
+			if (x >= r->x1 || x1 <= r->x0 || y >= r->y1 || y1 <= r->y0) {
+				ADDRECT(r->x0, r->y0, r->x1, r->y1);
+				continue;
+			}
+			top = r->y0;
+			bottom = r->y1;
+			if (y > top) {
+				ADDRECT(r->x0, top, r->x1, y);
+				top = y;
+			}
+			if (y1 < bottom) {
+				ADDRECT(r->x0, y1, r->x1, bottom);
+				bottom = y1;
+			}
+			if (x > r->x0)
+				ADDRECT(r->x0, top, x, bottom);
+			if (x1 < r->x1)
+				ADDRECT(x1, top, r->x1, bottom);
+		}
+		#undef ADDRECT
+
+		for(i = 0; i < cnt; i++)
+			rgn->r[i] = out[i];
+		rgn->cnt = cnt;
+		return gTrue;
+	}
+
+	void gdispRegionIntersect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gdispRegionRect			*r, *w;
+		unsigned				i;
+
+		for(i = 0, r = w = rgn->r; i < rgn->cnt; i++, r++) {
+			w->x0 = r->x0 < x ? x : r->x0;
+			w->y0 = r->y0 < y ? y : r->y0;
+			w->x1 = r->x1 > x+cx ? x+cx : r->x1;
+			w->y1 = r->y1 > y+cy ? y+cy : r->y1;
+			if (w->x1 > w->x0 && w->y1 > w->y0)
+				w++;
+		}
+		rgn->cnt = w - rgn->r;
+	}
+
+	gBool gdispGSetClipRegion(GDisplay *g, const gdispRegion *rgn) {
+		// Regions can only be applied with software clipping
+		#if GDISP_HARDWARE_CLIP == GFXON
+			(void) g;
+			return !rgn;
+		#else
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (gvmt(g)->setclip)
+					return !rgn;
+			#endif
+
+			MUTEX_ENTER(g);
+			if (rgn) {
+				g->clipregion = *rgn;
+				g->useregion = gTrue;
+			} else
+				g->useregion = gFalse;
+			MUTEX_EXIT(g);
+			return gTrue;
+		#endif
+	}
+#endif
+
+#if GDISP_NEED_PIXELCOUNT
+	gU32 gdispGGetPixelCount(GDisplay *g) {
+		return g->pixelcount;
+	}
+
+	void gdispGResetPixelCount(GDisplay *g) {
+		g->pixelcount = 0;
+	}
+#endif
+
+#if GDISP_NEED_DISPLAYLIST
+	void gdispListInit(gdispList *pl) {
+		pl->ops = 0;
+		pl->size = pl->used = pl->last = 0;
+		pl->failed = gFalse;
+	}
+
+	void gdispListClear(gdispList *pl) {
+		if (pl->ops)
+			gfxFree(pl->ops);
+		gdispListInit(pl);
+	}
+
+	void gdispGListStart(GDisplay *g, gdispList *pl) {
+		MUTEX_ENTER(g);
+		g->list = pl;
+		MUTEX_EXIT(g);
+	}
+
+	gBool gdispGListStop(GDisplay *g) {
+		gBool	ok;
+
+		MUTEX_ENTER(g);
+		ok = !g->list || !g->list->failed;
+		g->list = 0;
+		MUTEX_EXIT(g);
+		return ok;
+	}
+
+	void gdispListOptimize(gdispList *pl) {
+		listop *	po;
+		listop *	pn;
+		listop *	pd;
+		gMemSize	pos, npos, sz;
+
+		// Drop anything a later fill or blit draws completely over
+		for(pos = 0; pos < pl->used; pos += LIST_OPSIZE(po)) {
+			po = LIST_OP(pl, pos);
+			for(npos = pos + LIST_OPSIZE(po); npos < pl->used; npos += LIST_OPSIZE(pn)) {
+				pn = LIST_OP(pl, npos);
+				if (!(pn->op & LISTOP_DROPPED) && pn->x <= po->x && pn->y <= po->y
+						&& pn->x + pn->cx >= po->x + po->cx && pn->y + pn->cy >= po->y + po->cy) {
+					po->op |= LISTOP_DROPPED;
+					break;
+				}
+			}
+		}
+
+		// Close up the gaps joining fills that are now next to each other
+		for(pos = npos = 0; pos < pl->used; pos += sz) {
+			po = LIST_OP(pl, pos);
+			sz = LIST_OPSIZE(po);
+			if ((po->op & LISTOP_DROPPED))
+				continue;
+			if (npos) {
+				pd = LIST_OP(pl, pl->last);
+				if (po->op == LISTOP_FILL && listjoin(pd, po->x, po->y, po->cx, po->cy, po->color))
+					continue;
+			}
+			pl->last = npos;
+			pd = LIST_OP(pl, npos);
+			if (pd != po)
+				memmove(pd, po, sz);
+			npos += sz;
+		}
+		pl->used = npos;
+		if (!npos)
+			pl->last = 0;
+	}
+
+	void gdispGListDraw(GDisplay *g, const gdispList *pl, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		const listop *	po;
+		gMemSize		pos;
+		gCoord			x0, y0, x1, y1;
+
+		MUTEX_ENTER(g);
+		for(pos = 0; pos < pl->used; pos += LIST_OPSIZE(po)) {
+			po = LIST_OP(pl, pos);
+
+			// Only what is within the area
+			x0 = po->x < x ? x : po->x;
+			y0 = po->y < y ? y : po->y;
+			x1 = po->x + po->cx > x + cx ? x + cx : po->x + po->cx;
+			y1 = po->y + po->cy > y + cy ? y + cy : po->y + po->cy;
+			if (x0 >= x1 || y0 >= y1)
+				continue;
+
+			if (po->op == LISTOP_BLIT) {
+				blitarea_clip(g, x0, y0, x1 - x0, y1 - y0, x0 - po->x, y0 - po->y, po->cx, (const gPixel *)(po+1));
+				continue;
+			}
+			g->p.x = x0;
+			g->p.y = y0;
+			g->p.cx = x1 - x0;
+			g->p.cy = y1 - y0;
+			g->p.color = po->color;
+			TEST_CLIP_AREA(g) {
+				fillarea_clip(g);
+			}
+		}
+		autoflush_stopdone(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_LIST_TILES
+	void gdispGListDrawTiled(GDisplay *g, const gdispList *pl, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		const listop *	po;
+		const gPixel *	ps;
+		gMemSize *		bin;
+		gPixel *		tile;
+		gPixel *		pd;
+		gU8 *			cover;
+		gU8 *			pc;
+		gMemSize		pos;
+		unsigned		nops, nbin, i;
+		unsigned		covered;
+		gCoord			tx, ty, tcx, tcy;
+		gCoord			x0, y0, x1, y1, r, c;
+
+		for(nops = 0, pos = 0; pos < pl->used; pos += LIST_OPSIZE(po), nops++)
+			po = LIST_OP(pl, pos);
+		if (!nops || cx <= 0 || cy <= 0)
+			return;
+
+		// The bin of operations for a row of tiles, the tile and which of its pixels have been drawn
+		if (!(bin = gfxAlloc(nops * sizeof(gMemSize) + GDISP_LIST_TILE_WIDTH * GDISP_LIST_TILE_HEIGHT * (sizeof(gPixel) + 1)))) {
+			gdispGListDraw(g, pl, x, y, cx, cy);
+			return;
+		}
+		tile = (gPixel *)(bin + nops);
+		cover = (gU8 *)(tile + GDISP_LIST_TILE_WIDTH * GDISP_LIST_TILE_HEIGHT);
+
+		MUTEX_ENTER(g);
+		for(ty = y; ty < y + cy; ty += GDISP_LIST_TILE_HEIGHT) {
+			tcy = y + cy - ty > GDISP_LIST_TILE_HEIGHT ? GDISP_LIST_TILE_HEIGHT : y + cy - ty;
+
+			// Collect the operations for this row of tiles
+			for(nbin = 0, pos = 0; pos < pl->used; pos += LIST_OPSIZE(po)) {
+				po = LIST_OP(pl, pos);
+				if (po->y < ty + tcy && po->y + po->cy > ty && po->x < x + cx && po->x + po->cx > x)
+					bin[nbin++] = pos;
+			}
+			if (!nbin)
+				continue;
+
+			for(tx = x; tx < x + cx; tx += GDISP_LIST_TILE_WIDTH) {
+				tcx = x + cx - tx > GDISP_LIST_TILE_WIDTH ? GDISP_LIST_TILE_WIDTH : x + cx - tx;
+
+				// Build the tile
+				memset(cover, 0, tcx * tcy);
+				covered = 0;
+				for(i = 0; i < nbin; i++) {
+					po = LIST_OP(pl, bin[i]);
+					x0 = po->x < tx ? tx : po->x;
+					y0 = po->y < ty ? ty : po->y;
+					x1 = po->x + po->cx > tx + tcx ? tx + tcx : po->x + po->cx;
+					y1 = po->y + po->cy > ty + tcy ? ty + tcy : po->y + po->cy;
+					if (x0 >= x1 || y0 >= y1)
+						continue;
+					for(r = y0; r < y1; r++) {
+						pd = tile + (r - ty) * tcx + (x0 - tx);
+						pc = cover + (r - ty) * tcx + (x0 - tx);
+						if (po->op == LISTOP_BLIT) {
+							ps = (const gPixel *)(po+1) + (r - po->y) * po->cx + (x0 - po->x);
+							for(c = x0; c < x1; c++)
+								*pd++ = *ps++;
+						} else {
+							for(c = x0; c < x1; c++)
+								*pd++ = po->color;
+						}
+						for(c = x0; c < x1; c++, pc++) {
+							if (!*pc) {
+								*pc = 1;
+								covered++;
+							}
+						}
+					}
+				}
+
+				// Send it
+				if (covered == (unsigned)(tcx * tcy))
+					blitarea_clip(g, tx, ty, tcx, tcy, 0, 0, tcx, tile);
+				else if (covered) {
+					for(r = 0, pc = cover; r < tcy; r++) {
+						for(c = 0; c < tcx; ) {
+							if (!pc[c]) {
+								c++;
+								continue;
+							}
+							for(x0 = c; c < tcx && pc[c]; c++);
+							blitarea_clip(g, tx + x0, ty + r, c - x0, 1, x0, r, tcx, tile);
+						}
+						pc += tcx;
+					}
+				}
+			}
+		}
+		autoflush_stopdone(g);
+		MUTEX_EXIT(g);
+		gfxFree(bin);
+	}
+#endif
+
+#if GDISP_NEED_CIRCLE || GDISP_NEED_ELLIPSE || GDISP_NEED_ARC || GDISP_NEED_ARCSECTORS || GDISP_NEED_COMPLEX_POLYGON
+	// The circle, ellipse, rounded box and complex polygon primitives generate their pixels as spans which are
+	// joined into runs before being drawn. Rows with the same span (and adjacent pixels on the
+	// same row or column) become a single area fill, and the clipping is decided once for the
+	// whole shape rather than for every span.
+	typedef struct spanrun {
+		gCoord	x, y, x1, y1;		// The run (inclusive). Empty when y1 < y.
+	} spanrun;
+
+	#define SPANS_NONE		0		// The shape is not visible
+	#define SPANS_FAST		1		// The shape is entirely visible
+	#define SPANS_CLIP		2		// Each run must be clipped
+
+	// Parameters:	The bounding box of the shape (inclusive)
+	// Returns:		How the runs of the shape must be drawn
+	static unsigned spanmode(GDisplay *g, gCoord x, gCoord y, gCoord x1, gCoord y1) {
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (x1 < g->clipx0 || x >= g->clipx1 || y1 < g->clipy0 || y >= g->clipy1)
+					return SPANS_NONE;
+				if (x < g->clipx0 || x1 >= g->clipx1 || y < g->clipy0 || y1 >= g->clipy1)
+					return SPANS_CLIP;
+				#if GDISP_NEED_CLIP_REGION
+					if (g->useregion && !inregion(g, x, y, x1-x+1, y1-y+1))
+						return SPANS_CLIP;
+				#endif
+			}
+		#else
+			(void) g; (void) x; (void) y; (void) x1; (void) y1;
+		#endif
+		return SPANS_FAST;
+	}
+
+	// Parameters:	A run and the drawing mode (color must already be set)
+	// Alters:		x,y x1,y1 cx,cy
+	// Draws the run and leaves it empty
+	static void spanflush(GDisplay *g, spanrun *r, unsigned mode) {
+		if (r->y1 < r->y)
+			return;
+		g->p.x = r->x; g->p.y = r->y;
+		if (r->y == r->y1) {
+			g->p.x1 = r->x1;
+			if (mode == SPANS_FAST)
+				hline(g);
+			else
+				hline_clip(g);
+		} else if (r->x == r->x1) {
+			g->p.y1 = r->y1;
+			if (mode == SPANS_FAST)
+				vline(g);
+			else
+				vline_clip(g);
+		} else {
+			g->p.cx = r->x1 - r->x + 1;
+			g->p.cy = r->y1 - r->y + 1;
+			if (mode == SPANS_FAST) {
+				fillarea(g);
+			} else {
+				TEST_CLIP_AREA(g) {
+					fillarea_clip(g);
+				}
+			}
+		}
+		r->y1 = r->y - 1;
+	}
+
+	// Parameters:	A run, the drawing mode and the area to add to the run (inclusive)
+	// Alters:		x,y x1,y1 cx,cy
+	// Extends the run if the area adjoins it with the same width or height, otherwise the
+	//	run is drawn and restarted with the new area.
+	static void spanadd(GDisplay *g, spanrun *r, unsigned mode, gCoord x, gCoord y, gCoord x1, gCoord y1) {
+		if (r->y1 >= r->y) {
+			if (x == r->x && x1 == r->x1) {
+				if (y == r->y1 + 1)		{ r->y1 = y1; return; }
+				if (y1 == r->y - 1)		{ r->y = y; return; }
+			}
+			if (y == r->y && y1 == r->y1) {
+				if (x == r->x1 + 1)		{ r->x1 = x1; return; }
+				if (x1 == r->x - 1)		{ r->x = x; return; }
+			}
+			spanflush(g, r, mode);
+		}
+		r->x = x; r->y = y; r->x1 = x1; r->y1 = y1;
+	}
+
+	// Parameters:	An array of runs
+	// Alters:		nothing
+	static void spaninit(spanrun *r, unsigned cnt) {
+		for(; cnt; cnt--, r++) {
+			r->y = 0;
+			r->y1 = -1;
+		}
+	}
+
+	// Parameters:	An array of runs and the drawing mode (color must already be set)
+	// Alters:		x,y x1,y1 cx,cy
+	static void spandone(GDisplay *g, spanrun *r, unsigned cnt, unsigned mode) {
+		for(; cnt; cnt--, r++)
+			spanflush(g, r, mode);
 	}
 #endif
 
-#if GDISP_NEED_CIRCLE
-	void gdispGDrawCircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+#if GDISP_NEED_CIRCLE || GDISP_NEED_ARC || GDISP_NEED_ARCSECTORS
+	// Parameters:	Four runs, the drawing mode, the centre area (inclusive) and the radius
+	// Alters:		x,y x1,y1 cx,cy
+	// Adds the rows of a filled circle that has been stretched to cover the centre area.
+	// Uses Bresenham's circle algorithm generating each row exactly once.
+	static void circlespans(GDisplay *g, spanrun *r, unsigned mode, gCoord x, gCoord y, gCoord x1, gCoord y1, gCoord radius) {
 		gCoord a, b, P;
 
-		MUTEX_ENTER(g);
-
 		// Calculate intermediates
 		a = 1;
 		b = radius;
 		P = 4 - radius;
-		g->p.color = color;
 
-		// Away we go using Bresenham's circle algorithm
-		// Optimized to prevent double drawing
-		g->p.x = x; g->p.y = y + b; drawpixel_clip(g);
-		g->p.x = x; g->p.y = y - b; drawpixel_clip(g);
-		g->p.x = x + b; g->p.y = y; drawpixel_clip(g);
-		g->p.x = x - b; g->p.y = y; drawpixel_clip(g);
+		// The centre rows go in the lower run so that they can join with the rows just below them
+		spanadd(g, &r[0], mode, x-b, y, x1+b, y1);
+		spanadd(g, &r[2], mode, x, y1+b, x1, y1+b);
+		spanadd(g, &r[3], mode, x, y-b, x1, y-b);
 		do {
-			g->p.x = x + a; g->p.y = y + b; drawpixel_clip(g);
-			g->p.x = x + a; g->p.y = y - b; drawpixel_clip(g);
-			g->p.x = x + b; g->p.y = y + a; drawpixel_clip(g);
-			g->p.x = x - b; g->p.y = y + a; drawpixel_clip(g);
-			g->p.x = x - a; g->p.y = y + b; drawpixel_clip(g);
-			g->p.x = x - a; g->p.y = y - b; drawpixel_clip(g);
-			g->p.x = x + b; g->p.y = y - a; drawpixel_clip(g);
-			g->p.x = x - b; g->p.y = y - a; drawpixel_clip(g);
-			if (P < 0)
+			spanadd(g, &r[0], mode, x-b, y1+a, x1+b, y1+a);
+			spanadd(g, &r[1], mode, x-b, y-a, x1+b, y-a);
+			if (P < 0) {
 				P += 3 + 2*a++;
-			else
+			} else {
+				spanadd(g, &r[2], mode, x-a, y1+b, x1+a, y1+b);
+				spanadd(g, &r[3], mode, x-a, y-b, x1+a, y-b);
 				P += 5 + 2*(a++ - b--);
+			}
 		} while(a < b);
-		g->p.x = x + a; g->p.y = y + b; drawpixel_clip(g);
-		g->p.x = x + a; g->p.y = y - b; drawpixel_clip(g);
-		g->p.x = x - a; g->p.y = y + b; drawpixel_clip(g);
-		g->p.x = x - a; g->p.y = y - b; drawpixel_clip(g);
-
-		autoflush(g);
-		MUTEX_EXIT(g);
+		spanadd(g, &r[0], mode, x-b, y1+a, x1+b, y1+a);
+		spanadd(g, &r[1], mode, x-b, y-a, x1+b, y-a);
 	}
 #endif
 
 #if GDISP_NEED_CIRCLE
-	void gdispGFillCircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
-		gCoord a, b, P;
+	void gdispGDrawCircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+		gCoord		a, b, P;
+		unsigned	mode;
+		spanrun		r[8];
 
 		MUTEX_ENTER(g);
 
@@ -1327,25 +2549,59 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		b = radius;
 		P = 4 - radius;
 		g->p.color = color;
+		// The algorithm strays outside the bounding box for a radius below 2 so those are always clipped
+		mode = radius > 1 ? spanmode(g, x-radius, y-radius, x+radius, y+radius) : SPANS_CLIP;
+		spaninit(r, 8);
 
 		// Away we go using Bresenham's circle algorithm
-		// This is optimized to prevent overdrawing by drawing a line only when a variable is about to change value
-		g->p.y = y; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
-		g->p.y = y+b; g->p.x = x; drawpixel_clip(g);
-		g->p.y = y-b; g->p.x = x; drawpixel_clip(g);
-		do {
-			g->p.y = y+a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
-			g->p.y = y-a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
-			if (P < 0) {
-				P += 3 + 2*a++;
-			} else {
-				g->p.y = y+b; g->p.x = x-a; g->p.x1 = x+a; hline_clip(g);
-				g->p.y = y-b; g->p.x = x-a; g->p.x1 = x+a; hline_clip(g);
-				P += 5 + 2*(a++ - b--);
-			}
-		} while(a < b);
-		g->p.y = y+a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
-		g->p.y = y-a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
+		// Optimized to prevent double drawing. Each octant has its own run so that
+		//	consecutive pixels join into horizontal or vertical lines.
+		if (mode != SPANS_NONE) {
+			spanadd(g, &r[0], mode, x, y + b, x, y + b);
+			spanadd(g, &r[1], mode, x, y - b, x, y - b);
+			spanadd(g, &r[2], mode, x + b, y, x + b, y);
+			spanadd(g, &r[3], mode, x - b, y, x - b, y);
+			do {
+				spanadd(g, &r[0], mode, x + a, y + b, x + a, y + b);
+				spanadd(g, &r[1], mode, x + a, y - b, x + a, y - b);
+				spanadd(g, &r[2], mode, x + b, y + a, x + b, y + a);
+				spanadd(g, &r[3], mode, x - b, y + a, x - b, y + a);
+				spanadd(g, &r[4], mode, x - a, y + b, x - a, y + b);
+				spanadd(g, &r[5], mode, x - a, y - b, x - a, y - b);
+				spanadd(g, &r[6], mode, x + b, y - a, x + b, y - a);
+				spanadd(g, &r[7], mode, x - b, y - a, x - b, y - a);
+				if (P < 0)
+					P += 3 + 2*a++;
+				else
+					P += 5 + 2*(a++ - b--);
+			} while(a < b);
+			spanadd(g, &r[0], mode, x + a, y + b, x + a, y + b);
+			spanadd(g, &r[1], mode, x + a, y - b, x + a, y - b);
+			spanadd(g, &r[4], mode, x - a, y + b, x - a, y + b);
+			spanadd(g, &r[5], mode, x - a, y - b, x - a, y - b);
+			spandone(g, r, 8, mode);
+		}
+
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
+#endif
+
+#if GDISP_NEED_CIRCLE
+	void gdispGFillCircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+		unsigned	mode;
+		spanrun		r[4];
+
+		MUTEX_ENTER(g);
+
+		g->p.color = color;
+		// The algorithm strays outside the bounding box for a radius below 2 so those are always clipped
+		mode = radius > 1 ? spanmode(g, x-radius, y-radius, x+radius, y+radius) : SPANS_CLIP;
+		if (mode != SPANS_NONE) {
+			spaninit(r, 4);
+			circlespans(g, r, mode, x, y, x, y, radius);
+			spandone(g, r, 4, mode);
+		}
 
 		autoflush(g);
 		MUTEX_EXIT(g);
@@ -1434,6 +2690,8 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gCoord	dx, dy;
 		gI32	a2, b2;
 		gI32	err, e2;
+		unsigned	mode;
+		spanrun		r[4];
 
 		MUTEX_ENTER(g);
 
@@ -1444,24 +2702,30 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		b2 = b*b;
 		err = b2-(2*b-1)*a2;
 		g->p.color = color;
+		mode = a >= 0 && b >= 0 ? spanmode(g, x-a, y-b, x+a, y+b) : SPANS_CLIP;
 
 		// Away we go using Bresenham's ellipse algorithm
-		do {
-			g->p.x = x + dx; g->p.y = y + dy; drawpixel_clip(g);
-			g->p.x = x - dx; g->p.y = y + dy; drawpixel_clip(g);
-			g->p.x = x - dx; g->p.y = y - dy; drawpixel_clip(g);
-			g->p.x = x + dx; g->p.y = y - dy; drawpixel_clip(g);
-
-			e2 = 2*err;
-			if(e2 <  (2*dx+1)*b2) {
-				dx++;
-				err += (2*dx+1)*b2;
-			}
-			if(e2 > -(2*dy-1)*a2) {
-				dy--;
-				err -= (2*dy-1)*a2;
-			}
-		} while(dy >= 0);
+		// Each quadrant has its own run so that consecutive pixels join into horizontal or vertical lines.
+		if (mode != SPANS_NONE) {
+			spaninit(r, 4);
+			do {
+				spanadd(g, &r[0], mode, x + dx, y + dy, x + dx, y + dy);
+				spanadd(g, &r[1], mode, x - dx, y + dy, x - dx, y + dy);
+				spanadd(g, &r[2], mode, x - dx, y - dy, x - dx, y - dy);
+				spanadd(g, &r[3], mode, x + dx, y - dy, x + dx, y - dy);
+
+				e2 = 2*err;
+				if(e2 <  (2*dx+1)*b2) {
+					dx++;
+					err += (2*dx+1)*b2;
+				}
+				if(e2 > -(2*dy-1)*a2) {
+					dy--;
+					err -= (2*dy-1)*a2;
+				}
+			} while(dy >= 0);
+			spandone(g, r, 4, mode);
+		}
 
 		autoflush(g);
 		MUTEX_EXIT(g);
@@ -1473,6 +2737,8 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		gCoord	dx, dy;
 		gI32	a2, b2;
 		gI32	err, e2;
+		unsigned	mode;
+		spanrun		r[2];
 
 		MUTEX_ENTER(g);
 
@@ -1483,22 +2749,29 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 		b2 = b*b;
 		err = b2-(2*b-1)*a2;
 		g->p.color = color;
+		mode = a >= 0 && b >= 0 ? spanmode(g, x-a, y-b, x+a, y+b) : SPANS_CLIP;
 
 		// Away we go using Bresenham's ellipse algorithm
-		// This is optimized to prevent overdrawing by drawing a line only when a y is about to change value
-		do {
-			e2 = 2*err;
-			if(e2 <  (2*dx+1)*b2) {
-				dx++;
-				err += (2*dx+1)*b2;
-			}
-			if(e2 > -(2*dy-1)*a2) {
-				g->p.y = y + dy; g->p.x = x - dx; g->p.x1 = x + dx; hline_clip(g);
-				if (y) { g->p.y = y - dy; g->p.x = x - dx; g->p.x1 = x + dx; hline_clip(g); }
-				dy--;
-				err -= (2*dy-1)*a2;
-			}
-		} while(dy >= 0);
+		// This is optimized to prevent overdrawing by drawing a line only when a y is about to change value.
+		// The lower and upper halves each have a run so that rows of the same width join into one fill.
+		if (mode != SPANS_NONE) {
+			spaninit(r, 2);
+			do {
+				e2 = 2*err;
+				if(e2 <  (2*dx+1)*b2) {
+					dx++;
+					err += (2*dx+1)*b2;
+				}
+				if(e2 > -(2*dy-1)*a2) {
+					spanadd(g, &r[0], mode, x - dx, y + dy, x + dx, y + dy);
+					if (dy)
+						spanadd(g, &r[1], mode, x - dx, y - dy, x + dx, y - dy);
+					dy--;
+					err -= (2*dy-1)*a2;
+				}
+			} while(dy >= 0);
+			spandone(g, r, 2, mode);
+		}
 
 		autoflush(g);
 		MUTEX_EXIT(g);
@@ -2564,27 +3837,28 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 
 #if GDISP_NEED_ARC || GDISP_NEED_ARCSECTORS
 	void gdispGFillRoundedBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord radius, gColor color) {
-		gCoord radius2;
+		unsigned	mode;
+		spanrun		r[4];
 
-		radius2 = radius*2;
-		if (radius2 > cx || radius2 > cy) {
+		if (radius < 2 || 2*radius > cx || 2*radius > cy) {
 			gdispGFillArea(g, x, y, cx, cy, color);
 			return;
 		}
-		#if GDISP_NEED_ARCSECTORS
-			gdispGFillArcSectors(g, x+radius, y+radius, radius, 0x0C, color);
-			gdispGFillArcSectors(g, x+cx-1-radius, y+radius, radius, 0x03, color);
-			gdispGFillArcSectors(g, x+cx-1-radius, y+cy-1-radius, radius, 0xC0, color);
-			gdispGFillArcSectors(g, x+radius, y+cy-1-radius, radius, 0x30, color);
-		#else
-			gdispGFillArc(g, x+radius, y+radius, radius, 90, 180, color);
-			gdispGFillArc(g, x+cx-1-radius, y+radius, radius, 0, 90, color);
-			gdispGFillArc(g, x+cx-1-radius, y+cy-1-radius, radius, 270, 360, color);
-			gdispGFillArc(g, x+radius, y+cy-1-radius, radius, 180, 270, color);
-		#endif
-		gdispGFillArea(g, x+radius+1, y, cx-radius2, radius, color);
-		gdispGFillArea(g, x+radius+1, y+cy-radius, cx-radius2, radius, color);
-		gdispGFillArea(g, x, y+radius, cx, cy-radius2, color);
+
+		MUTEX_ENTER(g);
+
+		// The corners are the quarters of a circle stretched to the size of the box.
+		//	Each row is a single span across the box.
+		g->p.color = color;
+		mode = spanmode(g, x, y, x+cx-1, y+cy-1);
+		if (mode != SPANS_NONE) {
+			spaninit(r, 4);
+			circlespans(g, r, mode, x+radius, y+radius, x+cx-1-radius, y+cy-1-radius, radius);
+			spandone(g, r, 4, mode);
+		}
+
+		autoflush(g);
+		MUTEX_EXIT(g);
 	}
 #endif
 
@@ -2594,6 +3868,13 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 
 		/* Always synchronous as it must return a value */
 		MUTEX_ENTER(g);
+		#if GDISP_NEED_DISPLAYLIST
+			// Return what has been recorded for the pixel. Otherwise it is what is on the display.
+			if (g->list && listpixel(g->list, x, y, &c)) {
+				MUTEX_EXIT(g);
+				return c;
+			}
+		#endif
 		#if GDISP_HARDWARE_PIXELREAD
 			#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
 				if (gvmt(g)->get)
@@ -2636,26 +3917,162 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 #endif
 
 #if GDISP_NEED_SCROLL
-	void gdispGVerticalScroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, int lines, gColor bgcolor) {
-		gCoord		abslines;
-		#if GDISP_HARDWARE_SCROLL != GFXON
-			gCoord 	fy, dy, ix, fx, i, j;
-		#endif
+	#if GDISP_LINEBUF_SIZE != 0 && (GDISP_HARDWARE_STREAM_READ || GDISP_HARDWARE_PIXELREAD)
+		#define NEED_LINECOPY	GFXON
+
+		// readline(g, x, y, cx) - Read up to GDISP_LINEBUF_SIZE pixels of a line into the line buffer
+		// Returns gFalse if the display can't read pixels
+		// Note:		This is not clipped
+		static gBool readline(GDisplay *g, gCoord x, gCoord y, gCoord cx) {
+			gCoord	j;
+
+			// Best line read is hardware streaming
+			#if GDISP_HARDWARE_STREAM_READ
+				#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
+					if (gvmt(g)->readstart)
+				#endif
+				{
+					g->p.x = x;
+					g->p.y = y;
+					g->p.cx = cx;
+					g->p.cy = 1;
+					gdisp_lld_read_start(g);
+					for(j=0; j < cx; j++)
+						g->linebuf[j] = gdisp_lld_read_color(g);
+					gdisp_lld_read_stop(g);
+					return gTrue;
+				}
+			#endif
 
-		if (!lines) return;
+			// Next best line read is single pixel reads
+			#if GDISP_HARDWARE_STREAM_READ != GFXON && GDISP_HARDWARE_PIXELREAD
+				#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
+					if (gvmt(g)->get)
+				#endif
+				{
+					for(j=0; j < cx; j++) {
+						g->p.x = x+j;
+						g->p.y = y;
+						g->linebuf[j] = gdisp_lld_get_pixel_color(g);
+					}
+					return gTrue;
+				}
+			#endif
 
-		MUTEX_ENTER(g);
-		#if NEED_CLIPPING
-			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
-				if (!gvmt(g)->setclip)
+			// Worst is "not possible"
+			#if GDISP_HARDWARE_STREAM_READ != GFXON && GDISP_HARDWARE_PIXELREAD != GFXON
+				return gFalse;
 			#endif
-			{
-				if (x < g->clipx0) { cx -= g->clipx0 - x; x = g->clipx0; }
-				if (y < g->clipy0) { cy -= g->clipy0 - y; y = g->clipy0; }
-				if (cx <= 0 || cy <= 0 || x >= g->clipx1 || y >= g->clipy1) { MUTEX_EXIT(g); return; }
-				if (x+cx > g->clipx1)	cx = g->clipx1 - x;
-				if (y+cy > g->clipy1)	cy = g->clipy1 - y;
-			}
+		}
+
+		// writeline(g, x, y, cx) - Write the first cx pixels of the line buffer to the display
+		// Note:		This is not clipped
+		static void writeline(GDisplay *g, gCoord x, gCoord y, gCoord cx) {
+			#if GDISP_HARDWARE_BITFILLS != GFXON
+				gCoord	j;
+			#endif
+
+			// Best line write is hardware bitfills
+			#if GDISP_HARDWARE_BITFILLS
+				#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+					if (gvmt(g)->blit)
+				#endif
+				{
+					g->p.x = x;
+					g->p.y = y;
+					g->p.cx = cx;
+					g->p.cy = 1;
+					g->p.x1 = 0;
+					g->p.y1 = 0;
+					g->p.x2 = cx;
+					g->p.ptr = (void *)g->linebuf;
+					gdisp_lld_blit_area(g);
+				}
+				#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
+					else
+				#endif
+			#endif
+
+			// Next best line write is hardware streaming
+			#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE
+				#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
+					if (gvmt(g)->writestart)
+				#endif
+				{
+					g->p.x = x;
+					g->p.y = y;
+					g->p.cx = cx;
+					g->p.cy = 1;
+					gdisp_lld_write_start(g);
+					#if GDISP_HARDWARE_STREAM_POS
+						gdisp_lld_write_pos(g);
+					#endif
+					for(j = 0; j < cx; j++) {
+						g->p.color = g->linebuf[j];
+						gdisp_lld_write_color(g);
+					}
+					gdisp_lld_write_stop(g);
+				}
+				#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
+					else
+				#endif
+			#endif
+
+			// Next best line write is drawing pixels in combination with filling
+			#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS && GDISP_HARDWARE_DRAWPIXEL
+				// We don't need to test for auto-detect on drawpixel as we know we have it because we don't have streaming.
+				#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
+					if (gvmt(g)->fill)
+				#endif
+				{
+					g->p.y = y;
+					g->p.cy = 1;
+					g->p.x = x;
+					g->p.cx = 1;
+					for(j = 0; j < cx; ) {
+						g->p.color = g->linebuf[j];
+						if (j + g->p.cx < cx && g->linebuf[j] == g->linebuf[j + g->p.cx])
+							g->p.cx++;
+						else if (g->p.cx == 1) {
+							gdisp_lld_draw_pixel(g);
+							j++;
+							g->p.x++;
+						} else {
+							gdisp_lld_fill_area(g);
+							j += g->p.cx;
+							g->p.x += g->p.cx;
+							g->p.cx = 1;
+						}
+					}
+				}
+				#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
+					else
+				#endif
+			#endif
+
+			// Worst line write is drawing pixels
+			#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS != GFXON && GDISP_HARDWARE_DRAWPIXEL
+				// The following test is unneeded because we are guaranteed to have draw pixel if we don't have streaming
+				//#if GDISP_HARDWARE_DRAWPIXEL == HARDWARE_AUTODETECT
+				//	if (gvmt(g)->pixel)
+				//#endif
+				{
+					g->p.y = y;
+					for(g->p.x = x, j = 0; j < cx; g->p.x++, j++) {
+						g->p.color = g->linebuf[j];
+						gdisp_lld_draw_pixel(g);
+					}
+				}
+			#endif
+		}
+	#endif
+
+	// vscroll(g, x, y, cx, cy, lines, bgcolor)
+	// Note:		This is not clipped
+	static void vscroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, int lines, gColor bgcolor) {
+		gCoord		abslines;
+		#if GDISP_HARDWARE_SCROLL != GFXON
+			gCoord 	fy, dy, ix, fx, i;
 		#endif
 
 		abslines = lines < 0 ? -lines : lines;
@@ -2663,6 +4080,8 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 			abslines = cy;
 			cy = 0;
 		} else {
+			PIXELCOUNT(g, (gU32)cx * (cy - abslines));
+
 			// Best is hardware scroll
 			#if GDISP_HARDWARE_SCROLL
 				#if GDISP_HARDWARE_SCROLL == HARDWARE_AUTODETECT
@@ -2683,6 +4102,8 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				#endif
 			#elif GDISP_LINEBUF_SIZE == 0
 				#error "GDISP: GDISP_NEED_SCROLL is set but there is no hardware support and GDISP_LINEBUF_SIZE is zero."
+			#elif !GDISP_HARDWARE_STREAM_READ && !GDISP_HARDWARE_PIXELREAD
+				#error "GDISP: GDISP_NEED_SCROLL is set but there is no hardware support for scrolling or reading pixels."
 			#endif
 
 			// Scroll Emulation
@@ -2690,7 +4111,7 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				{
 					cy -= abslines;
 					if (lines < 0) {
-						fy = y+cy-1;
+						fy = y+cy+abslines-1;
 						dy = -1;
 					} else {
 						fy = y;
@@ -2707,163 +4128,202 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 							if (fx > GDISP_LINEBUF_SIZE)
 								fx = GDISP_LINEBUF_SIZE;
 
-							// Read one line of data from the screen
-
-							// Best line read is hardware streaming
-							#if GDISP_HARDWARE_STREAM_READ
-								#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
-									if (gvmt(g)->readstart)
-								#endif
-								{
-									g->p.x = x+ix;
-									g->p.y = fy+lines;
-									g->p.cx = fx;
-									g->p.cy = 1;
-									gdisp_lld_read_start(g);
-									for(j=0; j < fx; j++)
-										g->linebuf[j] = gdisp_lld_read_color(g);
-									gdisp_lld_read_stop(g);
-								}
-								#if GDISP_HARDWARE_STREAM_READ == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Next best line read is single pixel reads
-							#if GDISP_HARDWARE_STREAM_READ != GFXON && GDISP_HARDWARE_PIXELREAD
-								#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
-									if (gvmt(g)->get)
-								#endif
-								{
-									for(j=0; j < fx; j++) {
-										g->p.x = x+ix+j;
-										g->p.y = fy+lines;
-										g->linebuf[j] = gdisp_lld_get_pixel_color(g);
-									}
-								}
-								#if GDISP_HARDWARE_PIXELREAD == HARDWARE_AUTODETECT
-									else {
-										// Worst is "not possible"
-										MUTEX_EXIT(g);
-										return;
-									}
-								#endif
-							#endif
-
-							// Worst is "not possible"
-							#if !GDISP_HARDWARE_STREAM_READ && !GDISP_HARDWARE_PIXELREAD
-								#error "GDISP: GDISP_NEED_SCROLL is set but there is no hardware support for scrolling or reading pixels."
-							#endif
-
-							// Write that line to the new location
-
-							// Best line write is hardware bitfills
-							#if GDISP_HARDWARE_BITFILLS
-								#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
-									if (gvmt(g)->blit)
-								#endif
-								{
-									g->p.x = x+ix;
-									g->p.y = fy;
-									g->p.cx = fx;
-									g->p.cy = 1;
-									g->p.x1 = 0;
-									g->p.y1 = 0;
-									g->p.x2 = fx;
-									g->p.ptr = (void *)g->linebuf;
-									gdisp_lld_blit_area(g);
-								}
-								#if GDISP_HARDWARE_BITFILLS == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Next best line write is hardware streaming
-							#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE
-								#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
-									if (gvmt(g)->writestart)
-								#endif
-								{
-									g->p.x = x+ix;
-									g->p.y = fy;
-									g->p.cx = fx;
-									g->p.cy = 1;
-									gdisp_lld_write_start(g);
-									#if GDISP_HARDWARE_STREAM_POS
-										gdisp_lld_write_pos(g);
-									#endif
-									for(j = 0; j < fx; j++) {
-										g->p.color = g->linebuf[j];
-										gdisp_lld_write_color(g);
-									}
-									gdisp_lld_write_stop(g);
-								}
-								#if GDISP_HARDWARE_STREAM_WRITE == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Next best line write is drawing pixels in combination with filling
-							#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS && GDISP_HARDWARE_DRAWPIXEL
-								// We don't need to test for auto-detect on drawpixel as we know we have it because we don't have streaming.
-								#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
-									if (gvmt(g)->fill)
-								#endif
-								{
-									g->p.y = fy;
-									g->p.cy = 1;
-									g->p.x = x+ix;
-									g->p.cx = 1;
-									for(j = 0; j < fx; ) {
-										g->p.color = g->linebuf[j];
-										if (j + g->p.cx < fx && g->linebuf[j] == g->linebuf[j + g->p.cx])
-											g->p.cx++;
-										else if (g->p.cx == 1) {
-											gdisp_lld_draw_pixel(g);
-											j++;
-											g->p.x++;
-										} else {
-											gdisp_lld_fill_area(g);
-											j += g->p.cx;
-											g->p.x += g->p.cx;
-											g->p.cx = 1;
-										}
-									}
-								}
-								#if GDISP_HARDWARE_FILLS == HARDWARE_AUTODETECT
-									else
-								#endif
-							#endif
-
-							// Worst line write is drawing pixels
-							#if GDISP_HARDWARE_BITFILLS != GFXON && GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_FILLS != GFXON && GDISP_HARDWARE_DRAWPIXEL
-								// The following test is unneeded because we are guaranteed to have draw pixel if we don't have streaming
-								//#if GDISP_HARDWARE_DRAWPIXEL == HARDWARE_AUTODETECT
-								//	if (gvmt(g)->pixel)
-								//#endif
-								{
-									g->p.y = fy;
-									for(g->p.x = x+ix, j = 0; j < fx; g->p.x++, j++) {
-										g->p.color = g->linebuf[j];
-										gdisp_lld_draw_pixel(g);
-									}
-								}
-							#endif
+							// Read one line of data from the screen and write it to the new location
+							if (!readline(g, x+ix, fy+lines, fx))
+								return;
+							writeline(g, x+ix, fy, fx);
 						}
 					}
 				}
 			#endif
-		}
+		}
+
+		/* fill the remaining gap */
+		g->p.x = x;
+		g->p.y = lines > 0 ? (y+cy) : y;
+		g->p.cx = cx;
+		g->p.cy = abslines;
+		g->p.color = bgcolor;
+		fillarea(g);
+	}
+
+	#if NEED_LINECOPY
+		// linecopy(g, x, y, cx, cy, srcx, srcy)
+		// Copy an area a line at a time through the line buffer.
+		// Returns gFalse if the display can't read pixels
+		// Note:		This is not clipped
+		static gBool linecopy(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy) {
+			gCoord 	fy, dy, ix, fx, i;
+
+			// Copy the lines in an order that doesn't overwrite source lines before they are read
+			if (y > srcy) {
+				fy = cy-1;
+				dy = -1;
+			} else {
+				fy = 0;
+				dy = 1;
+			}
+			for(i = 0; i < cy; i++, fy += dy) {
+
+				// Handle where the buffer is smaller than a line.
+				//	Within a line the same applies to the order of the pieces.
+				for(ix = 0; ix < cx; ix += GDISP_LINEBUF_SIZE) {
+					fx = cx - ix;
+					if (fx > GDISP_LINEBUF_SIZE)
+						fx = GDISP_LINEBUF_SIZE;
+					if (x > srcx) {
+						if (!readline(g, srcx+cx-ix-fx, srcy+fy, fx))
+							return gFalse;
+						writeline(g, x+cx-ix-fx, y+fy, fx);
+					} else {
+						if (!readline(g, srcx+ix, srcy+fy, fx))
+							return gFalse;
+						writeline(g, x+ix, y+fy, fx);
+					}
+				}
+			}
+			return gTrue;
+		}
+	#endif
+
+	// copyarea(g, x, y, cx, cy, srcx, srcy)
+	// Returns gFalse if the display can't copy this area
+	// Note:		This is not clipped
+	static gBool copyarea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy) {
+		// A purely vertical copy where the source and destination overlap is a scroll of the area covering both.
+		//	The scroll also moves the source lines the destination doesn't cover. Their old contents are now the
+		//	first (or last) lines of the destination so they are copied back from there. Without the line copy
+		//	they are left filled with black.
+		#if GDISP_HARDWARE_SCROLL
+			#if GDISP_HARDWARE_SCROLL == HARDWARE_AUTODETECT
+				if (gvmt(g)->vscroll)
+			#endif
+			{
+				gCoord	d;
+
+				d = y < srcy ? srcy - y : y - srcy;
+				if (x == srcx && d < cy) {
+					PIXELCOUNT(g, (gU32)cx * cy);
+					g->p.x = x;
+					g->p.y = y < srcy ? y : srcy;
+					g->p.cx = cx;
+					g->p.cy = cy + d;
+					g->p.y1 = srcy - y;
+					g->p.color = GFX_BLACK;
+					gdisp_lld_vertical_scroll(g);
+					#if NEED_LINECOPY
+						PIXELCOUNT(g, (gU32)cx * d);
+						if (y > srcy)
+							return linecopy(g, x, srcy, cx, d, x, y);
+						return linecopy(g, x, y+cy, cx, d, x, y+cy-d);
+					#else
+						return gTrue;
+					#endif
+				}
+			}
+		#endif
+
+		#if NEED_LINECOPY
+			PIXELCOUNT(g, (gU32)cx * cy);
+			return linecopy(g, x, y, cx, cy, srcx, srcy);
+		#else
+			return gFalse;
+		#endif
+	}
+
+	void gdispGVerticalScroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, int lines, gColor bgcolor) {
+		if (!lines) return;
+
+		MUTEX_ENTER(g);
+		#if GDISP_NEED_DISPLAYLIST
+			// A scroll moves what is on the display which isn't what is being recorded
+			if (g->list) {
+				g->list->failed = gTrue;
+				MUTEX_EXIT(g);
+				return;
+			}
+		#endif
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (x < g->clipx0) { cx -= g->clipx0 - x; x = g->clipx0; }
+				if (y < g->clipy0) { cy -= g->clipy0 - y; y = g->clipy0; }
+				if (cx <= 0 || cy <= 0 || x >= g->clipx1 || y >= g->clipy1) { MUTEX_EXIT(g); return; }
+				if (x+cx > g->clipx1)	cx = g->clipx1 - x;
+				if (y+cy > g->clipy1)	cy = g->clipy1 - y;
+
+				#if GDISP_NEED_CLIP_REGION
+					if (g->useregion) {
+						const gdispRegionRect	*r;
+						gCoord					rx, ry, rcx, rcy;
+						unsigned				i;
+
+						// Scroll the part of the area within each rectangle of the region.
+						//	Pixels can't be scrolled in from outside a rectangle so those lines get the background color.
+						for(i = 0, r = g->clipregion.r; i < g->clipregion.cnt; i++, r++) {
+							rx = x < r->x0 ? r->x0 : x;
+							ry = y < r->y0 ? r->y0 : y;
+							rcx = (x+cx > r->x1 ? r->x1 : x+cx) - rx;
+							rcy = (y+cy > r->y1 ? r->y1 : y+cy) - ry;
+							if (rcx > 0 && rcy > 0)
+								vscroll(g, rx, ry, rcx, rcy, lines, bgcolor);
+						}
+						autoflush_stopdone(g);
+						MUTEX_EXIT(g);
+						return;
+					}
+				#endif
+			}
+		#endif
+
+		vscroll(g, x, y, cx, cy, lines, bgcolor);
+		autoflush_stopdone(g);
+		MUTEX_EXIT(g);
+	}
+
+	gBool gdispGCopyArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy) {
+		gBool	res;
+
+		if (x == srcx && y == srcy) return gTrue;
+
+		MUTEX_ENTER(g);
+		#if GDISP_NEED_DISPLAYLIST
+			// A copy moves what is on the display which isn't what is being recorded
+			if (g->list) {
+				g->list->failed = gTrue;
+				MUTEX_EXIT(g);
+				return gFalse;
+			}
+		#endif
+
+		// Both the source and the destination must be on the display
+		if (srcx < 0) { cx += srcx; x -= srcx; srcx = 0; }
+		if (srcy < 0) { cy += srcy; y -= srcy; srcy = 0; }
+		if (srcx+cx > g->g.Width)	cx = g->g.Width - srcx;
+		if (srcy+cy > g->g.Height)	cy = g->g.Height - srcy;
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (x < g->clipx0) { cx -= g->clipx0 - x; srcx += g->clipx0 - x; x = g->clipx0; }
+				if (y < g->clipy0) { cy -= g->clipy0 - y; srcy += g->clipy0 - y; y = g->clipy0; }
+				if (x+cx > g->clipx1)	cx = g->clipx1 - x;
+				if (y+cy > g->clipy1)	cy = g->clipy1 - y;
+			}
+		#endif
+		if (x < 0) { cx += x; srcx -= x; x = 0; }
+		if (y < 0) { cy += y; srcy -= y; y = 0; }
+		if (x+cx > g->g.Width)		cx = g->g.Width - x;
+		if (y+cy > g->g.Height)		cy = g->g.Height - y;
+		if (cx <= 0 || cy <= 0) { MUTEX_EXIT(g); return gTrue; }
 
-		/* fill the remaining gap */
-		g->p.x = x;
-		g->p.y = lines > 0 ? (y+cy) : y;
-		g->p.cx = cx;
-		g->p.cy = abslines;
-		g->p.color = bgcolor;
-		fillarea(g);
+		res = copyarea(g, x, y, cx, cy, srcx, srcy);
 		autoflush_stopdone(g);
 		MUTEX_EXIT(g);
+		return res;
 	}
 #endif
 
@@ -2874,6 +4334,11 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 				if (!gvmt(g)->control)
 					return;
 			#endif
+			#if GDISP_NEED_DRAWCONTEXT
+				// Only the display itself can be controlled
+				if (g->parent)
+					return;
+			#endif
 			MUTEX_ENTER(g);
 			g->p.x = what;
 			g->p.ptr = value;
@@ -3158,7 +4623,10 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		return;
 	}
 
-	void gdispGDrawThickLine(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color, gCoord width, gBool round) {
+	// thickline(g, x0, y0, x1, y1, color, width, round, fillpoly)
+	// Builds the polygon for a thick line and draws it using fillpoly
+	static void thickline(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color, gCoord width, gBool round,
+							void (*fillpoly)(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color)) {
 		gCoord dx, dy, nx = 0, ny = 0;
 
 		/* Compute the direction vector for the line */
@@ -3206,7 +4674,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			pntarray[3].x = dx;
 			pntarray[3].y = dy;
 
-			gdispGFillConvexPoly(g, x0, y0, pntarray, 4, color);
+			fillpoly(g, x0, y0, pntarray, 4, color);
 		} else {
 			/* We use 4 points for basic shape, plus 4 extra points for ends:
 			 *
@@ -3258,9 +4726,506 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			pntarray[7].x = dx;
 			pntarray[7].y = dy;
 
-			gdispGFillConvexPoly(g, x0, y0, pntarray, 8, color);
+			fillpoly(g, x0, y0, pntarray, 8, color);
+		}
+	}
+
+	void gdispGDrawThickLine(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color, gCoord width, gBool round) {
+		thickline(g, x0, y0, x1, y1, color, width, round, gdispGFillConvexPoly);
+	}
+#endif
+
+#if GDISP_NEED_COMPLEX_POLYGON
+	// An edge of a complex polygon. It covers the rows y0+1 to y1 which matches the
+	// rules used by gmiscHittestPoly(). The crossing on the current row is exactly x + rem/dy.
+	typedef struct polyedge {
+		gCoord	y0, y1;				// The top (exclusive) and bottom (inclusive) rows
+		gCoord	x;					// The whole part of the crossing
+		gI32	rem;				// The fractional part of the crossing (0 <= rem < dy)
+		gI32	q, r, dy;			// The per row step is q + r/dy (0 <= r < dy)
+		gI8		dir;				// +1 for a downward edge, -1 for an upward edge
+	} polyedge;
+
+	#define POLY_RUNS		8		// The number of runs to join spans into (the last span of each row shares the last run)
+
+	// Parameters:	An edge
+	// Alters:		nothing
+	// Moves the edge down one row
+	static GFXINLINE void polystep(polyedge *e) {
+		e->x += e->q;
+		e->rem += e->r;
+		if (e->rem >= e->dy) {
+			e->rem -= e->dy;
+			e->x++;
+		}
+	}
+
+	// Returns:		gTrue if edge a crosses the current row to the left of edge b
+	static GFXINLINE gBool polyleft(const polyedge *a, const polyedge *b) {
+		if (a->x != b->x)
+			return a->x < b->x;
+		return (gU32)a->rem * (gU32)b->dy < (gU32)b->rem * (gU32)a->dy;
+	}
+
+	void gdispGFillPoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, const unsigned *cnts, unsigned contours, gFillRule rule, gColor color) {
+		const gPoint	*p, *pn, *pt, *pb;
+		polyedge		**act, *e, *edges, tmp;
+		spanrun			runs[POLY_RUNS+1];
+		unsigned		c, i, n, ne, nact, k, mode;
+		gCoord			y, x0, y0, x1, y1, sx, sx1;
+		int				wind;
+		gBool			inspan;
+
+		// Count the points and find the bounding box
+		for(n = 0, p = pntarray, c = 0; c < contours; c++) {
+			for(i = 0; i < cnts[c]; i++, p++) {
+				if (!n) {
+					x0 = x1 = p->x;
+					y0 = y1 = p->y;
+				} else {
+					if (p->x < x0) x0 = p->x;
+					if (p->x > x1) x1 = p->x;
+					if (p->y < y0) y0 = p->y;
+					if (p->y > y1) y1 = p->y;
+				}
+				n++;
+			}
+		}
+		if (!n)
+			return;
+
+		MUTEX_ENTER(g);
+		if ((mode = spanmode(g, tx+x0, ty+y0, tx+x1, ty+y1)) == SPANS_NONE) {
+			MUTEX_EXIT(g);
+			return;
+		}
+
+		// One allocation holds the active edge list followed by the edge table
+		if (!(act = gfxAlloc(n * (sizeof(polyedge *) + sizeof(polyedge))))) {
+			MUTEX_EXIT(g);
+			return;
+		}
+		edges = (polyedge *)(act + n);
+
+		g->p.color = color;
+		spaninit(runs, POLY_RUNS+1);
+
+		// Build the edge table sorted by the top row. Horizontal edges are drawn straight away.
+		for(ne = 0, p = pntarray, c = 0; c < contours; p += cnts[c], c++) {
+			for(i = 0; i < cnts[c]; i++) {
+				pt = &p[i];
+				pn = i+1 < cnts[c] ? pt+1 : p;
+				if (pt->y == pn->y) {
+					if (pt->x < pn->x)
+						spanadd(g, &runs[POLY_RUNS], mode, tx+pt->x, ty+pt->y, tx+pn->x, ty+pt->y);
+					else
+						spanadd(g, &runs[POLY_RUNS], mode, tx+pn->x, ty+pt->y, tx+pt->x, ty+pt->y);
+					continue;
+				}
+				if (pt->y < pn->y) {
+					tmp.dir = 1;
+					pb = pn;
+				} else {
+					tmp.dir = -1;
+					pb = pt;
+					pt = pn;
+				}
+				tmp.y0 = ty+pt->y;
+				tmp.y1 = ty+pb->y;
+				tmp.x = tx+pt->x;
+				tmp.rem = 0;
+				tmp.dy = pb->y - pt->y;
+				tmp.q = (pb->x - pt->x) / tmp.dy;
+				tmp.r = (pb->x - pt->x) % tmp.dy;
+				if (tmp.r < 0) {
+					tmp.r += tmp.dy;
+					tmp.q--;
+				}
+				for(k = ne++; k && edges[k-1].y0 > tmp.y0; k--)
+					edges[k] = edges[k-1];
+				edges[k] = tmp;
+			}
+		}
+
+		// Scan the rows
+		for(y = 0, nact = 0, i = 0; i < ne || nact; y++) {
+			// Skip any empty rows
+			if (!nact)
+				y = edges[i].y0+1;
+
+			// Drop the edges that have finished and move the rest to this row
+			for(c = k = 0; c < nact; c++) {
+				if (act[c]->y1 < y)
+					continue;
+				polystep(act[c]);
+				act[k++] = act[c];
+			}
+			nact = k;
+
+			// Add the edges starting on this row
+			for(; i < ne && edges[i].y0 < y; i++) {
+				polystep(&edges[i]);
+				act[nact++] = &edges[i];
+			}
+
+			// Sort the active edges by their crossing. They are nearly always in order already.
+			for(c = 1; c < nact; c++) {
+				e = act[c];
+				for(k = c; k && polyleft(e, act[k-1]); k--)
+					act[k] = act[k-1];
+				act[k] = e;
+			}
+
+			// Generate the spans. Pixels exactly on an edge are inside.
+			inspan = gFalse;
+			sx = sx1 = 0;
+			for(wind = 0, k = 0, c = 0; c < nact; c++) {
+				e = act[c];
+				if (!wind) {
+					x0 = e->rem ? e->x+1 : e->x;
+					if (inspan && x0 <= sx1+1) {
+						inspan = gFalse;						// Continues the previous span
+						x0 = sx;
+					}
+				}
+				if (rule == gFillRuleNonZero)
+					wind += e->dir;
+				else
+					wind ^= 1;
+				if (!wind) {
+					if (inspan) {
+						spanadd(g, &runs[k < POLY_RUNS-1 ? k : POLY_RUNS-1], mode, sx, y, sx1, y);
+						k++;
+					}
+					sx = x0;
+					sx1 = e->x;
+					inspan = sx <= sx1;
+				}
+			}
+			if (inspan)
+				spanadd(g, &runs[k < POLY_RUNS-1 ? k : POLY_RUNS-1], mode, sx, y, sx1, y);
+		}
+
+		spandone(g, runs, POLY_RUNS+1, mode);
+		autoflush(g);
+		MUTEX_EXIT(g);
+		gfxFree(act);
+	}
+#endif
+
+#if GDISP_NEED_ANTIALIAS_SHAPES
+	// aapixel(g, x, y, alpha)
+	// Parameters:	color
+	// Alters:		x,y cx,cy
+	// Blends the color into one pixel by how much of the pixel is covered. This is clipped.
+	static void aapixel(GDisplay *g, gCoord x, gCoord y, gU8 alpha) {
+		gColor	c;
+
+		if (!alpha)
+			return;
+		#if NEED_CLIPPING
+			#if GDISP_HARDWARE_CLIP == HARDWARE_AUTODETECT
+				if (!gvmt(g)->setclip)
+			#endif
+			{
+				if (x < g->clipx0 || x >= g->clipx1 || y < g->clipy0 || y >= g->clipy1)
+					return;
+				#if GDISP_NEED_CLIP_REGION
+					if (g->useregion && !inregion(g, x, y, 1, 1))
+						return;
+				#endif
+			}
+		#endif
+		if (alpha == 255) {
+			g->p.x = x;
+			g->p.y = y;
+			drawpixel(g);
+			return;
+		}
+		c = g->p.color;
+		blendrun(g, x, y, 1, &c, &alpha);
+		g->p.color = c;
+	}
+
+	// aaline(g)
+	// Parameters:	x,y x1,y1 and color
+	// Alters:		x,y x1,y1 cx,cy
+	// Uses Wu's algorithm. The two pixels either side of the line share its coverage.
+	static void aaline(GDisplay *g) {
+		gCoord	x0, y0, x1, y1, dx, dy;
+		fixed	f, k;
+		gU8		a;
+
+		x0 = g->p.x; y0 = g->p.y;
+		x1 = g->p.x1; y1 = g->p.y1;
+		dx = x1 - x0;
+		dy = y1 - y0;
+
+		// Horizontal, vertical and diagonal lines have no edges to smooth
+		if (!dx || !dy || dx == dy || dx == -dy) {
+			line_clip(g);
+			return;
+		}
+
+		if ((dx < 0 ? -dx : dx) > (dy < 0 ? -dy : dy)) {
+			// Step along x
+			if (dx < 0) {
+				x0 = x1; y0 = y1;
+				dx = -dx; dy = -dy;
+			}
+			k = FIXED(dy) / dx;
+			for(f = FIXED(y0); dx >= 0; dx--, x0++, f += k) {
+				a = (gU8)(f >> 8);
+				aapixel(g, x0, NONFIXED(f), 255 - a);
+				aapixel(g, x0, NONFIXED(f) + 1, a);
+			}
+		} else {
+			// Step along y
+			if (dy < 0) {
+				x0 = x1; y0 = y1;
+				dx = -dx; dy = -dy;
+			}
+			k = FIXED(dx) / dy;
+			for(f = FIXED(x0); dy >= 0; dy--, y0++, f += k) {
+				a = (gU8)(f >> 8);
+				aapixel(g, NONFIXED(f), y0, 255 - a);
+				aapixel(g, NONFIXED(f) + 1, y0, a);
+			}
 		}
 	}
+
+	void gdispGDrawLineAA(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color) {
+		MUTEX_ENTER(g);
+		g->p.x = x0;
+		g->p.y = y0;
+		g->p.x1 = x1;
+		g->p.y1 = y1;
+		g->p.color = color;
+		aaline(g);
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
+
+	#if GDISP_NEED_CIRCLE || GDISP_NEED_ARC
+		// Circles use 4 bits of fraction for the edge (the same as anti-aliased fonts) which
+		//	allows a radius of up to 2047 with 32 bit arithmetic.
+		#define AA_MAXRADIUS	2047
+		#define AA_ALPHA(v)		((gU8)(((v) & 15) * 17))
+
+		// The square root of n rounded down
+		static gU32 aasqrt(gU32 n) {
+			gU32	r, b;
+
+			r = 0;
+			for(b = (gU32)1 << 30; b > n; b >>= 2);
+			for(; b; b >>= 2) {
+				if (n >= r + b) {
+					n -= r + b;
+					r = (r >> 1) + b;
+				} else
+					r >>= 1;
+			}
+			return r;
+		}
+
+		// Which part of a circle to draw
+		typedef struct aaarc {
+			gI32	sx, sy;			// The start direction (y up)
+			gI32	ex, ey;			// The end direction (y up)
+			gBool	wide;			// The arc is more than half a circle
+		} aaarc;
+
+		// aaplot(g, x, y, a, b, alpha, arc)
+		// Parameters:	color
+		// Alters:		x,y cx,cy
+		// Blends the point (x+a, y+b) if it is part of the arc.
+		static void aaplot(GDisplay *g, gCoord x, gCoord y, gCoord a, gCoord b, gU8 alpha, const aaarc *arc) {
+			gBool	s, e;
+
+			if (arc) {
+				// Cross products with the start and end directions (screen y is down)
+				s = arc->sx * -b - arc->sy * a >= 0;
+				e = a * arc->ey + b * arc->ex >= 0;
+				if (arc->wide ? !s && !e : !s || !e)
+					return;
+			}
+			aapixel(g, x+a, y+b, alpha);
+		}
+
+		// aaplot4(g, x, y, a, b, alpha, arc)
+		// Parameters:	color
+		// Alters:		x,y cx,cy
+		// Blends the four mirror images of (x+a, y+b). Points on an axis are only drawn once.
+		static void aaplot4(GDisplay *g, gCoord x, gCoord y, gCoord a, gCoord b, gU8 alpha, const aaarc *arc) {
+			if (!alpha)
+				return;
+			aaplot(g, x, y, a, b, alpha, arc);
+			if (a)
+				aaplot(g, x, y, -a, b, alpha, arc);
+			if (b) {
+				aaplot(g, x, y, a, -b, alpha, arc);
+				if (a)
+					aaplot(g, x, y, -a, -b, alpha, arc);
+			}
+		}
+
+		// aacircle(g, x, y, radius, arc)
+		// Parameters:	color
+		// Alters:		x,y cx,cy
+		// Wu's circle algorithm. Each octant is stepped along the axis it changes slowest in.
+		static void aacircle(GDisplay *g, gCoord x, gCoord y, gCoord radius, const aaarc *arc) {
+			gCoord	a, b, m;
+			gU32	r2, v;
+			gU8		f;
+
+			r2 = (gU32)radius * radius;
+			m = aasqrt(r2 / 2);
+			for(a = 0; a <= m; a++) {
+				v = aasqrt((r2 - (gU32)a * a) << 8);
+				b = v >> 4;
+				f = AA_ALPHA(v);
+				aaplot4(g, x, y, a, b, 255 - f, arc);
+				aaplot4(g, x, y, a, b+1, f, arc);
+				if (b != a)
+					aaplot4(g, x, y, b, a, 255 - f, arc);
+				aaplot4(g, x, y, b+1, a, f, arc);
+			}
+		}
+	#endif
+
+	#if GDISP_NEED_CIRCLE
+		void gdispGDrawCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+			if (radius < 1 || radius > AA_MAXRADIUS) {
+				gdispGDrawCircle(g, x, y, radius, color);
+				return;
+			}
+			MUTEX_ENTER(g);
+			g->p.color = color;
+			aacircle(g, x, y, radius, 0);
+			autoflush(g);
+			MUTEX_EXIT(g);
+		}
+
+		void gdispGFillCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color) {
+			gCoord	a, b, m, dy;
+			gU32	r2, v;
+			gU8		f;
+
+			if (radius < 1 || radius > AA_MAXRADIUS) {
+				gdispGFillCircle(g, x, y, radius, color);
+				return;
+			}
+
+			MUTEX_ENTER(g);
+			g->p.color = color;
+			r2 = (gU32)radius * radius;
+			m = aasqrt(r2 / 2);
+
+			// The middle rows (smoothed across each row) and the edges of the top and bottom (smoothed down each column)
+			for(a = 0; a <= m; a++) {
+				v = aasqrt((r2 - (gU32)a * a) << 8);
+				b = v >> 4;
+				f = AA_ALPHA(v);
+				g->p.y = y+a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
+				if (a) {
+					g->p.y = y-a; g->p.x = x-b; g->p.x1 = x+b; hline_clip(g);
+				}
+				aaplot4(g, x, y, b+1, a, f, 0);
+				aaplot4(g, x, y, a, b+1, f, 0);
+			}
+
+			// The solid part of the top and bottom rows. Column a is solid down to its edge at b.
+			a = m;
+			b = aasqrt(r2 - (gU32)a * a);
+			for(dy = m+1; dy <= radius; dy++) {
+				while (b < dy) {
+					if (--a < 0)
+						break;
+					b = aasqrt(r2 - (gU32)a * a);
+				}
+				if (a < 0)
+					break;
+				g->p.y = y+dy; g->p.x = x-a; g->p.x1 = x+a; hline_clip(g);
+				g->p.y = y-dy; g->p.x = x-a; g->p.x1 = x+a; hline_clip(g);
+			}
+
+			autoflush(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
+
+	#if GDISP_NEED_ARC
+		void gdispGDrawArcAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gCoord start, gCoord end, gColor color) {
+			aaarc	arc;
+
+			if (radius < 1 || radius > AA_MAXRADIUS) {
+				gdispGDrawArc(g, x, y, radius, start, end, color);
+				return;
+			}
+
+			// Normalize the angles
+			if (start < 0)
+				start -= (start/360-1)*360;
+			else if (start >= 360)
+				start %= 360;
+			if (end < 0)
+				end -= (end/360-1)*360;
+			else if (end >= 360)
+				end %= 360;
+
+			// The start and end directions are scaled to 1024
+			#if GFX_USE_GMISC && GMISC_NEED_FIXEDTRIG
+				arc.sx = ffcos(start) >> 6;	arc.sy = ffsin(start) >> 6;
+				arc.ex = ffcos(end) >> 6;	arc.ey = ffsin(end) >> 6;
+			#elif GFX_USE_GMISC && GMISC_NEED_FASTTRIG
+				arc.sx = 1024*fcos(start);	arc.sy = 1024*fsin(start);
+				arc.ex = 1024*fcos(end);	arc.ey = 1024*fsin(end);
+			#else
+				arc.sx = 1024*cos(start*GFX_PI/180);	arc.sy = 1024*sin(start*GFX_PI/180);
+				arc.ex = 1024*cos(end*GFX_PI/180);		arc.ey = 1024*sin(end*GFX_PI/180);
+			#endif
+			arc.wide = (end <= start ? end + 360 : end) - start > 180;
+
+			MUTEX_ENTER(g);
+			g->p.color = color;
+			aacircle(g, x, y, radius, start == end ? 0 : &arc);
+			autoflush(g);
+			MUTEX_EXIT(g);
+		}
+	#endif
+
+	#if GDISP_NEED_CIRCLE || GDISP_NEED_ARC
+		#undef AA_MAXRADIUS
+		#undef AA_ALPHA
+	#endif
+
+	#if GDISP_NEED_CONVEX_POLYGON
+		void gdispGDrawPolyAA(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color) {
+			const gPoint	*epnt, *p;
+
+			epnt = &pntarray[cnt-1];
+
+			MUTEX_ENTER(g);
+			g->p.color = color;
+			for(p = pntarray; p < epnt; p++) {
+				g->p.x=tx+p->x; g->p.y=ty+p->y; g->p.x1=tx+p[1].x; g->p.y1=ty+p[1].y; aaline(g);
+			}
+			g->p.x=tx+p->x; g->p.y=ty+p->y; g->p.x1=tx+pntarray->x; g->p.y1=ty+pntarray->y; aaline(g);
+
+			autoflush(g);
+			MUTEX_EXIT(g);
+		}
+
+		void gdispGFillConvexPolyAA(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color) {
+			// Blending the edges over the filled polygon leaves the inside unchanged and smooths the outside
+			gdispGFillConvexPoly(g, tx, ty, pntarray, cnt, color);
+			gdispGDrawPolyAA(g, tx, ty, pntarray, cnt, color);
+		}
+
+		void gdispGDrawThickLineAA(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color, gCoord width, gBool round) {
+			thickline(g, x0, y0, x1, y1, color, width, round, gdispGFillConvexPolyAA);
+		}
+	#endif
 #endif
 
 #if GDISP_NEED_TEXT
@@ -3401,17 +5366,14 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.bgcolor = g->p.color = bgcolor;
 
 		TEST_CLIP_AREA(g) {
-			fillarea(g);
+			fillarea_clip(g);
 			mf_render_character(font, x, y, c, fillcharline, g);
 		}
 		autoflush(g);
 		MUTEX_EXIT(g);
 	}
 
-	void gdispGDrawString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
+	static void drawstring(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
 		g->t.font = font;
 		g->t.clipx0 = x;
 		g->t.clipy0 = y;
@@ -3420,14 +5382,9 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.color = color;
 
 		mf_render_aligned(font, x+font->baseline_x, y, MF_ALIGN_LEFT, str, 0, drawcharglyph, g);
-		autoflush(g);
-		MUTEX_EXIT(g);
 	}
 
-	void gdispGFillString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
+	static void fillstring(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
 		g->p.cx = mf_get_string_width(font, str, 0, 0) + font->baseline_x;
 		g->p.cy = font->height;
 		g->t.font = font;
@@ -3439,21 +5396,14 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 		g->t.bgcolor = g->p.color = bgcolor;
 
 		TEST_CLIP_AREA(g) {
-			fillarea(g);
+			fillarea_clip(g);
 			mf_render_aligned(font, x+font->baseline_x, y, MF_ALIGN_LEFT, str, 0, fillcharglyph, g);
 		}
-
-		autoflush(g);
-		MUTEX_EXIT(g);
 	}
 
-	void gdispGDrawStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
+	static void drawstringbox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
 		gCoord		totalHeight;
 
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
-
 		// Apply padding
 		#if GDISP_NEED_TEXT_BOXPADLR != 0 || GDISP_NEED_TEXT_BOXPADTB != 0
 			if (!(justify & gJustifyNoPad)) {
@@ -3520,18 +5470,11 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			} else
 		#endif
 		mf_render_aligned(font, x, y, (justify & JUSTIFYMASK_HORIZONTAL), str, 0, drawcharglyph, g);
-
-		autoflush(g);
-		MUTEX_EXIT(g);
 	}
 
-	void gdispGFillStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
+	static void fillstringbox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
 		gCoord		totalHeight;
 
-		if (!font)
-			return;
-		MUTEX_ENTER(g);
-
 		g->p.x = x;
 		g->p.y = y;
 		g->p.cx = cx;
@@ -3541,7 +5484,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 
 			// background fill
 			g->p.color = bgcolor;
-			fillarea(g);
+			fillarea_clip(g);
 
 			// Apply padding
 			#if GDISP_NEED_TEXT_BOXPADLR != 0 || GDISP_NEED_TEXT_BOXPADTB != 0
@@ -3611,11 +5554,98 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 			#endif
 			mf_render_aligned(font, x, y, (justify & JUSTIFYMASK_HORIZONTAL), str, 0, fillcharglyph, g);
 		}
+	}
+
+	void gdispGDrawString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		drawstring(g, x, y, str, font, color);
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
+
+	void gdispGFillString(GDisplay *g, gCoord x, gCoord y, const char *str, gFont font, gColor color, gColor bgcolor) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		fillstring(g, x, y, str, font, color, bgcolor);
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
 
+	void gdispGDrawStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gJustify justify) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		drawstringbox(g, x, y, cx, cy, str, font, color, justify);
+		autoflush(g);
+		MUTEX_EXIT(g);
+	}
+
+	void gdispGFillStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgcolor, gJustify justify) {
+		if (!font)
+			return;
+		MUTEX_ENTER(g);
+		fillstringbox(g, x, y, cx, cy, str, font, color, bgcolor, justify);
 		autoflush(g);
 		MUTEX_EXIT(g);
 	}
 
+	#if GDISP_NEED_TEXT_BATCH
+		static void drawbatchitem(GDisplay *g, const gdispStringItem *p) {
+			if (p->cx <= 0 || p->cy <= 0) {
+				if ((p->flags & gStringItemFill))
+					fillstring(g, p->x, p->y, p->str, p->font, p->color, p->bgcolor);
+				else
+					drawstring(g, p->x, p->y, p->str, p->font, p->color);
+			} else {
+				if ((p->flags & gStringItemFill))
+					fillstringbox(g, p->x, p->y, p->cx, p->cy, p->str, p->font, p->color, p->bgcolor, p->justify);
+				else
+					drawstringbox(g, p->x, p->y, p->cx, p->cy, p->str, p->font, p->color, p->justify);
+			}
+		}
+
+		gTicks gdispGDrawStringBatch(GDisplay *g, const gdispStringItem *items, unsigned count, gBool keeporder) {
+			gTicks		start;
+			unsigned	i, j;
+
+			if (!items || !count)
+				return 0;
+			start = gfxSystemTicks();
+			MUTEX_ENTER(g);
+
+			if (keeporder) {
+				for(i = 0; i < count; i++) {
+					if (items[i].font && items[i].str)
+						drawbatchitem(g, &items[i]);
+				}
+			} else {
+				// Render all the items for each font together.
+				// The first item with each font starts its group - there is no need for any extra RAM to sort.
+				for(i = 0; i < count; i++) {
+					if (!items[i].font || !items[i].str)
+						continue;
+					for(j = 0; j < i; j++) {
+						if (items[j].font == items[i].font)
+							break;
+					}
+					if (j < i)
+						continue;		// Already drawn as part of an earlier group
+					for(j = i; j < count; j++) {
+						if (items[j].font == items[i].font && items[j].str)
+							drawbatchitem(g, &items[j]);
+					}
+				}
+			}
+
+			autoflush(g);
+			MUTEX_EXIT(g);
+			return gfxSystemTicks() - start;
+		}
+	#endif
+
 	gCoord gdispGetFontMetric(gFont font, gFontmetric metric) {
 		if (!font)
 			return 0;
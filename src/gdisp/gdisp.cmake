@@ -8,7 +8,9 @@ list(APPEND ugfx_INCLUDE_DIRS
 list(APPEND ugfx_SOURCES
     ${ROOT_PATH}/gdisp.c
     ${ROOT_PATH}/gdisp_fonts.c
+    ${ROOT_PATH}/gdisp_fonts_ttf.c
     ${ROOT_PATH}/gdisp_pixmap.c
+    ${ROOT_PATH}/gdisp_kernels.c
     ${ROOT_PATH}/gdisp_image.c
     ${ROOT_PATH}/gdisp_image_native.c
     ${ROOT_PATH}/gdisp_image_gif.c
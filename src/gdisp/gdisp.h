@@ -53,6 +53,42 @@ typedef struct gPoint {
 	gCoord y;		/**< The y coordinate of the point. */
 } gPoint;
 
+#if GDISP_NEED_CLIP_REGION || defined(__DOXYGEN__)
+	/**
+	 * @struct gdispRegionRect
+	 * @brief   A rectangle within a clip region.
+	 * @note	x1 and y1 are exclusive ie. the width is x1 - x0.
+	 */
+	typedef struct gdispRegionRect {
+		gCoord x0, y0;		/**< The top left corner */
+		gCoord x1, y1;		/**< The bottom right corner (exclusive) */
+	} gdispRegionRect;
+
+	/**
+	 * @struct gdispRegion
+	 * @brief   A clip region made of up to GDISP_CLIP_REGION_MAX non-overlapping rectangles.
+	 */
+	typedef struct gdispRegion {
+		unsigned		cnt;							/**< The number of rectangles in use */
+		gdispRegionRect	r[GDISP_CLIP_REGION_MAX];		/**< The rectangles */
+	} gdispRegion;
+#endif
+
+#if GDISP_NEED_DISPLAYLIST || defined(__DOXYGEN__)
+	/**
+	 * @struct gdispList
+	 * @brief   A display list of recorded drawing.
+	 * @note	Initialise it with @p gdispListInit(). Treat the members as private.
+	 */
+	typedef struct gdispList {
+		void *			ops;			/**< The recorded operations */
+		gMemSize		size;			/**< The bytes allocated for the operations */
+		gMemSize		used;			/**< The bytes used by the operations */
+		gMemSize		last;			/**< Where the last operation starts */
+		gBool			failed;			/**< Some drawing could not be recorded */
+	} gdispList;
+#endif
+
 /**
  * @enum gJustify
  * @brief   Type for the text justification.
@@ -225,6 +261,37 @@ extern GDisplay	*GDISP;
  */
 typedef gColor		gPixel;
 
+#if GDISP_NEED_GRADIENT || defined(__DOXYGEN__)
+	/**
+	 * @enum gGradient
+	 * @brief   Type for the direction of a gradient fill.
+	 */
+	typedef enum gGradient {
+		gGradientVertical,			/**< The color changes from the top to the bottom */
+		gGradientHorizontal			/**< The color changes from the left to the right */
+	} gGradient;
+
+	/**
+	 * @struct gGradientStop
+	 * @brief   A color at a position along a gradient.
+	 */
+	typedef struct gGradientStop {
+		gU8				pos;		/**< The position from 0 (the start) to 255 (the end) */
+		gColor			color;		/**< The color at that position */
+	} gGradientStop;
+#endif
+
+#if GDISP_NEED_COMPLEX_POLYGON || defined(__DOXYGEN__)
+	/**
+	 * @enum gFillRule
+	 * @brief   Type for deciding which parts of a complex polygon are inside.
+	 */
+	typedef enum gFillRule {
+		gFillRuleEvenOdd,			/**< Inside if a line to the right crosses an odd number of edges */
+		gFillRuleNonZero			/**< Inside if the edges crossed going up and going down don't cancel */
+	} gFillRule;
+#endif
+
 /* Color Utility Functions */
 
 /**
@@ -249,6 +316,115 @@ gColor gdispBlendColor(gColor fg, gColor bg, gU8 alpha);
  */
 gColor gdispContrastColor(gColor color);
 
+/* Bulk Color Functions */
+
+/**
+ * @brief   Convert packed 24 bit pixels to colors
+ *
+ * @param[out] dst		The converted colors
+ * @param[in] src		The source pixels as 3 bytes each in red, green, blue order
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	Each color is the same as RGB2COLOR() gives. The buffers must not overlap.
+ *
+ * @api
+ */
+void gdispRGB888ToColors(gColor *dst, const gU8 *src, unsigned cnt);
+
+/**
+ * @brief   Convert packed 24 bit pixels in blue, green, red order (eg BMP files) to colors
+ *
+ * @param[out] dst		The converted colors
+ * @param[in] src		The source pixels as 3 bytes each in blue, green, red order
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	The buffers must not overlap.
+ *
+ * @api
+ */
+void gdispBGR888ToColors(gColor *dst, const gU8 *src, unsigned cnt);
+
+/**
+ * @brief   Convert colors to packed 24 bit pixels
+ *
+ * @param[out] dst		The pixels as 3 bytes each in red, green, blue order
+ * @param[in] src		The colors to convert
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	Each byte is the same as RED_OF() etc give. The buffers must not overlap.
+ *
+ * @api
+ */
+void gdispColorsToRGB888(gU8 *dst, const gColor *src, unsigned cnt);
+
+/**
+ * @brief   Convert 8 bit gray-scale values to colors
+ *
+ * @param[out] dst		The converted colors
+ * @param[in] src		The gray-scale values
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	Each color is the same as LUMA2COLOR() gives. The buffers must not overlap.
+ *
+ * @api
+ */
+void gdispLumaToColors(gColor *dst, const gU8 *src, unsigned cnt);
+
+/**
+ * @brief   Convert colors to 8 bit gray-scale values
+ *
+ * @param[out] dst		The gray-scale values
+ * @param[in] src		The colors to convert
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	Each value is the same as LUMA_OF() gives. The buffers must not overlap.
+ *
+ * @api
+ */
+void gdispColorsToLuma(gU8 *dst, const gColor *src, unsigned cnt);
+
+/**
+ * @brief   Expand 8 bit palette indexes to colors
+ *
+ * @param[out] dst		The converted colors
+ * @param[in] src		The palette indexes
+ * @param[in] cnt		The number of pixels
+ * @param[in] palette	The palette. It must have an entry for every index used.
+ *
+ * @api
+ */
+void gdispPaletteToColors(gColor *dst, const gU8 *src, unsigned cnt, const gColor *palette);
+
+/**
+ * @brief   Blend a run of colors over another
+ *
+ * @param[in,out] dst	The background colors. They are replaced by the blended colors.
+ * @param[in] fg		The foreground colors
+ * @param[in] alpha		The alpha value (0-255) for each foreground color
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	Each result is the same as gdispBlendColor(fg[i], dst[i], alpha[i]) gives.
+ *
+ * @api
+ */
+void gdispBlendColors(gColor *dst, const gColor *fg, const gU8 *alpha, unsigned cnt);
+
+/**
+ * @brief   Blend 32 bit ARGB pixels over colors
+ *
+ * @param[in,out] dst	The background colors. They are replaced by the blended colors.
+ * @param[in] src		The foreground pixels as 0xAARRGGBB. An alpha of 0 is all background,
+ * 						255 is all foreground.
+ * @param[in] cnt		The number of pixels
+ *
+ * @note	The background is treated as opaque and the result is opaque.
+ * @note	Unlike gdispBlendColors() the foreground is mixed at its full 8 bit precision
+ * 			before being converted to a color.
+ *
+ * @api
+ */
+void gdispBlendARGB(gColor *dst, const gU32 *src, unsigned cnt);
+
 /* Base Functions */
 
 /**
@@ -287,6 +463,58 @@ void gdispSetDisplay(GDisplay *g);
  */
 unsigned gdispGetDisplayCount(void);
 
+#if GDISP_NEED_DRAWCONTEXT || defined(__DOXYGEN__)
+	/**
+	 * @brief   Create a draw context for a display
+	 * @return	The draw context or NULL if the display doesn't support them or there is no memory
+	 *
+	 * @param[in] g 	The display to draw on
+	 *
+	 * @details	A draw context is passed to the gdispGXxxx() functions in place of the display.
+	 * 			It has its own clip area, text and driver call state and its own lock so
+	 * 			threads that each have their own context can draw to the display at the same time.
+	 * @note	Only memory based displays support draw contexts eg. pixmaps and the framebuffer driver.
+	 * @note	Drawing through different contexts happens in no particular order. Give each thread
+	 * 			its own part of the display (eg. by setting the clip area of its context).
+	 * @note	The context starts with a clip area covering the whole display. It keeps a copy of the
+	 * 			display size and orientation so create it after changing the orientation. Controls
+	 * 			applied to a context are ignored.
+	 * @note	Delete all of a display's contexts before deleting the display.
+	 * @pre		GDISP_NEED_DRAWCONTEXT must be GFXON in your gfxconf.h
+	 *
+	 * @api
+	 */
+	GDisplay *gdispGContextCreate(GDisplay *g);
+	#define gdispContextCreate()						gdispGContextCreate(GDISP)
+
+	/**
+	 * @brief   Delete a draw context
+	 *
+	 * @param[in] ctx 	The draw context
+	 *
+	 * @note	Nothing happens if this is not a draw context.
+	 * @pre		GDISP_NEED_DRAWCONTEXT must be GFXON in your gfxconf.h
+	 *
+	 * @api
+	 */
+	void gdispContextDelete(GDisplay *ctx);
+#endif
+
+#if GDISP_NEED_PARALLEL || defined(__DOXYGEN__)
+	/**
+	 * @brief   Set how many worker threads large fills and blits are shared with
+	 *
+	 * @param[in] threads	The number of worker threads to use. 0 draws everything in the calling thread.
+	 *
+	 * @note	This can't start more than GDISP_PARALLEL_THREADS workers. The default is to use them all.
+	 * @note	Fills and blits smaller than GDISP_PARALLEL_MIN_PIXELS are always drawn by the calling thread.
+	 * @pre		GDISP_NEED_PARALLEL must be GFXON in your gfxconf.h
+	 *
+	 * @api
+	 */
+	void gdispSetParallelThreads(unsigned threads);
+#endif
+
 /* Property Functions */
 
 /**
@@ -455,6 +683,31 @@ void gdispGFillArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColo
 void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer);
 #define gdispBlitAreaEx(x,y,cx,cy,sx,sy,rx,b)			gdispGBlitArea(GDISP,x,y,cx,cy,sx,sy,rx,b)
 
+#if GDISP_NEED_BLIT_ALPHA || defined(__DOXYGEN__)
+	/**
+	 * @brief   Draw a bitmap with an alpha channel over what is already on the display.
+	 * @details Each pixel is combined with the display using its alpha (Porter-Duff source-over).
+	 * @pre		GDISP_NEED_BLIT_ALPHA must be GFXON in your gfxconf.h
+	 * @note	The alpha values are one byte per pixel laid out the same as the bitmap (including @p srccx).
+	 * 			0 is fully transparent and 255 is fully opaque.
+	 * @note	Opaque runs of pixels are drawn as a normal blit and transparent pixels are skipped. Only
+	 * 			partially transparent pixels need the display to be read. Displays that can't be read
+	 * 			(and display lists while recording) use the nearest of opaque or transparent instead.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the filled area
+	 * @param[in] srcx,srcy The bitmap position to start the fill form
+	 * @param[in] srccx		The width of a line in the bitmap
+	 * @param[in] buffer	The bitmap in the driver's pixel format
+	 * @param[in] alpha		The alpha of each pixel of the bitmap
+	 *
+	 * @api
+	 */
+	void gdispGBlitAreaAlpha(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer, const gU8 *alpha);
+	#define gdispBlitAreaAlpha(x,y,cx,cy,sx,sy,rx,b,a)		gdispGBlitAreaAlpha(GDISP,x,y,cx,cy,sx,sy,rx,b,a)
+#endif
+
 /**
  * @brief   Draw a rectangular box.
  *
@@ -468,6 +721,67 @@ void gdispGBlitArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoor
 void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor color);
 #define gdispDrawBox(x,y,cx,cy,c)						gdispGDrawBox(GDISP,x,y,cx,cy,c)
 
+#if GDISP_NEED_GRADIENT || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill an area with a color that changes smoothly from one color to another.
+	 * @pre		GDISP_NEED_GRADIENT must be GFXON in your gfxconf.h
+	 * @note	Each row (or column) is a single color so it is drawn as one fill.
+	 * 			Neighbouring rows of the same color are joined into one fill.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the box (outside dimensions)
+	 * @param[in] dir		Whether the color changes down or across the area
+	 * @param[in] from		The color of the first row (or column)
+	 * @param[in] to		The color of the last row (or column)
+	 *
+	 * @api
+	 */
+	void gdispGFillGradient(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gGradient dir, gColor from, gColor to);
+	#define gdispFillGradient(x,y,cx,cy,d,f,t)				gdispGFillGradient(GDISP,x,y,cx,cy,d,f,t)
+
+	/**
+	 * @brief   Fill an area with a gradient that passes through several colors.
+	 * @pre		GDISP_NEED_GRADIENT must be GFXON in your gfxconf.h
+	 * @note	The stops must be in order of position. Before the first stop and after
+	 * 			the last stop the color doesn't change. Two stops at the same position
+	 * 			give a sharp change of color.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the box (outside dimensions)
+	 * @param[in] dir		Whether the color changes down or across the area
+	 * @param[in] stops		The colors and where they are along the gradient
+	 * @param[in] cnt		The number of stops
+	 *
+	 * @api
+	 */
+	void gdispGFillGradientStops(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gGradient dir, const gGradientStop *stops, unsigned cnt);
+	#define gdispFillGradientStops(x,y,cx,cy,d,s,n)			gdispGFillGradientStops(GDISP,x,y,cx,cy,d,s,n)
+#endif
+
+#if GDISP_NEED_PATTERN || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill an area with a repeating 8x8 pattern of two colors.
+	 * @pre		GDISP_NEED_PATTERN must be GFXON in your gfxconf.h
+	 * @note	The pattern is 8 bytes, one for each row starting at the top. The most
+	 * 			significant bit is the left-most pixel. Set bits use the foreground color.
+	 * @note	The pattern lines up with the display rather than the area so areas
+	 * 			filled side by side join seamlessly.
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the box (outside dimensions)
+	 * @param[in] pattern	The 8 bytes of the pattern
+	 * @param[in] fg		The color for the set bits
+	 * @param[in] bg		The color for the clear bits
+	 *
+	 * @api
+	 */
+	void gdispGFillPattern(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const gU8 *pattern, gColor fg, gColor bg);
+	#define gdispFillPattern(x,y,cx,cy,p,f,b)				gdispGFillPattern(GDISP,x,y,cx,cy,p,f,b)
+#endif
+
 /* Streaming Functions */
 
 #if GDISP_NEED_STREAMING || defined(__DOXYGEN__)
@@ -488,6 +802,8 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	 * 			region lies outside the current clipping area.
 	 * @note	A streaming operation may be terminated early (without writing to every location
 	 * 			in the stream area) by calling @p gdispStreamStop().
+	 * @note	Streaming can't be recorded in a display list. While recording the stream is not
+	 * 			started and the recording is marked as incomplete.
 	 *
 	 * @param[in] g 		The display to use
 	 * @param[in] x,y		The start position
@@ -547,6 +863,208 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	#define gdispSetClip(x,y,cx,cy)							gdispGSetClip(GDISP,x,y,cx,cy)
 #endif
 
+#if GDISP_NEED_CLIP_REGION || defined(__DOXYGEN__)
+	/**
+	 * @brief   Initialise a region to a single rectangle.
+	 * @pre		GDISP_NEED_CLIP_REGION must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] rgn		The region to initialise
+	 * @param[in] x,y		The start position
+	 * @param[in] cx,cy		The size of the area. If either is <= 0 the region is empty.
+	 *
+	 * @api
+	 */
+	void gdispRegionInit(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+
+	/**
+	 * @brief   Remove a rectangular area from a region.
+	 * @pre		GDISP_NEED_CLIP_REGION must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] rgn		The region to change
+	 * @param[in] x,y		The start position of the area to remove
+	 * @param[in] cx,cy		The size of the area to remove
+	 *
+	 * @return	gFalse if the result would need more than GDISP_CLIP_REGION_MAX rectangles.
+	 * 			In that case the region is left unchanged.
+	 *
+	 * @api
+	 */
+	gBool gdispRegionSubtract(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+
+	/**
+	 * @brief   Limit a region to a rectangular area.
+	 * @pre		GDISP_NEED_CLIP_REGION must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] rgn		The region to change
+	 * @param[in] x,y		The start position of the area to keep
+	 * @param[in] cx,cy		The size of the area to keep
+	 *
+	 * @api
+	 */
+	void gdispRegionIntersect(gdispRegion *rgn, gCoord x, gCoord y, gCoord cx, gCoord cy);
+
+	/**
+	 * @brief   Further clip all drawing to a region.
+	 * @pre		GDISP_NEED_CLIP_REGION must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] rgn		The region to clip to or NULL to remove the region. The region is copied.
+	 *
+	 * @return	gFalse if the display clips in hardware and therefore the region can't be used.
+	 *
+	 * @note	The region is combined with the area set by @p gdispGSetClip(). Changing that area
+	 * 			does not remove the region.
+	 * @note	Streaming requires the stream area to be within a single rectangle of the region.
+	 * 			Scrolling is performed separately within each rectangle of the region.
+	 *
+	 * @api
+	 */
+	gBool gdispGSetClipRegion(GDisplay *g, const gdispRegion *rgn);
+	#define gdispSetClipRegion(rgn)							gdispGSetClipRegion(GDISP,rgn)
+#endif
+
+#if GDISP_NEED_PIXELCOUNT || defined(__DOXYGEN__)
+	/**
+	 * @brief   Get the number of pixels written to the display.
+	 * @pre		GDISP_NEED_PIXELCOUNT must be GFXON in your gfxconf.h
+	 * @details	Every pixel written after clipping is counted. Comparing this against the
+	 * 			area that needed updating measures overdraw.
+	 *
+	 * @param[in] g 		The display to use
+	 *
+	 * @return	The number of pixels written since the last @p gdispGResetPixelCount()
+	 *
+	 * @api
+	 */
+	gU32 gdispGGetPixelCount(GDisplay *g);
+	#define gdispGetPixelCount()							gdispGGetPixelCount(GDISP)
+
+	/**
+	 * @brief   Reset the count of pixels written to the display.
+	 * @pre		GDISP_NEED_PIXELCOUNT must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 *
+	 * @api
+	 */
+	void gdispGResetPixelCount(GDisplay *g);
+	#define gdispResetPixelCount()							gdispGResetPixelCount(GDISP)
+#endif
+
+#if GDISP_NEED_DISPLAYLIST || defined(__DOXYGEN__)
+	/**
+	 * @brief   Initialise an empty display list.
+	 * @pre		GDISP_NEED_DISPLAYLIST must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] pl		The display list
+	 *
+	 * @api
+	 */
+	void gdispListInit(gdispList *pl);
+
+	/**
+	 * @brief   Empty a display list and free its memory.
+	 * @pre		GDISP_NEED_DISPLAYLIST must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] pl		The display list
+	 *
+	 * @note	The list must not be being recorded into.
+	 *
+	 * @api
+	 */
+	void gdispListClear(gdispList *pl);
+
+	/**
+	 * @brief   Record drawing on a display into a display list instead of drawing it.
+	 * @pre		GDISP_NEED_DISPLAYLIST must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] pl		The display list. The drawing is added to the end of anything already in it.
+	 *
+	 * @note	Drawing is recorded after it has been clipped so the clip area when recording
+	 * 			limits what is recorded. @p gdispGClear() is recorded as a fill of the display.
+	 * @note	Reading a pixel returns what has been recorded for it, or what is on the display
+	 * 			if nothing recorded covers it. Anti-aliased drawing can't read the list to blend with
+	 * 			so it uses the nearest of opaque or transparent.
+	 * @note	Scrolling, @p gdispGCopyArea() and streaming can't be recorded. While recording they
+	 * 			do nothing, @p gdispGCopyArea() returns gFalse and @p gdispGListStop() will return gFalse.
+	 * @note	Consecutive fills of the same color that together make a rectangle are recorded as one fill.
+	 *
+	 * @api
+	 */
+	void gdispGListStart(GDisplay *g, gdispList *pl);
+	#define gdispListStart(pl)								gdispGListStart(GDISP,pl)
+
+	/**
+	 * @brief   Stop recording drawing on a display.
+	 * @pre		GDISP_NEED_DISPLAYLIST must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 *
+	 * @return	gFalse if memory ran out or a scroll, copy or stream was attempted. Some of the drawing is missing from the list.
+	 *
+	 * @api
+	 */
+	gBool gdispGListStop(GDisplay *g);
+	#define gdispListStop()									gdispGListStop(GDISP)
+
+	/**
+	 * @brief   Make a display list faster to draw.
+	 * @pre		GDISP_NEED_DISPLAYLIST must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] pl		The display list
+	 *
+	 * @note	Operations that are completely covered by later ones are dropped and
+	 * 			the fills left next to each other are joined where possible.
+	 * @note	This takes time proportional to the square of the number of operations
+	 * 			so it is best done once for a list that is drawn many times.
+	 *
+	 * @api
+	 */
+	void gdispListOptimize(gdispList *pl);
+
+	/**
+	 * @brief   Draw a display list.
+	 * @pre		GDISP_NEED_DISPLAYLIST must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use. This can be a different display or a pixmap.
+	 * @param[in] pl		The display list
+	 * @param[in] x,y		The start position of the area to draw
+	 * @param[in] cx,cy		The size of the area to draw
+	 *
+	 * @note	Only the operations within the area are drawn and they are clipped to it.
+	 * 			Everything is also clipped to the clip area of the display as normal.
+	 * @note	The list is drawn at the coordinates it was recorded at.
+	 *
+	 * @api
+	 */
+	void gdispGListDraw(GDisplay *g, const gdispList *pl, gCoord x, gCoord y, gCoord cx, gCoord cy);
+	#define gdispListDraw(pl,x,y,cx,cy)						gdispGListDraw(GDISP,pl,x,y,cx,cy)
+#endif
+
+#if GDISP_NEED_LIST_TILES || defined(__DOXYGEN__)
+	/**
+	 * @brief   Draw a display list one tile at a time.
+	 * @pre		GDISP_NEED_LIST_TILES must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use. This can be a different display or a pixmap.
+	 * @param[in] pl		The display list
+	 * @param[in] x,y		The start position of the area to draw
+	 * @param[in] cx,cy		The size of the area to draw
+	 *
+	 * @note	The area is split into GDISP_LIST_TILE_WIDTH x GDISP_LIST_TILE_HEIGHT tiles. The operations
+	 * 			touching each row of tiles are collected first and then each tile is built in a buffer and
+	 * 			sent to the display as a single blit. On a streaming controller that is one write burst per
+	 * 			tile and every pixel is written once whatever the overdraw in the list.
+	 * @note	The parts of a tile nothing in the list draws on are left alone. They are sent row by row.
+	 * @note	If the tile buffer can't be allocated the list is drawn normally.
+	 *
+	 * @api
+	 */
+	void gdispGListDrawTiled(GDisplay *g, const gdispList *pl, gCoord x, gCoord y, gCoord cx, gCoord cy);
+	#define gdispListDrawTiled(pl,x,y,cx,cy)				gdispGListDrawTiled(GDISP,pl,x,y,cx,cy)
+#endif
+
 /* Circle Functions */
 
 #if GDISP_NEED_CIRCLE || defined(__DOXYGEN__)
@@ -775,6 +1293,9 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	 * @return  The color of the pixel.
 	 * @pre		GDISP_NEED_PIXELREAD must be GFXON in your gfxconf.h
 	 *
+	 * @note	While recording a display list this returns the color recorded for the pixel
+	 * 			if there is one.
+	 *
 	 * @param[in] g 		The display to use
 	 * @param[in] x,y		The position of the pixel
 	 *
@@ -784,7 +1305,7 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	#define gdispGetPixelColor(x,y)							gdispGGetPixelColor(GDISP,x,y)
 #endif
 
-/* Scrolling Function - clears the area scrolled out */
+/* Scrolling Functions */
 
 #if GDISP_NEED_SCROLL || defined(__DOXYGEN__)
 	/**
@@ -792,6 +1313,8 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	 * @pre		GDISP_NEED_SCROLL must be set to GFXON in gfxconf.h
 	 * @note    Optional.
 	 * @note    If lines is >= cy, it is equivelent to an area fill with bgcolor.
+	 * @note	Scrolling can't be recorded in a display list. While recording nothing is
+	 * 			scrolled and the recording is marked as incomplete.
 	 *
 	 * @param[in] g 		The display to use
 	 * @param[in] x, y		The start of the area to be scrolled
@@ -803,6 +1326,33 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	 */
 	void gdispGVerticalScroll(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, int lines, gColor bgcolor);
 	#define gdispVerticalScroll(x,y,cx,cy,l,b)				gdispGVerticalScroll(GDISP,x,y,cx,cy,l,b)
+
+	/**
+	 * @brief   Copy a section of the screen to another position on the same screen.
+	 * @pre		GDISP_NEED_SCROLL must be set to GFXON in gfxconf.h
+	 * @note    Optional.
+	 * @note	The source and destination may overlap. Only the destination is clipped, the clip region is ignored.
+	 * 			Any part of the source that is off the display is not copied.
+	 * @note	A purely vertical copy whose source and destination overlap uses the driver's hardware scroll when
+	 * 			it has one. Anything else reads each line into the line buffer and writes it back using the fastest
+	 * 			method the driver supports.
+	 * @note	If the display can scroll but can't read back pixels, an overlapping vertical copy fills the part
+	 * 			of the source not covered by the destination with black. Other copies return gFalse.
+	 *
+	 * @note	A copy can't be recorded in a display list. While recording nothing is
+	 * 			copied, gFalse is returned and the recording is marked as incomplete.
+	 *
+	 * @return	gFalse if the display can't read back pixels (or a display list is being recorded) and so nothing was copied
+	 *
+	 * @param[in] g 			The display to use
+	 * @param[in] x, y			The destination of the copy
+	 * @param[in] cx, cy		The size of the area to be copied
+	 * @param[in] srcx, srcy	The top left corner of the area to be copied
+	 *
+	 * @api
+	 */
+	gBool gdispGCopyArea(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy);
+	#define gdispCopyArea(x,y,cx,cy,sx,sy)					gdispGCopyArea(GDISP,x,y,cx,cy,sx,sy)
 #endif
 
 /* Set driver specific control */
@@ -902,6 +1452,153 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	#define gdispDrawThickLine(x0,y0,x1,y1,c,w,r)			gdispGDrawThickLine(GDISP,x0,y0,x1,y1,c,w,r)
 #endif
 
+#if GDISP_NEED_COMPLEX_POLYGON || defined(__DOXYGEN__)
+	/**
+	 * @brief   Fill a polygon of any shape.
+	 * @details The polygon may be non-convex, may cross itself and may be made of several
+	 * 			contours (eg. a shape with holes in it).
+	 * @pre		GDISP_NEED_COMPLEX_POLYGON must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] tx, ty	Transform all points in pntarray by tx, ty
+	 * @param[in] pntarray	An array of points. The points of each contour follow those of the one before.
+	 * @param[in] cnts		An array of the number of points in each contour
+	 * @param[in] contours	The number of contours
+	 * @param[in] rule		Which parts of the polygon are inside
+	 * @param[in] color		The color to use
+	 *
+	 * @note	With @p gFillRuleEvenOdd a single contour fills the same pixels that
+	 * 			@p gmiscHittestPoly() says are inside. Pixels on an edge are inside.
+	 * @note	Working memory for the edges is allocated while drawing. Nothing is drawn if that fails.
+	 *
+	 * @api
+	 */
+	void gdispGFillPoly(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, const unsigned *cnts, unsigned contours, gFillRule rule, gColor color);
+	#define gdispFillPoly(x,y,p,n,i,r,c)					gdispGFillPoly(GDISP,x,y,p,n,i,r,c)
+#endif
+
+/* Anti-aliased Drawing Functions */
+
+#if GDISP_NEED_ANTIALIAS_SHAPES || defined(__DOXYGEN__)
+	/**
+	 * @brief   Draw an anti-aliased line.
+	 * @pre		GDISP_NEED_ANTIALIAS_SHAPES must be GFXON in your gfxconf.h
+	 *
+	 * @param[in] g 		The display to use
+	 * @param[in] x0,y0		The start position
+	 * @param[in] x1,y1 	The end position
+	 * @param[in] color		The color to use
+	 *
+	 * @note	Horizontal, vertical and 45 degree lines are drawn as for @p gdispGDrawLine().
+	 *
+	 * @api
+	 */
+	void gdispGDrawLineAA(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color);
+	#define gdispDrawLineAA(x0,y0,x1,y1,c)					gdispGDrawLineAA(GDISP,x0,y0,x1,y1,c)
+
+	#if GDISP_NEED_CIRCLE || defined(__DOXYGEN__)
+		/**
+		 * @brief   Draw an anti-aliased circle.
+		 * @pre		GDISP_NEED_ANTIALIAS_SHAPES and GDISP_NEED_CIRCLE must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] x,y		The center of the circle
+		 * @param[in] radius	The radius of the circle
+		 * @param[in] color		The color to use
+		 *
+		 * @api
+		 */
+		void gdispGDrawCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color);
+		#define gdispDrawCircleAA(x,y,r,c)						gdispGDrawCircleAA(GDISP,x,y,r,c)
+
+		/**
+		 * @brief   Draw a filled anti-aliased circle.
+		 * @pre		GDISP_NEED_ANTIALIAS_SHAPES and GDISP_NEED_CIRCLE must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] x,y		The center of the circle
+		 * @param[in] radius	The radius of the circle
+		 * @param[in] color		The color to use
+		 *
+		 * @api
+		 */
+		void gdispGFillCircleAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gColor color);
+		#define gdispFillCircleAA(x,y,r,c)						gdispGFillCircleAA(GDISP,x,y,r,c)
+	#endif
+
+	#if GDISP_NEED_ARC || defined(__DOXYGEN__)
+		/**
+		 * @brief   Draw an anti-aliased arc.
+		 * @pre		GDISP_NEED_ANTIALIAS_SHAPES and GDISP_NEED_ARC must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 			The display to use
+		 * @param[in] x,y			The center point
+		 * @param[in] radius		The radius of the arc
+		 * @param[in] startangle	The start angle (0 to 360)
+		 * @param[in] endangle		The end angle (0 to 360)
+		 * @param[in] color			The color of the arc
+		 *
+		 * @note	The angles are as for @p gdispGDrawArc().
+		 *
+		 * @api
+		 */
+		void gdispGDrawArcAA(GDisplay *g, gCoord x, gCoord y, gCoord radius, gCoord startangle, gCoord endangle, gColor color);
+		#define gdispDrawArcAA(x,y,r,s,e,c)						gdispGDrawArcAA(GDISP,x,y,r,s,e,c)
+	#endif
+
+	#if GDISP_NEED_CONVEX_POLYGON || defined(__DOXYGEN__)
+		/**
+		 * @brief   Draw an enclosed anti-aliased polygon (convex, non-convex or complex).
+		 * @pre		GDISP_NEED_ANTIALIAS_SHAPES and GDISP_NEED_CONVEX_POLYGON must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] tx, ty	Transform all points in pntarray by tx, ty
+		 * @param[in] pntarray	An array of points
+		 * @param[in] cnt		The number of points in the array
+		 * @param[in] color		The color to use
+		 *
+		 * @api
+		 */
+		void gdispGDrawPolyAA(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color);
+		#define gdispDrawPolyAA(x,y,p,i,c)						gdispGDrawPolyAA(GDISP,x,y,p,i,c)
+
+		/**
+		 * @brief   Fill a convex polygon with anti-aliased edges
+		 * @pre		GDISP_NEED_ANTIALIAS_SHAPES and GDISP_NEED_CONVEX_POLYGON must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] tx, ty	Transform all points in pntarray by tx, ty
+		 * @param[in] pntarray	An array of points
+		 * @param[in] cnt		The number of points in the array
+		 * @param[in] color		The color to use
+		 *
+		 * @note	The polygon is filled as for @p gdispGFillConvexPoly() and then its edges
+		 * 			are drawn with @p gdispGDrawLineAA().
+		 *
+		 * @api
+		 */
+		void gdispGFillConvexPolyAA(GDisplay *g, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt, gColor color);
+		#define gdispFillConvexPolyAA(x,y,p,i,c)				gdispGFillConvexPolyAA(GDISP,x,y,p,i,c)
+
+		/**
+		 * @brief   Draw an anti-aliased line with a specified thickness
+		 * @pre		GDISP_NEED_ANTIALIAS_SHAPES and GDISP_NEED_CONVEX_POLYGON must be GFXON in your gfxconf.h
+		 * @note	Uses gdispGFillConvexPolyAA() internally to perform the drawing.
+		 *
+		 * @param[in] g			The display to use
+		 * @param[in] x0,y0		The start position
+		 * @param[in] x1,y1		The end position
+		 * @param[in] color		The color to use
+		 * @param[in] width		The width of the line
+		 * @param[in] round		Use round ends for the line
+		 *
+		 * @api
+		 */
+		void gdispGDrawThickLineAA(GDisplay *g, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gColor color, gCoord width, gBool round);
+		#define gdispDrawThickLineAA(x0,y0,x1,y1,c,w,r)			gdispGDrawThickLineAA(GDISP,x0,y0,x1,y1,c,w,r)
+	#endif
+#endif
+
 /* Text Functions */
 
 #if GDISP_NEED_TEXT || defined(__DOXYGEN__)
@@ -1003,6 +1700,49 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	void gdispGFillStringBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gFont font, gColor color, gColor bgColor, gJustify justify);
 	#define	gdispFillStringBox(x,y,cx,cy,s,f,c,b,j)			gdispGFillStringBox(GDISP,x,y,cx,cy,s,f,c,b,j)
 
+	#if GDISP_NEED_TEXT_BATCH || defined(__DOXYGEN__)
+		/**
+		 * @brief	Flags for a @p gdispStringItem
+		 */
+		#define gStringItemDraw		0x00		/**< Draw the text only (the default) */
+		#define gStringItemFill		0x01		/**< Fill the background with bgcolor */
+
+		/**
+		 * @brief	One string to render with @p gdispGDrawStringBatch()
+		 * @note	If cx or cy is <= 0 the string is drawn at (x,y) just like @p gdispGDrawString()
+		 *			or @p gdispGFillString() and justify is ignored. Otherwise it is drawn like
+		 *			@p gdispGDrawStringBox() or @p gdispGFillStringBox().
+		 */
+		typedef struct gdispStringItem {
+			gCoord			x, y;		/**< The position */
+			gCoord			cx, cy;		/**< The box size (or 0) */
+			const char *	str;		/**< The string. A NULL string is skipped. */
+			gFont			font;		/**< The font. A NULL font is skipped. */
+			gColor			color;		/**< The text color */
+			gColor			bgcolor;	/**< The background color (if gStringItemFill) */
+			gJustify		justify;	/**< The justification (boxes only) */
+			gU8				flags;		/**< gStringItemDraw or gStringItemFill */
+		} gdispStringItem;
+
+		/**
+		 * @brief	Draw many strings with a single display lock and a single flush.
+		 * @return	The number of system ticks taken to render the batch
+		 * @pre		GDISP_NEED_TEXT and GDISP_NEED_TEXT_BATCH must be GFXON in your gfxconf.h
+		 * @note	If keeporder is gFalse all the items that use the same font are rendered
+		 *			together (in the order of the first item using each font). Overlapping items
+		 *			with different fonts may then be drawn in a different order to the array.
+		 *
+		 * @param[in] g 		The display to use
+		 * @param[in] items		The array of strings to draw
+		 * @param[in] count		The number of items in the array
+		 * @param[in] keeporder	Render strictly in array order rather than grouping by font
+		 *
+		 * @api
+		 */
+		gTicks gdispGDrawStringBatch(GDisplay *g, const gdispStringItem *items, unsigned count, gBool keeporder);
+		#define	gdispDrawStringBatch(i,n,k)				gdispGDrawStringBatch(GDISP,i,n,k)
+	#endif
+
 	/**
 	 * @brief   Get a metric of a font.
 	 * @return  The metric requested in pixels.
@@ -1113,6 +1853,60 @@ void gdispGDrawBox(GDisplay *g, gCoord x, gCoord y, gCoord cx, gCoord cy, gColor
 	 * @api
 	 */
 	gBool gdispAddFont(gFont font);
+
+	#if GDISP_NEED_TTF || defined(__DOXYGEN__)
+		#if GDISP_TTF_USE_FREETYPE || defined(__DOXYGEN__)
+			/**
+			 * @brief	Open a TrueType font file and rasterize it at run-time.
+			 * @details	Glyphs are rasterized on first use and cached in RAM. Use @p gdispCloseFont() to release the font.
+			 * @return	A new font or NULL if the file could not be opened or loaded or the height is out of range.
+			 * @pre		GDISP_NEED_TTF and GDISP_TTF_USE_FREETYPE must be GFXON in your gfxconf.h
+			 *
+			 * @param[in] filename	The TrueType (or other FreeType supported) font file.
+			 * @param[in] height	The requested pixel height of the font (1 to 255).
+			 *
+			 * @api
+			 */
+			gFont gdispOpenTTFFont(const char *filename, gCoord height);
+		#endif
+
+		/**
+		 * @brief	Open a pre-rasterized glyph atlas previously saved with @p gdispSaveTTFAtlas().
+		 * @details	No rasterizer is required. Characters not in the atlas draw as the fallback character.
+		 * @return	A new font or NULL if the file could not be opened or is not a valid atlas.
+		 * @pre		GDISP_NEED_TTF must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] filename	The atlas file.
+		 *
+		 * @api
+		 */
+		gFont gdispOpenTTFAtlas(const char *filename);
+
+		/**
+		 * @brief	Save all currently cached glyphs of a run-time TrueType font to an atlas file.
+		 * @return	gTrue on success.
+		 * @pre		GDISP_NEED_TTF must be GFXON in your gfxconf.h
+		 * @note	Use @p gdispCacheTTFGlyphs() first to make sure every glyph you need is in the atlas.
+		 *
+		 * @param[in] font		A font opened with @p gdispOpenTTFFont() or @p gdispOpenTTFAtlas().
+		 * @param[in] filename	The atlas file to create.
+		 *
+		 * @api
+		 */
+		gBool gdispSaveTTFAtlas(gFont font, const char *filename);
+
+		/**
+		 * @brief	Pre-rasterize the glyphs for every character in a string.
+		 * @return	The number of characters that now have a cached glyph.
+		 * @pre		GDISP_NEED_TTF must be GFXON in your gfxconf.h
+		 *
+		 * @param[in] font		A font opened with @p gdispOpenTTFFont() or @p gdispOpenTTFAtlas().
+		 * @param[in] str		The characters to cache.
+		 *
+		 * @api
+		 */
+		unsigned gdispCacheTTFGlyphs(gFont font, const char *str);
+	#endif
 #endif
 
 /* Extra Arc Functions */
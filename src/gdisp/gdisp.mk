@@ -5,7 +5,9 @@
 
 GFXSRC +=   $(GFXLIB)/src/gdisp/gdisp.c \
 			$(GFXLIB)/src/gdisp/gdisp_fonts.c \
+			$(GFXLIB)/src/gdisp/gdisp_fonts_ttf.c \
 			$(GFXLIB)/src/gdisp/gdisp_pixmap.c \
+			$(GFXLIB)/src/gdisp/gdisp_kernels.c \
 			$(GFXLIB)/src/gdisp/gdisp_image.c \
 			$(GFXLIB)/src/gdisp/gdisp_image_native.c \
 			$(GFXLIB)/src/gdisp/gdisp_image_gif.c \
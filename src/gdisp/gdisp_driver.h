@@ -341,10 +341,27 @@ struct GDisplay {
 		gMutex				mutex;
 	#endif
 
+	// The display this is a draw context for (NULL for the display itself)
+	#if GDISP_NEED_DRAWCONTEXT
+		struct GDisplay *		parent;
+	#endif
+
 	// Software clipping
 	#if GDISP_HARDWARE_CLIP != GFXON && (GDISP_NEED_CLIP || GDISP_NEED_VALIDATION)
 		gCoord					clipx0, clipy0;
 		gCoord					clipx1, clipy1;		/* not inclusive */
+		#if GDISP_NEED_CLIP_REGION
+			gBool					useregion;			// Is clipregion applied on top of the clip area
+			gdispRegion				clipregion;
+		#endif
+	#endif
+
+	#if GDISP_NEED_PIXELCOUNT
+		gU32					pixelcount;
+	#endif
+
+	#if GDISP_NEED_DISPLAYLIST
+		gdispList *				list;				// Drawing is being recorded into this display list
 	#endif
 
 	// Driver call parameters
@@ -373,7 +390,7 @@ struct GDisplay {
 			#endif
 		} t;
 	#endif
-	#if GDISP_LINEBUF_SIZE != 0 && ((GDISP_NEED_SCROLL && !GDISP_HARDWARE_SCROLL) || (!GDISP_HARDWARE_STREAM_WRITE && GDISP_HARDWARE_BITFILLS))
+	#if GDISP_LINEBUF_SIZE != 0 && ((GDISP_NEED_SCROLL && (GDISP_HARDWARE_SCROLL != GFXON || GDISP_HARDWARE_STREAM_READ || GDISP_HARDWARE_PIXELREAD)) || (GDISP_HARDWARE_STREAM_WRITE != GFXON && GDISP_HARDWARE_BITFILLS))
 		// A pixel line buffer
 		gColor		linebuf[GDISP_LINEBUF_SIZE];
 	#endif
@@ -383,6 +400,7 @@ typedef struct GDISPVMT {
 	GDriverVMT	d;
 		#define GDISP_VFLG_DYNAMICONLY		0x0001		// This display should never be statically initialised
 		#define GDISP_VFLG_PIXMAP			0x0002		// This is a pixmap display
+		#define GDISP_VFLG_CONCURRENT		0x0004		// Draw contexts may call the driver at the same time (memory based displays)
 	gBool (*init)(GDisplay *g);
 	void (*deinit)(GDisplay *g);
 	void (*writestart)(GDisplay *g);				// Uses p.x,p.y  p.cx,p.cy
@@ -737,7 +755,7 @@ typedef struct GDISPVMT {
 	 * However, some major C compilers complain about duplicate const specifiers although this is perfectly valid standard C.
 	 */
 	const GDISPVMT GDISP_DRIVER_VMT[1] = {{
-		{ GDRIVER_TYPE_DISPLAY, 0, sizeof(GDisplay), _gdispInitDriver, _gdispPostInitDriver, _gdispDeInitDriver },
+		{ GDRIVER_TYPE_DISPLAY, GDISP_DRIVER_VMT_FLAGS, sizeof(GDisplay), _gdispInitDriver, _gdispPostInitDriver, _gdispDeInitDriver },
 		gdisp_lld_init,
 		#if GDISP_HARDWARE_DEINIT
 			gdisp_lld_deinit,
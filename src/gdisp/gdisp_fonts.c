@@ -13,6 +13,11 @@
 
 #define FONT_FLAG_DYNAMIC	0x80		// Custom flag to indicate dynamically allocated font
 #define FONT_FLAG_UNLISTED	0x40		// Custom flag to indicate font is not currently listed
+#define FONT_FLAG_TTF		0x20		// Custom flag to indicate a runtime TrueType font (see gdisp_fonts_ttf.c)
+
+#if GDISP_NEED_TTF
+	extern void _gdispCloseTTFFont(gFont font);
+#endif
 
 static const struct mf_font_list_s *fontList;
 
@@ -66,6 +71,12 @@ gFont gdispOpenFont(const char *name) {
 
 void gdispCloseFont(gFont font) {
 	if ((font->flags & (FONT_FLAG_DYNAMIC|FONT_FLAG_UNLISTED)) == (FONT_FLAG_DYNAMIC|FONT_FLAG_UNLISTED)) {
+		/* Release any glyph cache */
+		#if GDISP_NEED_TTF
+			if ((font->flags & FONT_FLAG_TTF))
+				_gdispCloseTTFFont(font);
+		#endif
+
 		/* Make sure that no-one can successfully use font after closing */
 		((struct mf_font_s *)font)->render_character = 0;
 		
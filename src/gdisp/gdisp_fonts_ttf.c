@@ -0,0 +1,490 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+/*
+ * Runtime TrueType fonts.
+ *
+ * Glyphs are rasterized on demand (using FreeType) the first time they are used
+ * and are then kept in a per-font glyph cache. The cache can be written to a
+ * glyph atlas file which can later be opened without FreeType at all.
+ */
+
+#include "../../gfx.h"
+
+#if GFX_USE_GDISP && GDISP_NEED_TEXT && GDISP_NEED_TTF
+
+#include "mcufont/mcufont.h"
+#include <string.h>
+
+#if GDISP_TTF_USE_FREETYPE
+	#include <ft2build.h>
+	#include FT_FREETYPE_H
+#endif
+
+// These must match the custom font flags in gdisp_fonts.c
+#define FONT_FLAG_DYNAMIC	0x80
+#define FONT_FLAG_UNLISTED	0x40
+#define FONT_FLAG_TTF		0x20
+
+#define TTF_HASH_SIZE		64				// Must be a power of 2
+#define TTF_HASH(c)			((c) & (TTF_HASH_SIZE-1))
+
+#define TTF_ATLAS_MAGIC		"uGFXTTF"
+#define TTF_ATLAS_VERSION	2				// Version 1 saved the glyph offsets as single bytes
+
+typedef struct ttfGlyph {
+	struct ttfGlyph *	next;				// The next glyph in this hash bucket
+	gU16				code;				// The unicode character
+	gU8					advance;			// The tracking width
+	gI16				left;				// Offset of the bitmap from the pen position
+	gI16				top;				// Offset of the bitmap from the top of the character box
+	gU8					width;				// Bitmap width
+	gU8					height;				// Bitmap height
+	// Followed by width*height alpha values
+} ttfGlyph;
+#define glyphdata(gl)		((gU8 *)((gl)+1))
+
+typedef struct ttfFont {
+	struct mf_font_s	font;
+	#if GDISP_TTF_USE_FREETYPE
+		FT_Face			face;				// The FreeType face or 0 if opened from an atlas
+		void *			filedata;			// The TTF file contents. FreeType requires this to stay valid.
+	#endif
+	gMutex				mutex;				// Protects the glyph cache and the FreeType face
+	gU16				count;				// Number of glyphs in the cache
+	ttfGlyph *			hash[TTF_HASH_SIZE];
+	// Followed by the full name and the short name strings
+} ttfFont;
+
+#if GDISP_TTF_USE_FREETYPE
+	static FT_Library	ftLib;
+	static unsigned		ftUsers;
+#endif
+
+/*===========================================================================*/
+/* Glyph cache                                                               */
+/*===========================================================================*/
+
+static ttfGlyph *findglyph(const ttfFont *tf, gU16 code) {
+	ttfGlyph *	gl;
+
+	for(gl = tf->hash[TTF_HASH(code)]; gl; gl = gl->next) {
+		if (gl->code == code)
+			return gl;
+	}
+	return 0;
+}
+
+static ttfGlyph *addglyph(ttfFont *tf, gU16 code, gU8 width, gU8 height) {
+	ttfGlyph *	gl;
+
+	if (!(gl = gfxAlloc(sizeof(ttfGlyph) + (gMemSize)width * height)))
+		return 0;
+	gl->code = code;
+	gl->width = width;
+	gl->height = height;
+	gl->next = tf->hash[TTF_HASH(code)];
+	tf->hash[TTF_HASH(code)] = gl;
+	tf->count++;
+	return gl;
+}
+
+static void freeglyphs(ttfFont *tf) {
+	ttfGlyph *	gl;
+	unsigned	i;
+
+	for(i = 0; i < TTF_HASH_SIZE; i++) {
+		while((gl = tf->hash[i])) {
+			tf->hash[i] = gl->next;
+			gfxFree(gl);
+		}
+	}
+	tf->count = 0;
+}
+
+#if GDISP_TTF_USE_FREETYPE
+	static ttfGlyph *rasterize(ttfFont *tf, gU16 code) {
+		FT_GlyphSlot	slot;
+		ttfGlyph *		gl;
+		gU8 *			dst;
+		const gU8 *		src;
+		const gU8 *		row;
+		unsigned		w, h, x, y;
+
+		if (!tf->face || !FT_Get_Char_Index(tf->face, code))
+			return 0;
+
+		#if GDISP_NEED_ANTIALIAS
+			if (FT_Load_Char(tf->face, code, FT_LOAD_RENDER))
+				return 0;
+		#else
+			if (FT_Load_Char(tf->face, code, FT_LOAD_RENDER|FT_LOAD_TARGET_MONO))
+				return 0;
+		#endif
+		slot = tf->face->glyph;
+
+		// Our glyph sizes are 8 bits so clip anything bigger
+		w = slot->bitmap.width;		if (w > 255) w = 255;
+		h = slot->bitmap.rows;		if (h > 255) h = 255;
+
+		if (!(gl = addglyph(tf, code, w, h)))
+			return 0;
+		x = (slot->advance.x + 32) >> 6;
+		gl->advance = x > 255 ? 255 : x;
+		gl->left = slot->bitmap_left;
+		gl->top = tf->font.baseline_y - slot->bitmap_top;
+
+		// Convert to 8 bit alpha. A negative pitch means the rows are stored bottom up.
+		row = slot->bitmap.buffer;
+		if (slot->bitmap.pitch < 0)
+			row -= (long)(slot->bitmap.rows - 1) * slot->bitmap.pitch;
+		dst = glyphdata(gl);
+		for(y = 0; y < h; y++, row += slot->bitmap.pitch) {
+			src = row;
+			if (slot->bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
+				for(x = 0; x < w; x++)
+					*dst++ = (src[x>>3] & (0x80 >> (x & 7))) ? 255 : 0;
+			} else {
+				memcpy(dst, src, w);
+				dst += w;
+			}
+		}
+		return gl;
+	}
+#else
+	#define rasterize(tf, code)		0
+#endif
+
+// Glyphs are only freed when the font is closed so the glyph stays valid after the mutex is released
+static ttfGlyph *getglyph(ttfFont *tf, gU16 code) {
+	ttfGlyph *	gl;
+
+	gfxMutexEnter(&tf->mutex);
+	if (!(gl = findglyph(tf, code)))
+		gl = rasterize(tf, code);
+	gfxMutexExit(&tf->mutex);
+	return gl;
+}
+
+/*===========================================================================*/
+/* mcufont interface                                                         */
+/*===========================================================================*/
+
+static gU8 ttf_character_width(const struct mf_font_s *font, mf_char character) {
+	ttfGlyph *	gl;
+
+	if (!(gl = getglyph((ttfFont *)font, MFCHAR2UINT16(character))))
+		return 0;
+	return gl->advance;
+}
+
+static gU8 ttf_render_character(const struct mf_font_s *font, gI16 x0, gI16 y0, mf_char character, mf_pixel_callback_t callback, void *state) {
+	ttfGlyph *	gl;
+	const gU8 *	p;
+	gU8			x, y, cnt;
+
+	if (!(gl = getglyph((ttfFont *)font, MFCHAR2UINT16(character))))
+		return 0;
+
+	// Send runs of equal alpha to the callback
+	x0 += gl->left;
+	y0 += gl->top;
+	p = glyphdata(gl);
+	for(y = 0; y < gl->height; y++) {
+		for(x = 0; x < gl->width; x += cnt) {
+			for(cnt = 1; x+cnt < gl->width && p[cnt] == p[0]; cnt++);
+			if (p[0])
+				callback(x0+x, y0+y, cnt, p[0], state);
+			p += cnt;
+		}
+	}
+	return gl->advance;
+}
+
+static ttfFont *newfont(const char *fullname, const char *shortname) {
+	ttfFont *	tf;
+	gMemSize	l1, l2;
+	char *		p;
+
+	l1 = strlen(fullname)+1;
+	l2 = strlen(shortname)+1;
+	if (!(tf = gfxAlloc(sizeof(ttfFont) + l1 + l2)))
+		return 0;
+	memset(tf, 0, sizeof(ttfFont));
+	p = (char *)(tf+1);
+	memcpy(p, fullname, l1);
+	memcpy(p+l1, shortname, l2);
+	tf->font.full_name = p;
+	tf->font.short_name = p+l1;
+	tf->font.fallback_character = '?';
+	tf->font.character_width = ttf_character_width;
+	tf->font.render_character = ttf_render_character;
+	tf->font.flags = FONT_FLAG_DYNAMIC|FONT_FLAG_UNLISTED|FONT_FLAG_TTF;
+	gfxMutexInit(&tf->mutex);
+	return tf;
+}
+
+#if GDISP_TTF_USE_FREETYPE
+	static gU8 clip8(long v) {
+		return v < 0 ? 0 : (v > 255 ? 255 : (gU8)v);
+	}
+#endif
+
+/*===========================================================================*/
+/* External interface                                                        */
+/*===========================================================================*/
+
+#if GDISP_TTF_USE_FREETYPE
+	gFont gdispOpenTTFFont(const char *filename, gCoord height) {
+		GFILE *			f;
+		ttfFont *		tf;
+		void *			data;
+		gMemSize		size;
+		FT_Face			face;
+		const char *	sname;
+		FT_Size_Metrics	*m;
+
+		// The font metrics are 8 bits
+		if (height <= 0 || height > 255)
+			return 0;
+
+		// Read the file into RAM - FreeType needs random access
+		if (!(f = gfileOpen(filename, "rb")))
+			return 0;
+		size = gfileGetSize(f);
+		if (!size || !(data = gfxAlloc(size))) {
+			gfileClose(f);
+			return 0;
+		}
+		if (gfileRead(f, data, size) != size) {
+			gfileClose(f);
+			gfxFree(data);
+			return 0;
+		}
+		gfileClose(f);
+
+		// Open the face
+		if (!ftUsers && FT_Init_FreeType(&ftLib))
+			goto baddata;
+		ftUsers++;
+		if (FT_New_Memory_Face(ftLib, (const FT_Byte *)data, size, 0, &face))
+			goto badlib;
+		if (FT_Set_Pixel_Sizes(face, 0, height))
+			goto badface;
+
+		// The short name is the file name without the path
+		for(sname = filename + strlen(filename); sname > filename && sname[-1] != '/' && sname[-1] != '\\'; sname--);
+		if (!(tf = newfont(face->family_name ? face->family_name : sname, sname)))
+			goto badface;
+		tf->face = face;
+		tf->filedata = data;
+
+		// Fill in the font metrics
+		m = &face->size->metrics;
+		tf->font.baseline_y = clip8((m->ascender + 63) >> 6);
+		tf->font.height = clip8(tf->font.baseline_y + ((-m->descender + 63) >> 6));
+		tf->font.line_height = clip8((m->height + 32) >> 6);
+		tf->font.width = tf->font.max_x_advance = clip8((m->max_advance + 32) >> 6);
+		tf->font.min_x_advance = ttf_character_width(&tf->font, ' ');
+		if (FT_IS_FIXED_WIDTH(face))
+			tf->font.flags |= MF_FONT_FLAG_MONOSPACE;
+		#if !GDISP_NEED_ANTIALIAS
+			tf->font.flags |= MF_FONT_FLAG_BW;
+		#endif
+		return &tf->font;
+
+	badface:
+		FT_Done_Face(face);
+	badlib:
+		if (!--ftUsers)
+			FT_Done_FreeType(ftLib);
+	baddata:
+		gfxFree(data);
+		return 0;
+	}
+#endif
+
+gFont gdispOpenTTFAtlas(const char *filename) {
+	GFILE *		f;
+	ttfFont *	tf;
+	ttfGlyph *	gl;
+	gU8			hdr[18];
+	gU8			len;
+	char		names[2][256];
+	unsigned	cnt, i, j, rec;
+
+	if (!(f = gfileOpen(filename, "rb")))
+		return 0;
+	tf = 0;
+
+	// Check the header
+	if (gfileRead(f, hdr, 18) != 18 || memcmp(hdr, TTF_ATLAS_MAGIC, 7) || !hdr[7] || hdr[7] > TTF_ATLAS_VERSION)
+		goto baddata;
+	rec = hdr[7] == 1 ? 7 : 9;
+
+	// Read the names
+	for(i = 0; i < 2; i++) {
+		if (gfileRead(f, &len, 1) != 1 || gfileRead(f, names[i], len) != len)
+			goto baddata;
+		names[i][len] = 0;
+	}
+	if (!(tf = newfont(names[0], names[1])))
+		goto baddata;
+
+	// Read the metrics
+	tf->font.width = hdr[8];
+	tf->font.height = hdr[9];
+	tf->font.min_x_advance = hdr[10];
+	tf->font.max_x_advance = hdr[11];
+	tf->font.baseline_x = (gI8)hdr[12];
+	tf->font.baseline_y = hdr[13];
+	tf->font.line_height = hdr[14];
+	tf->font.flags |= hdr[15] & (MF_FONT_FLAG_MONOSPACE|MF_FONT_FLAG_BW);
+	tf->font.fallback_character = hdr[16] | (hdr[17] << 8);
+
+	// Read the glyphs
+	if (gfileRead(f, hdr, 2) != 2)
+		goto baddata;
+	cnt = hdr[0] | (hdr[1] << 8);
+	for(i = 0; i < cnt; i++) {
+		if (gfileRead(f, hdr, rec) != rec)
+			goto baddata;
+		if (rec == 7) {
+			if (!(gl = addglyph(tf, hdr[0] | (hdr[1] << 8), hdr[5], hdr[6])))
+				goto baddata;
+			gl->left = (gI8)hdr[3];
+			gl->top = (gI8)hdr[4];
+		} else {
+			if (!(gl = addglyph(tf, hdr[0] | (hdr[1] << 8), hdr[7], hdr[8])))
+				goto baddata;
+			gl->left = (gI16)(hdr[3] | (hdr[4] << 8));
+			gl->top = (gI16)(hdr[5] | (hdr[6] << 8));
+		}
+		gl->advance = hdr[2];
+		j = (unsigned)gl->width * gl->height;
+		if (gfileRead(f, glyphdata(gl), j) != j)
+			goto baddata;
+	}
+	gfileClose(f);
+	return &tf->font;
+
+baddata:
+	if (tf) {
+		freeglyphs(tf);
+		gfxMutexDestroy(&tf->mutex);
+		gfxFree(tf);
+	}
+	gfileClose(f);
+	return 0;
+}
+
+gBool gdispSaveTTFAtlas(gFont font, const char *filename) {
+	ttfFont *		tf;
+	const ttfGlyph *gl;
+	GFILE *			f;
+	gU8				hdr[18];
+	gMemSize		l;
+	unsigned		i, j;
+
+	if (!font || !(font->flags & FONT_FLAG_TTF))
+		return gFalse;
+	tf = (ttfFont *)font;
+	if (!(f = gfileOpen(filename, "wb")))
+		return gFalse;
+
+	// Stop glyphs being added while the cache is written
+	gfxMutexEnter(&tf->mutex);
+
+	// The header and metrics
+	memcpy(hdr, TTF_ATLAS_MAGIC, 7);
+	hdr[7] = TTF_ATLAS_VERSION;
+	hdr[8] = font->width;
+	hdr[9] = font->height;
+	hdr[10] = font->min_x_advance;
+	hdr[11] = font->max_x_advance;
+	hdr[12] = (gU8)font->baseline_x;
+	hdr[13] = font->baseline_y;
+	hdr[14] = font->line_height;
+	hdr[15] = font->flags & (MF_FONT_FLAG_MONOSPACE|MF_FONT_FLAG_BW);
+	hdr[16] = font->fallback_character;
+	hdr[17] = font->fallback_character >> 8;
+	if (gfileWrite(f, hdr, 18) != 18)
+		goto badwrite;
+
+	// The names
+	for(i = 0; i < 2; i++) {
+		l = strlen(i ? font->short_name : font->full_name);
+		if (l > 255) l = 255;
+		hdr[0] = l;
+		if (gfileWrite(f, hdr, 1) != 1 || gfileWrite(f, i ? font->short_name : font->full_name, l) != l)
+			goto badwrite;
+	}
+
+	// The glyphs
+	hdr[0] = tf->count;
+	hdr[1] = tf->count >> 8;
+	if (gfileWrite(f, hdr, 2) != 2)
+		goto badwrite;
+	for(i = 0; i < TTF_HASH_SIZE; i++) {
+		for(gl = tf->hash[i]; gl; gl = gl->next) {
+			hdr[0] = gl->code;
+			hdr[1] = gl->code >> 8;
+			hdr[2] = gl->advance;
+			hdr[3] = (gU8)gl->left;
+			hdr[4] = (gU8)((gU16)gl->left >> 8);
+			hdr[5] = (gU8)gl->top;
+			hdr[6] = (gU8)((gU16)gl->top >> 8);
+			hdr[7] = gl->width;
+			hdr[8] = gl->height;
+			j = (unsigned)gl->width * gl->height;
+			if (gfileWrite(f, hdr, 9) != 9 || gfileWrite(f, glyphdata(gl), j) != j)
+				goto badwrite;
+		}
+	}
+	gfxMutexExit(&tf->mutex);
+	gfileClose(f);
+	return gTrue;
+
+badwrite:
+	gfxMutexExit(&tf->mutex);
+	gfileClose(f);
+	gfileDelete(filename);
+	return gFalse;
+}
+
+unsigned gdispCacheTTFGlyphs(gFont font, const char *str) {
+	ttfFont *	tf;
+	mf_char		c;
+	unsigned	cnt;
+
+	if (!font || !str || !(font->flags & FONT_FLAG_TTF))
+		return 0;
+	tf = (ttfFont *)font;
+	for(cnt = 0; (c = mf_getchar(&str)); ) {
+		if (getglyph(tf, MFCHAR2UINT16(c)))
+			cnt++;
+	}
+	return cnt;
+}
+
+void _gdispCloseTTFFont(gFont font) {
+	ttfFont *	tf;
+
+	tf = (ttfFont *)font;
+	freeglyphs(tf);
+	gfxMutexDestroy(&tf->mutex);
+	#if GDISP_TTF_USE_FREETYPE
+		if (tf->face) {
+			FT_Done_Face(tf->face);
+			gfxFree(tf->filedata);
+			if (!--ftUsers)
+				FT_Done_FreeType(ftLib);
+		}
+	#endif
+}
+
+#endif /* GFX_USE_GDISP && GDISP_NEED_TEXT && GDISP_NEED_TTF */
@@ -579,18 +579,23 @@ static gCoord getPixels(gImage *img, gCoord x) {
 	#endif
 	#if GDISP_NEED_IMAGE_BMP_8
 		{
-			gU8		b[4];
+			gU8		b[16];
+			gCoord	n;
 
 			while(x < img->width && len <= GDISP_IMAGE_BMP_BLIT_BUFFER_SIZE-4) {
-				if (gfileRead(img->f, &b, 4) != 4)
+				// Lines are padded to 4 bytes so always read a multiple of 4 pixels
+				n = (img->width - x + 3) & ~3;
+				if (n > GDISP_IMAGE_BMP_BLIT_BUFFER_SIZE-len)
+					n = (GDISP_IMAGE_BMP_BLIT_BUFFER_SIZE-len) & ~3;
+				if (n > (gCoord)sizeof(b))
+					n = sizeof(b);
+				if (gfileRead(img->f, b, n) != (gMemSize)n)
 					return 0;
 
-				*pc++ = priv->palette[b[0]];
-				*pc++ = priv->palette[b[1]];
-				*pc++ = priv->palette[b[2]];
-				*pc++ = priv->palette[b[3]];
-				len += 4;
-				x += 4;
+				gdispPaletteToColors(pc, b, n, priv->palette);
+				pc += n;
+				len += n;
+				x += n;
 			}
 			return len;
 		}
@@ -646,14 +651,21 @@ static gCoord getPixels(gImage *img, gCoord x) {
 #if GDISP_NEED_IMAGE_BMP_24
 	case 24:
 		{
-		gU8		b[3];
+		gU8		b[3*16];
+		gCoord	n;
 
 			while(x < img->width && len < GDISP_IMAGE_BMP_BLIT_BUFFER_SIZE) {
-				if (gfileRead(img->f, &b, 3) != 3)
+				n = img->width - x;
+				if (n > GDISP_IMAGE_BMP_BLIT_BUFFER_SIZE-len)
+					n = GDISP_IMAGE_BMP_BLIT_BUFFER_SIZE-len;
+				if (n > (gCoord)sizeof(b)/3)
+					n = sizeof(b)/3;
+				if (gfileRead(img->f, b, n*3) != (gMemSize)n*3)
 					return 0;
-				*pc++ = RGB2COLOR(b[2], b[1], b[0]);
-				x++;
-				len++;
+				gdispBGR888ToColors(pc, b, n);
+				pc += n;
+				x += n;
+				len += n;
 			}
 
 			if (x >= img->width) {
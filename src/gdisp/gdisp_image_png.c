@@ -71,6 +71,10 @@ typedef struct PNG_output {
 	gCoord		ix, iy;
 	unsigned	cnt;
 	gPixel		buf[GDISP_IMAGE_PNG_BLIT_BUFFER_SIZE];
+	#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+		gU8		alpha[GDISP_IMAGE_PNG_BLIT_BUFFER_SIZE];
+		gBool	blend;							// Some pixels in the buffer are partially transparent
+	#endif
 	} PNG_output;
 
 // Handle the PNG scan line filter
@@ -208,10 +212,22 @@ static void PNG_oInit(PNG_output *o, GDisplay *g, gCoord x, gCoord y, gCoord cx,
 	o->sy = sy;
 	o->ix = o->iy = 0;
 	o->cnt = 0;
+	#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+		o->blend = gFalse;
+	#endif
 }
 
 // Flush the output buffer to the display
 static void PNG_oFlush(PNG_output *o) {
+	#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+		if (o->blend) {
+			gdispGBlitAreaAlpha(o->g, o->x+o->ix-o->sx, o->y+o->iy-o->sy, o->cnt, 1, 0, 0, o->cnt, o->buf, o->alpha);
+			o->blend = gFalse;
+			o->ix += o->cnt;
+			o->cnt = 0;
+			return;
+		}
+	#endif
 	switch(o->cnt) {
 	case 0:		return;
 	case 1:		gdispGDrawPixel(o->g, o->x+o->ix-o->sx, o->y+o->iy-o->sy, o->buf[0]); 						break;
@@ -245,9 +261,34 @@ static void PNG_oColor(PNG_output *o, gColor c) {
 		PNG_oFlush(o);
 
 	// Save the pixel
+	#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+		o->alpha[o->cnt] = 255;
+	#endif
 	o->buf[o->cnt++] = c;
 }
 
+#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+	// Feed a partially transparent pixel to the display buffer
+	static void PNG_oColorAlpha(PNG_output *o, gColor c, gU8 alpha) {
+		// Is it in the window
+		if (o->ix+(gCoord)o->cnt < o->sx || o->ix+(gCoord)o->cnt >= o->sx+o->cx) {
+			// No - just skip the pixel
+			PNG_oFlush(o);
+			o->ix++;
+			return;
+		}
+
+		// Is the buffer full
+		if (o->cnt >= sizeof(o->buf)/sizeof(o->buf[0]))
+			PNG_oFlush(o);
+
+		// Save the pixel
+		o->alpha[o->cnt] = alpha;
+		o->buf[o->cnt++] = c;
+		o->blend = gTrue;
+	}
+#endif
+
 #if GDISP_NEED_IMAGE_PNG_TRANSPARENCY || GDISP_NEED_IMAGE_PNG_ALPHACLIFF > 0
 	// Feed a transparent pixel to the display buffer
 	static void PNG_oTransparent(PNG_output *o) {
@@ -935,6 +976,12 @@ static gBool PNG_unfilter_type0(PNG_decode *d) {		// PNG filter method 0
 				#define pix_alpha	pinfo->palette[idx+3]
 
 				#if GDISP_NEED_IMAGE_PNG_TRANSPARENCY
+					#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+						if (pix_alpha != 255) {
+							PNG_oColorAlpha(&d->o, pix_color, pix_alpha);
+							continue;
+						}
+					#endif
 					#if GDISP_NEED_IMAGE_PNG_BACKGROUND
 						if (pix_alpha != 255 && (pinfo->flags & PNG_FLG_BACKGROUND)) {
 							PNG_oColor(&d->o, gdispBlendColor(pix_color, pinfo->bg, pix_alpha));
@@ -977,6 +1024,12 @@ static gBool PNG_unfilter_type0(PNG_decode *d) {		// PNG filter method 0
 			#define pix_alpha	pinfo->palette[idx+3]
 
 			#if GDISP_NEED_IMAGE_PNG_TRANSPARENCY
+				#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+					if (pix_alpha != 255) {
+						PNG_oColorAlpha(&d->o, pix_color, pix_alpha);
+						continue;
+					}
+				#endif
 				#if GDISP_NEED_IMAGE_PNG_BACKGROUND
 					if (pix_alpha != 255 && (pinfo->flags & PNG_FLG_BACKGROUND)) {
 						PNG_oColor(&d->o, gdispBlendColor(pix_color, pinfo->bg, pix_alpha));
@@ -1009,6 +1062,12 @@ static gBool PNG_unfilter_type0(PNG_decode *d) {		// PNG filter method 0
 			#define pix_color	LUMA2COLOR(d->f.line[i])
 			#define pix_alpha	d->f.line[i+1]
 
+			#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+				if (pix_alpha != 255) {
+					PNG_oColorAlpha(&d->o, pix_color, pix_alpha);
+					continue;
+				}
+			#endif
 			#if GDISP_NEED_IMAGE_PNG_BACKGROUND
 				if (pix_alpha != 255 && (pinfo->flags & PNG_FLG_BACKGROUND)) {
 					PNG_oColor(&d->o, gdispBlendColor(pix_color, pinfo->bg, pix_alpha));
@@ -1040,6 +1099,12 @@ static gBool PNG_unfilter_type0(PNG_decode *d) {		// PNG filter method 0
 			#define pix_color	LUMA2COLOR(d->f.line[i])
 			#define pix_alpha	d->f.line[i+2]
 
+			#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+				if (pix_alpha != 255) {
+					PNG_oColorAlpha(&d->o, pix_color, pix_alpha);
+					continue;
+				}
+			#endif
 			#if GDISP_NEED_IMAGE_PNG_BACKGROUND
 				if (pix_alpha != 255 && (pinfo->flags & PNG_FLG_BACKGROUND)) {
 					PNG_oColor(&d->o, gdispBlendColor(pix_color, pinfo->bg, pix_alpha));
@@ -1071,6 +1136,12 @@ static gBool PNG_unfilter_type0(PNG_decode *d) {		// PNG filter method 0
 			#define pix_color	RGB2COLOR(d->f.line[i+0], d->f.line[i+1], d->f.line[i+2])
 			#define pix_alpha	d->f.line[i+3]
 
+			#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+				if (pix_alpha != 255) {
+					PNG_oColorAlpha(&d->o, pix_color, pix_alpha);
+					continue;
+				}
+			#endif
 			#if GDISP_NEED_IMAGE_PNG_BACKGROUND
 				if (pix_alpha != 255 && (pinfo->flags & PNG_FLG_BACKGROUND)) {
 					PNG_oColor(&d->o, gdispBlendColor(pix_color, pinfo->bg, pix_alpha));
@@ -1102,6 +1173,12 @@ static gBool PNG_unfilter_type0(PNG_decode *d) {		// PNG filter method 0
 			#define pix_color	RGB2COLOR(d->f.line[i+0], d->f.line[i+2], d->f.line[i+4])
 			#define pix_alpha	d->f.line[i+6]
 
+			#if GDISP_NEED_IMAGE_PNG_ALPHABLEND
+				if (pix_alpha != 255) {
+					PNG_oColorAlpha(&d->o, pix_color, pix_alpha);
+					continue;
+				}
+			#endif
 			#if GDISP_NEED_IMAGE_PNG_BACKGROUND
 				if (pix_alpha != 255 && (pinfo->flags & PNG_FLG_BACKGROUND)) {
 					PNG_oColor(&d->o, gdispBlendColor(pix_color, pinfo->bg, pix_alpha));
@@ -1300,6 +1377,9 @@ gdispImageError gdispImageOpen_PNG(gImage *img) {
 				goto exit_unsupported;
 			}
 
+			// Grayscale with alpha and RGBA carry an alpha channel
+			if (pinfo->mode == PNG_COLORMODE_GRAYALPHA || pinfo->mode == PNG_COLORMODE_RGBA)
+				img->flags |= GDISP_IMAGE_FLG_TRANSPARENT;
 			pinfo->flags |= PNG_FLG_HEADERDONE;
 			break;
 
@@ -1410,6 +1490,7 @@ gdispImageError gdispImageOpen_PNG(gImage *img) {
 					goto exit_unsupported;
 				}
 
+				img->flags |= GDISP_IMAGE_FLG_TRANSPARENT;
 				break;
 		#endif
 
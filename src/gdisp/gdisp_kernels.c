@@ -0,0 +1,346 @@
+/*
+ * This file is subject to the terms of the GFX License. If a copy of
+ * the license was not distributed with this file, you can obtain one at:
+ *
+ *              http://ugfx.io/license.html
+ */
+
+#include "../../gfx.h"
+
+#if GFX_USE_GDISP
+
+/*
+ * Bulk pixel conversion and blending.
+ *
+ * Every function has a portable version built from the color macros. For RGB565 the
+ * compiler's target instruction set is used to work on 8 or 16 pixels at a time.
+ * The SIMD code always gives exactly the same result as the portable code.
+ */
+#if GDISP_NEED_SIMD && GDISP_PIXELFORMAT == GDISP_PIXELFORMAT_RGB565
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define KERNEL_SSE2		GFXON
+		#include <emmintrin.h>
+		#if defined(__SSSE3__) || defined(__AVX2__)
+			#define KERNEL_SSSE3	GFXON
+			#include <tmmintrin.h>
+		#endif
+		#if defined(__AVX2__)
+			#define KERNEL_AVX2		GFXON
+			#include <immintrin.h>
+		#endif
+	#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		#define KERNEL_NEON		GFXON
+		#include <arm_neon.h>
+	#endif
+#endif
+#ifndef KERNEL_SSE2
+	#define KERNEL_SSE2		GFXOFF
+#endif
+#ifndef KERNEL_SSSE3
+	#define KERNEL_SSSE3	GFXOFF
+#endif
+#ifndef KERNEL_AVX2
+	#define KERNEL_AVX2		GFXOFF
+#endif
+#ifndef KERNEL_NEON
+	#define KERNEL_NEON		GFXOFF
+#endif
+
+/*
+ * RGB565 helpers working on 16 bit lanes.
+ * Channels are 0 to 255 and are packed and unpacked exactly as RGB2COLOR() and RED_OF() etc do.
+ */
+#if KERNEL_SSE2
+	static GFXINLINE __m128i sse2Pack565(__m128i r, __m128i g, __m128i b) {
+		return _mm_or_si128(_mm_or_si128(
+					_mm_slli_epi16(_mm_and_si128(r, _mm_set1_epi16(0xF8)), 8),
+					_mm_slli_epi16(_mm_and_si128(g, _mm_set1_epi16(0xFC)), 3)),
+					_mm_srli_epi16(b, 3));
+	}
+	#define sse2Red565(c)		_mm_and_si128(_mm_srli_epi16((c), 8), _mm_set1_epi16(0xF8))
+	#define sse2Green565(c)		_mm_and_si128(_mm_srli_epi16((c), 3), _mm_set1_epi16(0xFC))
+	#define sse2Blue565(c)		_mm_and_si128(_mm_slli_epi16((c), 3), _mm_set1_epi16(0xF8))
+
+	// (fg * (alpha+1) + bg * (256-alpha)) >> 8 can't overflow 16 bits as the ratios add to 257
+	#define sse2Mix(f, b, fr, br)	_mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16((f), (fr)), _mm_mullo_epi16((b), (br))), 8)
+#endif
+
+#if KERNEL_AVX2
+	static GFXINLINE __m256i avx2Pack565(__m256i r, __m256i g, __m256i b) {
+		return _mm256_or_si256(_mm256_or_si256(
+					_mm256_slli_epi16(_mm256_and_si256(r, _mm256_set1_epi16(0xF8)), 8),
+					_mm256_slli_epi16(_mm256_and_si256(g, _mm256_set1_epi16(0xFC)), 3)),
+					_mm256_srli_epi16(b, 3));
+	}
+	#define avx2Red565(c)		_mm256_and_si256(_mm256_srli_epi16((c), 8), _mm256_set1_epi16(0xF8))
+	#define avx2Green565(c)		_mm256_and_si256(_mm256_srli_epi16((c), 3), _mm256_set1_epi16(0xFC))
+	#define avx2Blue565(c)		_mm256_and_si256(_mm256_slli_epi16((c), 3), _mm256_set1_epi16(0xF8))
+	#define avx2Mix(f, b, fr, br)	_mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16((f), (fr)), _mm256_mullo_epi16((b), (br))), 8)
+#endif
+
+#if KERNEL_SSSE3
+	// Gather one channel of 8 packed 24 bit pixels into 16 bit lanes.
+	// a holds bytes 0 to 15 and b holds bytes 8 to 23. o is the offset of the channel within a pixel.
+	static GFXINLINE __m128i ssse3Channel(__m128i a, __m128i b, int o) {
+		return _mm_or_si128(
+			_mm_shuffle_epi8(a, _mm_setr_epi8(o, -1, 3+o, -1, 6+o, -1, 9+o, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+			_mm_shuffle_epi8(b, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 4+o, -1, 7+o, -1, 10+o, -1, 13+o, -1)));
+	}
+#endif
+
+#if KERNEL_NEON
+	static GFXINLINE uint16x8_t neonPack565(uint16x8_t r, uint16x8_t g, uint16x8_t b) {
+		return vorrq_u16(vorrq_u16(
+					vshlq_n_u16(vandq_u16(r, vdupq_n_u16(0xF8)), 8),
+					vshlq_n_u16(vandq_u16(g, vdupq_n_u16(0xFC)), 3)),
+					vshrq_n_u16(b, 3));
+	}
+	#define neonRed565(c)		vandq_u16(vshrq_n_u16((c), 8), vdupq_n_u16(0xF8))
+	#define neonGreen565(c)		vandq_u16(vshrq_n_u16((c), 3), vdupq_n_u16(0xFC))
+	#define neonBlue565(c)		vandq_u16(vshlq_n_u16((c), 3), vdupq_n_u16(0xF8))
+	#define neonMix(f, b, fr, br)	vshrq_n_u16(vmlaq_u16(vmulq_u16((f), (fr)), (b), (br)), 8)
+#endif
+
+void gdispRGB888ToColors(gColor *dst, const gU8 *src, unsigned cnt) {
+	#if KERNEL_SSSE3
+		for(; cnt >= 8; cnt -= 8, src += 24, dst += 8) {
+			__m128i	a = _mm_loadu_si128((const __m128i *)src);
+			__m128i	b = _mm_loadu_si128((const __m128i *)(src+8));
+			_mm_storeu_si128((__m128i *)dst, sse2Pack565(ssse3Channel(a, b, 0), ssse3Channel(a, b, 1), ssse3Channel(a, b, 2)));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, src += 24, dst += 8) {
+			uint8x8x3_t	p = vld3_u8(src);
+			vst1q_u16(dst, neonPack565(vmovl_u8(p.val[0]), vmovl_u8(p.val[1]), vmovl_u8(p.val[2])));
+		}
+	#endif
+	for(; cnt; cnt--, src += 3)
+		*dst++ = RGB2COLOR(src[0], src[1], src[2]);
+}
+
+void gdispBGR888ToColors(gColor *dst, const gU8 *src, unsigned cnt) {
+	#if KERNEL_SSSE3
+		for(; cnt >= 8; cnt -= 8, src += 24, dst += 8) {
+			__m128i	a = _mm_loadu_si128((const __m128i *)src);
+			__m128i	b = _mm_loadu_si128((const __m128i *)(src+8));
+			_mm_storeu_si128((__m128i *)dst, sse2Pack565(ssse3Channel(a, b, 2), ssse3Channel(a, b, 1), ssse3Channel(a, b, 0)));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, src += 24, dst += 8) {
+			uint8x8x3_t	p = vld3_u8(src);
+			vst1q_u16(dst, neonPack565(vmovl_u8(p.val[2]), vmovl_u8(p.val[1]), vmovl_u8(p.val[0])));
+		}
+	#endif
+	for(; cnt; cnt--, src += 3)
+		*dst++ = RGB2COLOR(src[2], src[1], src[0]);
+}
+
+void gdispColorsToRGB888(gU8 *dst, const gColor *src, unsigned cnt) {
+	#if KERNEL_SSSE3
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 24) {
+			__m128i	c = _mm_loadu_si128((const __m128i *)src);
+			__m128i	rg = _mm_packus_epi16(sse2Red565(c), sse2Green565(c));
+			__m128i	bb = _mm_packus_epi16(sse2Blue565(c), sse2Blue565(c));
+
+			_mm_storeu_si128((__m128i *)dst, _mm_or_si128(
+				_mm_shuffle_epi8(rg, _mm_setr_epi8(0, 8, -1, 1, 9, -1, 2, 10, -1, 3, 11, -1, 4, 12, -1, 5)),
+				_mm_shuffle_epi8(bb, _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1))));
+			_mm_storel_epi64((__m128i *)(dst+16), _mm_or_si128(
+				_mm_shuffle_epi8(rg, _mm_setr_epi8(13, -1, 6, 14, -1, 7, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+				_mm_shuffle_epi8(bb, _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1))));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 24) {
+			uint16x8_t	c = vld1q_u16(src);
+			uint8x8x3_t	p;
+
+			p.val[0] = vmovn_u16(neonRed565(c));
+			p.val[1] = vmovn_u16(neonGreen565(c));
+			p.val[2] = vmovn_u16(neonBlue565(c));
+			vst3_u8(dst, p);
+		}
+	#endif
+	for(; cnt; cnt--, src++) {
+		*dst++ = RED_OF(*src);
+		*dst++ = GREEN_OF(*src);
+		*dst++ = BLUE_OF(*src);
+	}
+}
+
+void gdispLumaToColors(gColor *dst, const gU8 *src, unsigned cnt) {
+	#if KERNEL_AVX2
+		for(; cnt >= 16; cnt -= 16, src += 16, dst += 16) {
+			__m256i	l = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)src));
+			_mm256_storeu_si256((__m256i *)dst, avx2Pack565(l, l, l));
+		}
+	#endif
+	#if KERNEL_SSE2
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 8) {
+			__m128i	l = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+			_mm_storeu_si128((__m128i *)dst, sse2Pack565(l, l, l));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 8) {
+			uint16x8_t	l = vmovl_u8(vld1_u8(src));
+			vst1q_u16(dst, neonPack565(l, l, l));
+		}
+	#endif
+	for(; cnt; cnt--, src++)
+		*dst++ = LUMA2COLOR(*src);
+}
+
+void gdispColorsToLuma(gU8 *dst, const gColor *src, unsigned cnt) {
+	#if KERNEL_AVX2
+		for(; cnt >= 16; cnt -= 16, src += 16, dst += 16) {
+			__m256i	c = _mm256_loadu_si256((const __m256i *)src);
+			__m256i	l = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(avx2Red565(c), avx2Blue565(c)), _mm256_slli_epi16(avx2Green565(c), 1)), 2);
+			l = _mm256_packus_epi16(l, l);
+			_mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(_mm256_permute4x64_epi64(l, 0x08)));
+		}
+	#endif
+	#if KERNEL_SSE2
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 8) {
+			__m128i	c = _mm_loadu_si128((const __m128i *)src);
+			__m128i	l = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(sse2Red565(c), sse2Blue565(c)), _mm_slli_epi16(sse2Green565(c), 1)), 2);
+			_mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(l, l));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 8) {
+			uint16x8_t	c = vld1q_u16(src);
+			vst1_u8(dst, vmovn_u16(vshrq_n_u16(vaddq_u16(vaddq_u16(neonRed565(c), neonBlue565(c)), vshlq_n_u16(neonGreen565(c), 1)), 2)));
+		}
+	#endif
+	for(; cnt; cnt--, src++)
+		*dst++ = LUMA_OF(*src);
+}
+
+void gdispPaletteToColors(gColor *dst, const gU8 *src, unsigned cnt, const gColor *palette) {
+	// A table lookup per pixel. None of the supported instruction sets can usefully gather 16 bit values.
+	for(; cnt >= 4; cnt -= 4, src += 4, dst += 4) {
+		dst[0] = palette[src[0]];
+		dst[1] = palette[src[1]];
+		dst[2] = palette[src[2]];
+		dst[3] = palette[src[3]];
+	}
+	for(; cnt; cnt--)
+		*dst++ = palette[*src++];
+}
+
+void gdispBlendColors(gColor *dst, const gColor *fg, const gU8 *alpha, unsigned cnt) {
+	#if KERNEL_AVX2
+		for(; cnt >= 16; cnt -= 16, fg += 16, alpha += 16, dst += 16) {
+			__m256i	f = _mm256_loadu_si256((const __m256i *)fg);
+			__m256i	b = _mm256_loadu_si256((const __m256i *)dst);
+			__m256i	a = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)alpha));
+			__m256i	fr = _mm256_add_epi16(a, _mm256_set1_epi16(1));
+			__m256i	br = _mm256_sub_epi16(_mm256_set1_epi16(256), a);
+
+			_mm256_storeu_si256((__m256i *)dst, avx2Pack565(
+				avx2Mix(avx2Red565(f), avx2Red565(b), fr, br),
+				avx2Mix(avx2Green565(f), avx2Green565(b), fr, br),
+				avx2Mix(avx2Blue565(f), avx2Blue565(b), fr, br)));
+		}
+	#endif
+	#if KERNEL_SSE2
+		for(; cnt >= 8; cnt -= 8, fg += 8, alpha += 8, dst += 8) {
+			__m128i	f = _mm_loadu_si128((const __m128i *)fg);
+			__m128i	b = _mm_loadu_si128((const __m128i *)dst);
+			__m128i	a = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)alpha), _mm_setzero_si128());
+			__m128i	fr = _mm_add_epi16(a, _mm_set1_epi16(1));
+			__m128i	br = _mm_sub_epi16(_mm_set1_epi16(256), a);
+
+			_mm_storeu_si128((__m128i *)dst, sse2Pack565(
+				sse2Mix(sse2Red565(f), sse2Red565(b), fr, br),
+				sse2Mix(sse2Green565(f), sse2Green565(b), fr, br),
+				sse2Mix(sse2Blue565(f), sse2Blue565(b), fr, br)));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, fg += 8, alpha += 8, dst += 8) {
+			uint16x8_t	f = vld1q_u16(fg);
+			uint16x8_t	b = vld1q_u16(dst);
+			uint16x8_t	a = vmovl_u8(vld1_u8(alpha));
+			uint16x8_t	fr = vaddq_u16(a, vdupq_n_u16(1));
+			uint16x8_t	br = vsubq_u16(vdupq_n_u16(256), a);
+
+			vst1q_u16(dst, neonPack565(
+				neonMix(neonRed565(f), neonRed565(b), fr, br),
+				neonMix(neonGreen565(f), neonGreen565(b), fr, br),
+				neonMix(neonBlue565(f), neonBlue565(b), fr, br)));
+		}
+	#endif
+	for(; cnt; cnt--, dst++)
+		*dst = gdispBlendColor(*fg++, *dst, *alpha++);
+}
+
+void gdispBlendARGB(gColor *dst, const gU32 *src, unsigned cnt) {
+	gU16	fr, br;
+
+	#if KERNEL_AVX2
+		for(; cnt >= 16; cnt -= 16, src += 16, dst += 16) {
+			__m256i	s0 = _mm256_loadu_si256((const __m256i *)src);
+			__m256i	s1 = _mm256_loadu_si256((const __m256i *)(src+8));
+			__m256i	m = _mm256_set1_epi32(0xFF);
+			__m256i	b = _mm256_loadu_si256((const __m256i *)dst);
+			__m256i	a, r, g, bl, fr, br;
+
+			// The 128 bit lane packing leaves the pixels in the order 0-3, 8-11, 4-7, 12-15
+			a = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_srli_epi32(s0, 24), _mm256_srli_epi32(s1, 24)), 0xD8);
+			r = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(s0, 16), m), _mm256_and_si256(_mm256_srli_epi32(s1, 16), m)), 0xD8);
+			g = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(s0, 8), m), _mm256_and_si256(_mm256_srli_epi32(s1, 8), m)), 0xD8);
+			bl = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_and_si256(s0, m), _mm256_and_si256(s1, m)), 0xD8);
+			fr = _mm256_add_epi16(a, _mm256_set1_epi16(1));
+			br = _mm256_sub_epi16(_mm256_set1_epi16(256), a);
+
+			_mm256_storeu_si256((__m256i *)dst, avx2Pack565(
+				avx2Mix(r, avx2Red565(b), fr, br),
+				avx2Mix(g, avx2Green565(b), fr, br),
+				avx2Mix(bl, avx2Blue565(b), fr, br)));
+		}
+	#endif
+	#if KERNEL_SSE2
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 8) {
+			__m128i	s0 = _mm_loadu_si128((const __m128i *)src);
+			__m128i	s1 = _mm_loadu_si128((const __m128i *)(src+4));
+			__m128i	m = _mm_set1_epi32(0xFF);
+			__m128i	b = _mm_loadu_si128((const __m128i *)dst);
+			__m128i	a, r, g, bl, fr, br;
+
+			a = _mm_packs_epi32(_mm_srli_epi32(s0, 24), _mm_srli_epi32(s1, 24));
+			r = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 16), m), _mm_and_si128(_mm_srli_epi32(s1, 16), m));
+			g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 8), m), _mm_and_si128(_mm_srli_epi32(s1, 8), m));
+			bl = _mm_packs_epi32(_mm_and_si128(s0, m), _mm_and_si128(s1, m));
+			fr = _mm_add_epi16(a, _mm_set1_epi16(1));
+			br = _mm_sub_epi16(_mm_set1_epi16(256), a);
+
+			_mm_storeu_si128((__m128i *)dst, sse2Pack565(
+				sse2Mix(r, sse2Red565(b), fr, br),
+				sse2Mix(g, sse2Green565(b), fr, br),
+				sse2Mix(bl, sse2Blue565(b), fr, br)));
+		}
+	#elif KERNEL_NEON
+		for(; cnt >= 8; cnt -= 8, src += 8, dst += 8) {
+			uint32x4_t	s0 = vld1q_u32(src);
+			uint32x4_t	s1 = vld1q_u32(src+4);
+			uint32x4_t	m = vdupq_n_u32(0xFF);
+			uint16x8_t	b = vld1q_u16(dst);
+			uint16x8_t	a = vcombine_u16(vmovn_u32(vshrq_n_u32(s0, 24)), vmovn_u32(vshrq_n_u32(s1, 24)));
+			uint16x8_t	fr = vaddq_u16(a, vdupq_n_u16(1));
+			uint16x8_t	br = vsubq_u16(vdupq_n_u16(256), a);
+
+			vst1q_u16(dst, neonPack565(
+				neonMix(vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(s0, 16), m)), vmovn_u32(vandq_u32(vshrq_n_u32(s1, 16), m))), neonRed565(b), fr, br),
+				neonMix(vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(s0, 8), m)), vmovn_u32(vandq_u32(vshrq_n_u32(s1, 8), m))), neonGreen565(b), fr, br),
+				neonMix(vcombine_u16(vmovn_u32(vandq_u32(s0, m)), vmovn_u32(vandq_u32(s1, m))), neonBlue565(b), fr, br)));
+		}
+	#endif
+	for(; cnt; cnt--, src++, dst++) {
+		fr = (gU16)(*src >> 24) + 1;
+		br = 256 - (gU16)(*src >> 24);
+		*dst = RGB2COLOR(
+			(((*src >> 16) & 0xFF) * fr + RED_OF(*dst) * br) >> 8,
+			(((*src >> 8) & 0xFF) * fr + GREEN_OF(*dst) * br) >> 8,
+			((*src & 0xFF) * fr + BLUE_OF(*dst) * br) >> 8);
+	}
+}
+
+#endif /* GFX_USE_GDISP */
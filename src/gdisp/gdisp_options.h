@@ -70,6 +70,47 @@
 	#ifndef GDISP_NEED_CLIP
 		#define GDISP_NEED_CLIP					GFXON
 	#endif
+	/**
+	 * @brief   Are multi-rectangle clip regions needed.
+	 * @details	Adds @p gdispGSetClipRegion() and the gdispRegion functions.
+	 * @details	Defaults to GFXOFF
+	 * @note	Clip regions are only supported with software clipping. If the driver
+	 * 			clips in hardware @p gdispGSetClipRegion() returns gFalse.
+	 */
+	#ifndef GDISP_NEED_CLIP_REGION
+		#define GDISP_NEED_CLIP_REGION			GFXOFF
+	#endif
+	/**
+	 * @brief   Count the pixels written to each display.
+	 * @details	Adds @p gdispGGetPixelCount() and @p gdispGResetPixelCount(). Comparing the
+	 * 			count against the area updated gives the overdraw of a redraw.
+	 * @details	Defaults to GFXOFF
+	 */
+	#ifndef GDISP_NEED_PIXELCOUNT
+		#define GDISP_NEED_PIXELCOUNT			GFXOFF
+	#endif
+	/**
+	 * @brief   Can drawing be recorded into display lists.
+	 * @details	Adds @p gdispGListStart(), @p gdispGListDraw() and the other gdispList functions.
+	 * @details	Defaults to GFXOFF
+	 * @note	A display list holds the fills and blits that drawing turns into after clipping.
+	 * 			Drawing it again is much faster than repeating the original drawing.
+	 */
+	#ifndef GDISP_NEED_DISPLAYLIST
+		#define GDISP_NEED_DISPLAYLIST			GFXOFF
+	#endif
+	/**
+	 * @brief   Can display lists be drawn a tile at a time.
+	 * @details	Adds @p gdispGListDrawTiled().
+	 * @details	Defaults to GFXOFF
+	 * @note	Each tile is built in a small buffer and sent to the display in one go
+	 * 			so every pixel is sent once. This suits controllers that can only stream
+	 * 			pixels and boards without the memory for a frame buffer.
+	 * @note	This turns on GDISP_NEED_DISPLAYLIST.
+	 */
+	#ifndef GDISP_NEED_LIST_TILES
+		#define GDISP_NEED_LIST_TILES			GFXOFF
+	#endif
 	/**
 	 * @brief   Streaming functions are needed
 	 * @details	Defaults to GFXOFF.
@@ -141,6 +182,56 @@
 	#ifndef GDISP_NEED_CONVEX_POLYGON
 		#define GDISP_NEED_CONVEX_POLYGON		GFXOFF
 	#endif
+	/**
+	 * @brief   Are complex polygon functions needed.
+	 * @details	Adds @p gdispGFillPoly() which fills polygons that are non-convex,
+	 * 			self-intersecting or made of several contours.
+	 * @details	Defaults to GFXOFF
+	 * @note	Uses the heap for its edge table while drawing.
+	 */
+	#ifndef GDISP_NEED_COMPLEX_POLYGON
+		#define GDISP_NEED_COMPLEX_POLYGON		GFXOFF
+	#endif
+	/**
+	 * @brief   Are gradient fill functions needed.
+	 * @details	Adds @p gdispGFillGradient() and @p gdispGFillGradientStops().
+	 * @details	Defaults to GFXOFF
+	 * @note	The non-flat widget renderings use these so GWIN turns this on for you.
+	 */
+	#ifndef GDISP_NEED_GRADIENT
+		#define GDISP_NEED_GRADIENT				GFXOFF
+	#endif
+	/**
+	 * @brief   Are pattern fill functions needed.
+	 * @details	Adds @p gdispGFillPattern().
+	 * @details	Defaults to GFXOFF
+	 */
+	#ifndef GDISP_NEED_PATTERN
+		#define GDISP_NEED_PATTERN				GFXOFF
+	#endif
+	/**
+	 * @brief   Are bitmaps with an alpha channel needed.
+	 * @details	Adds @p gdispGBlitAreaAlpha().
+	 * @details	Defaults to GFXOFF
+	 * @note	Partially transparent pixels are blended with what is read back from the display.
+	 * 			If the display can't be read they are treated as opaque or transparent.
+	 */
+	#ifndef GDISP_NEED_BLIT_ALPHA
+		#define GDISP_NEED_BLIT_ALPHA			GFXOFF
+	#endif
+	/**
+	 * @brief   Are anti-aliased drawing functions needed.
+	 * @details	Adds @p gdispGDrawLineAA(), @p gdispGDrawCircleAA(), @p gdispGFillCircleAA(), @p gdispGDrawArcAA(),
+	 * 			@p gdispGDrawPolyAA(), @p gdispGFillConvexPolyAA() and @p gdispGDrawThickLineAA().
+	 * 			The circle, arc and polygon functions also need their normal GDISP_NEED_xxx option.
+	 * @details	Defaults to GFXOFF
+	 * @note	This turns on GDISP_NEED_BLIT_ALPHA. Edge pixels are blended with what is read back
+	 * 			from the display. If the display can't be read the edges are aliased.
+	 * @note	This is separate to GDISP_NEED_ANTIALIAS which only affects fonts.
+	 */
+	#ifndef GDISP_NEED_ANTIALIAS_SHAPES
+		#define GDISP_NEED_ANTIALIAS_SHAPES		GFXOFF
+	#endif
 	/**
 	 * @brief   Are scrolling functions needed.
 	 * @details	Defaults to GFXOFF
@@ -205,6 +296,50 @@
 	#ifndef GDISP_NEED_MULTITHREAD
 		#define GDISP_NEED_MULTITHREAD			GFXOFF
 	#endif
+	/**
+	 * @brief   Are draw contexts needed.
+	 * @details	Adds @p gdispGContextCreate() and @p gdispContextDelete().
+	 * @details	Defaults to GFXOFF
+	 * @note	Each thread can draw through its own context without waiting for the others.
+	 * 			Only memory based displays (eg. framebuffers and pixmaps) support this.
+	 */
+	#ifndef GDISP_NEED_DRAWCONTEXT
+		#define GDISP_NEED_DRAWCONTEXT			GFXOFF
+	#endif
+	/**
+	 * @brief   Are large fills and blits split between several threads.
+	 * @details	Defaults to GFXOFF
+	 * @note	Only memory based displays (eg. framebuffers and pixmaps) are split. The area is
+	 * 			divided into bands of rows. Worker threads draw all but the first band which
+	 * 			the calling thread draws.
+	 * @note	This turns on GDISP_NEED_DRAWCONTEXT.
+	 */
+	#ifndef GDISP_NEED_PARALLEL
+		#define GDISP_NEED_PARALLEL				GFXOFF
+	#endif
+	/**
+	 * @brief   The number of worker threads used by GDISP_NEED_PARALLEL.
+	 * @details	Defaults to 3
+	 * @note	Set this to one less than the number of processor cores.
+	 */
+	#ifndef GDISP_PARALLEL_THREADS
+		#define GDISP_PARALLEL_THREADS			3
+	#endif
+	/**
+	 * @brief   The smallest fill or blit (in pixels) that GDISP_NEED_PARALLEL splits.
+	 * @details	Defaults to 65536
+	 * @note	Smaller areas are drawn faster by one thread than it takes to wake the workers.
+	 */
+	#ifndef GDISP_PARALLEL_MIN_PIXELS
+		#define GDISP_PARALLEL_MIN_PIXELS		65536
+	#endif
+	/**
+	 * @brief   The stack size of each GDISP_NEED_PARALLEL worker thread.
+	 * @details	Defaults to 1024
+	 */
+	#ifndef GDISP_PARALLEL_THREAD_WORKAREA_SIZE
+		#define GDISP_PARALLEL_THREAD_WORKAREA_SIZE	1024
+	#endif
 /**
  * @}
  *
@@ -248,6 +383,19 @@
 	#ifndef GDISP_LINEBUF_SIZE
 		#define GDISP_LINEBUF_SIZE				128
 	#endif
+	/**
+	 * @brief	Use SIMD instructions in the bulk pixel kernels.
+	 * @details	Defaults to GFXON
+	 * @details	When the compiler is targeting SSE2, AVX2 or NEON the bulk pixel conversion
+	 * 			and blending functions (eg @p gdispBlendColors()) use those instructions.
+	 * 			The results are identical to the portable C code.
+	 * @note	Only the RGB565 pixel format currently has SIMD kernels.
+	 * @note	Set this to GFXOFF if the code may run on a CPU without the instructions
+	 * 			the compiler was told to target.
+	 */
+	#ifndef GDISP_NEED_SIMD
+		#define GDISP_NEED_SIMD					GFXON
+	#endif
 /**
  * @}
  *
@@ -456,6 +604,17 @@
 	#ifndef GDISP_NEED_IMAGE_PNG_ALPHACLIFF
 		#define GDISP_NEED_IMAGE_PNG_ALPHACLIFF			32
 	#endif
+	/**
+	 * @brief   Are PNG images with alpha blended with what is on the display.
+	 * @details	Defaults to GFXOFF
+	 * @note	Partially transparent pixels are drawn with @p gdispGBlitAreaAlpha() so the image
+	 * 			shows over whatever is underneath. This takes priority over the PNG background
+	 * 			color and GDISP_NEED_IMAGE_PNG_ALPHACLIFF.
+	 * @note	This turns on GDISP_NEED_BLIT_ALPHA.
+	 */
+	#ifndef GDISP_NEED_IMAGE_PNG_ALPHABLEND
+		#define GDISP_NEED_IMAGE_PNG_ALPHABLEND			GFXOFF
+	#endif
 	/**
 	 * @brief   Is 1, 2 and 4 bit PNG palettized image decoding required.
 	 * @details	Defaults to GFXON
@@ -560,6 +719,32 @@
 	#ifndef GDISP_IMAGE_PNG_Z_BUFFER_SIZE
 		#define GDISP_IMAGE_PNG_Z_BUFFER_SIZE	32768
 	#endif
+/**
+ * @}
+ *
+ * @name	GDISP Clip Region Options
+ * @{
+ */
+	/**
+	 * @brief	The maximum number of rectangles in a clip region.
+	 * @details	Each rectangle costs 4 coordinates in every gdispRegion and GDisplay.
+	 * @details	Defaults to 8
+	 */
+	#ifndef GDISP_CLIP_REGION_MAX
+		#define GDISP_CLIP_REGION_MAX			8
+	#endif
+	/**
+	 * @brief	The size of a tile for @p gdispGListDrawTiled().
+	 * @details	The tile buffer uses GDISP_LIST_TILE_WIDTH * GDISP_LIST_TILE_HEIGHT
+	 * 			pixels plus a byte for each pixel.
+	 * @details	Defaults to 32 x 32
+	 */
+	#ifndef GDISP_LIST_TILE_WIDTH
+		#define GDISP_LIST_TILE_WIDTH			32
+	#endif
+	#ifndef GDISP_LIST_TILE_HEIGHT
+		#define GDISP_LIST_TILE_HEIGHT			32
+	#endif
 /**
  * @}
  *
@@ -592,6 +777,14 @@
 	#ifndef GDISP_NEED_TEXT_BOXPADTB
 		#define GDISP_NEED_TEXT_BOXPADTB		1
 	#endif
+	/**
+	 * @brief	Enable the batched string API - @p gdispGDrawStringBatch().
+	 * @details	Renders many strings under a single display lock and flush.
+	 * @details Defaults to GFXOFF
+	 */
+	#ifndef GDISP_NEED_TEXT_BATCH
+		#define GDISP_NEED_TEXT_BATCH			GFXOFF
+	#endif
 	/**
 	 * @brief	Enable UTF-8 support for text rendering.
 	 * @details Defaults to GFXOFF
@@ -613,6 +806,26 @@
 	#ifndef GDISP_NEED_ANTIALIAS
 		#define GDISP_NEED_ANTIALIAS			GFXOFF
 	#endif
+	/**
+	 * @brief	Enable run-time TrueType font support.
+	 * @details	Adds @p gdispOpenTTFFont(), @p gdispOpenTTFAtlas() and friends.
+	 * 			Rendered glyphs are cached and the cache can be saved to (and later loaded from)
+	 * 			a pre-rasterized atlas file so a target need not carry the rasterizer.
+	 * @note	When GDISP_TTF_USE_FREETYPE is GFXON the FreeType library headers must be
+	 * 			on your include path and the library linked with your project (eg. -lfreetype).
+	 * @details	Defaults to GFXOFF
+	 */
+	#ifndef GDISP_NEED_TTF
+		#define GDISP_NEED_TTF					GFXOFF
+	#endif
+	/**
+	 * @brief	Use FreeType to rasterize TrueType fonts at run-time.
+	 * @details	If GFXOFF only pre-rasterized atlas files can be opened.
+	 * @details	Defaults to GFXON
+	 */
+	#ifndef GDISP_TTF_USE_FREETYPE
+		#define GDISP_TTF_USE_FREETYPE			GFXON
+	#endif
 /**
  * @}
  *
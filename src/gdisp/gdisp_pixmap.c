@@ -31,7 +31,7 @@
 #define GDISP_HARDWARE_CONTROL			GFXON
 #define IN_PIXMAP_DRIVER				GFXON
 #define GDISP_DRIVER_VMT				GDISPVMT_pixmap
-#define GDISP_DRIVER_VMT_FLAGS			(GDISP_VFLG_DYNAMICONLY|GDISP_VFLG_PIXMAP)
+#define GDISP_DRIVER_VMT_FLAGS			(GDISP_VFLG_DYNAMICONLY|GDISP_VFLG_PIXMAP|GDISP_VFLG_CONCURRENT)
 
 // This pseudo driver currently only supports unpacked formats with more than 8 bits per pixel
 //	that is, we only support GRAY_SCALE and PALETTE with 8 bits per pixel or any unpacked TRUE_COLOR format.
@@ -43,6 +43,7 @@
 #include "../gdriver/gdriver.h"
 
 typedef struct pixmap {
+	gCoord			ox, oy;				// The display position of the first pixel (see gdispPixmapSetOrigin())
 	#if GDISP_NEED_PIXMAP_IMAGE
 		gU8		imghdr[8];			// This field must come just before the data member.
 	#endif
@@ -76,6 +77,7 @@ GDisplay *gdispPixmapCreate(gCoord width, gCoord height) {
 	#endif
 
 	// Save the width and height so the driver can retrieve it.
+	p->ox = p->oy = 0;
 	((gCoord *)p->pixels)[0] = width;
 	((gCoord *)p->pixels)[1] = height;
 
@@ -89,6 +91,11 @@ GDisplay *gdispPixmapCreate(gCoord width, gCoord height) {
 void gdispPixmapDelete(GDisplay *g) {
 	if (gvmt(g) != GDISPVMT_pixmap)
 		return;
+	#if GDISP_NEED_DRAWCONTEXT
+		// Draw contexts are deleted with gdispContextDelete()
+		if (g->parent)
+			return;
+	#endif
 	gdriverUnRegister(&g->d);
 }
 
@@ -98,6 +105,33 @@ gPixel	*gdispPixmapGetBits(GDisplay *g) {
 	return ((pixmap *)g->priv)->pixels;
 }
 
+gBool gdispPixmapSetOrigin(GDisplay *g, gCoord x, gCoord y) {
+	pixmap	*p;
+
+	if (gvmt(g) != GDISPVMT_pixmap)
+		return gFalse;
+	#if GDISP_NEED_CONTROL
+		if (g->g.Orientation != gOrientation0)
+			return gFalse;
+	#endif
+
+	// The width and height include the origin so normal clipping discards most things outside the pixmap
+	p = (pixmap *)g->priv;
+	g->g.Width += x - p->ox;
+	g->g.Height += y - p->oy;
+	p->ox = x;
+	p->oy = y;
+	#if GDISP_NEED_CLIP
+		gdispGSetClip(g, x, y, g->g.Width - x, g->g.Height - y);
+	#elif GDISP_NEED_VALIDATION
+		g->clipx0 = x;
+		g->clipy0 = y;
+		g->clipx1 = g->g.Width;
+		g->clipy1 = g->g.Height;
+	#endif
+	return gTrue;
+}
+
 #if GDISP_NEED_PIXMAP_IMAGE
 	void *gdispPixmapGetMemoryImage(GDisplay *g) {
 		if (gvmt(g) != GDISPVMT_pixmap)
@@ -110,6 +144,8 @@ gPixel	*gdispPixmapGetBits(GDisplay *g) {
 /* Driver exported functions.                                                */
 /*===========================================================================*/
 
+#define PM(g)		((pixmap *)(g)->priv)
+
 LLDSPEC gBool gdisp_lld_init(GDisplay *g) {
 	// The user api function should have already allocated and initialised the pixmap
 	//	structure and put it into the priv member during driver initialisation.
@@ -140,7 +176,9 @@ LLDSPEC void gdisp_lld_draw_pixel(GDisplay *g) {
 		switch(g->g.Orientation) {
 		case gOrientation0:
 		default:
-			pos = g->p.y * g->g.Width + g->p.x;
+			if (g->p.x < PM(g)->ox || g->p.y < PM(g)->oy)
+				return;
+			pos = (g->p.y - PM(g)->oy) * (g->g.Width - PM(g)->ox) + g->p.x - PM(g)->ox;
 			break;
 		case gOrientation90:
 			pos = (g->g.Width-g->p.x-1) * g->g.Height + g->p.y;
@@ -153,10 +191,12 @@ LLDSPEC void gdisp_lld_draw_pixel(GDisplay *g) {
 			break;
 		}
 	#else
-		pos = g->p.y * g->g.Width + g->p.x;
+		if (g->p.x < PM(g)->ox || g->p.y < PM(g)->oy)
+			return;
+		pos = (g->p.y - PM(g)->oy) * (g->g.Width - PM(g)->ox) + g->p.x - PM(g)->ox;
 	#endif
 
-	((pixmap *)(g)->priv)->pixels[pos] = g->p.color;
+	PM(g)->pixels[pos] = g->p.color;
 }
 
 LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
@@ -166,7 +206,9 @@ LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 		switch(g->g.Orientation) {
 		case gOrientation0:
 		default:
-			pos = g->p.y * g->g.Width + g->p.x;
+			if (g->p.x < PM(g)->ox || g->p.y < PM(g)->oy)
+				return 0;
+			pos = (g->p.y - PM(g)->oy) * (g->g.Width - PM(g)->ox) + g->p.x - PM(g)->ox;
 			break;
 		case gOrientation90:
 			pos = (g->g.Width-g->p.x-1) * g->g.Height + g->p.y;
@@ -179,10 +221,12 @@ LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 			break;
 		}
 	#else
-		pos = g->p.y * g->g.Width + g->p.x;
+		if (g->p.x < PM(g)->ox || g->p.y < PM(g)->oy)
+			return 0;
+		pos = (g->p.y - PM(g)->oy) * (g->g.Width - PM(g)->ox) + g->p.x - PM(g)->ox;
 	#endif
 
-	return ((pixmap *)(g)->priv)->pixels[pos];
+	return PM(g)->pixels[pos];
 }
 
 #if GDISP_NEED_CONTROL
@@ -191,6 +235,10 @@ LLDSPEC	gColor gdisp_lld_get_pixel_color(GDisplay *g) {
 		case GDISP_CONTROL_ORIENTATION:
 			if (g->g.Orientation == (gOrientation)g->p.ptr)
 				return;
+
+			// We can't rotate a pixmap that stands in for part of another display
+			if (PM(g)->ox || PM(g)->oy)
+				return;
 			switch((gOrientation)g->p.ptr) {
 				case gOrientation0:
 				case gOrientation180:
@@ -61,6 +61,22 @@ void gdispPixmapDelete(GDisplay *g);
  */
 gPixel	*gdispPixmapGetBits(GDisplay *g);
 
+/**
+ * @brief	Make a pixmap stand in for an area of another display.
+ * @return	gFalse if this display is not a pixmap or it has been rotated
+ *
+ * @param[in] g  	The pixmap virtual display
+ * @param[in] x,y  	The position of the top left pixel of the pixmap
+ *
+ * @note	After this call the pixmap is drawn on using the same coordinates as the area it stands in for.
+ * 			Drawing outside that area is discarded. gdispGGetWidth() and gdispGGetHeight() return the
+ * 			position plus the pixmap size and the clipping area is reset to the pixmap area.
+ * @note	The pixels returned by @p gdispPixmapGetBits() still start with the top left pixel so the pixmap
+ * 			can be copied back with gdispGBlitArea(g, x, y, width, height, 0, 0, width, bits).
+ * @note	The pixmap can't be rotated while the position is not 0,0.
+ */
+gBool gdispPixmapSetOrigin(GDisplay *g, gCoord x, gCoord y);
+
 #if GDISP_NEED_PIXMAP_IMAGE || defined(__DOXYGEN__)
 	/**
 	 * @brief	Get a pointer to a native format gImage.
@@ -112,6 +112,89 @@
 			#define GFX_USE_GFILE	GFXON
 		#endif
 	#endif
+	#if GDISP_NEED_CLIP_REGION
+		#if !GDISP_NEED_CLIP
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GDISP: GDISP_NEED_CLIP is required when GDISP_NEED_CLIP_REGION is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GDISP: GDISP_NEED_CLIP is required when GDISP_NEED_CLIP_REGION is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_CLIP
+			#define GDISP_NEED_CLIP		GFXON
+		#endif
+		#if GDISP_CLIP_REGION_MAX < 1
+			#error "GDISP: GDISP_CLIP_REGION_MAX must be at least 1."
+		#endif
+	#endif
+	#if GDISP_NEED_LIST_TILES
+		#if !GDISP_NEED_DISPLAYLIST
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GDISP: GDISP_NEED_DISPLAYLIST is required when GDISP_NEED_LIST_TILES is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GDISP: GDISP_NEED_DISPLAYLIST is required when GDISP_NEED_LIST_TILES is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_DISPLAYLIST
+			#define GDISP_NEED_DISPLAYLIST	GFXON
+		#endif
+		#if GDISP_LIST_TILE_WIDTH < 1 || GDISP_LIST_TILE_HEIGHT < 1
+			#error "GDISP: GDISP_LIST_TILE_WIDTH and GDISP_LIST_TILE_HEIGHT must be at least 1."
+		#endif
+	#endif
+	#if GDISP_NEED_PARALLEL && !GDISP_NEED_DRAWCONTEXT
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GDISP: GDISP_NEED_DRAWCONTEXT is required when GDISP_NEED_PARALLEL is GFXON. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GDISP: GDISP_NEED_DRAWCONTEXT is required when GDISP_NEED_PARALLEL is GFXON. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_DRAWCONTEXT
+		#define GDISP_NEED_DRAWCONTEXT	GFXON
+	#endif
+	#if GDISP_NEED_ANTIALIAS_SHAPES && !GDISP_NEED_BLIT_ALPHA
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GDISP: GDISP_NEED_BLIT_ALPHA is required when GDISP_NEED_ANTIALIAS_SHAPES is GFXON. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GDISP: GDISP_NEED_BLIT_ALPHA is required when GDISP_NEED_ANTIALIAS_SHAPES is GFXON. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_BLIT_ALPHA
+		#define GDISP_NEED_BLIT_ALPHA	GFXON
+	#endif
+	#if GDISP_NEED_IMAGE && GDISP_NEED_IMAGE_PNG && GDISP_NEED_IMAGE_PNG_ALPHABLEND
+		#if !GDISP_NEED_BLIT_ALPHA
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GDISP: GDISP_NEED_BLIT_ALPHA is required when GDISP_NEED_IMAGE_PNG_ALPHABLEND is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GDISP: GDISP_NEED_BLIT_ALPHA is required when GDISP_NEED_IMAGE_PNG_ALPHABLEND is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_BLIT_ALPHA
+			#define GDISP_NEED_BLIT_ALPHA	GFXON
+		#endif
+	#endif
+	#if GDISP_NEED_TTF
+		#if !GDISP_NEED_TEXT
+			#error "GDISP: GDISP_NEED_TTF requires GDISP_NEED_TEXT to be GFXON."
+		#endif
+		#if !GFX_USE_GFILE
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GDISP: GFX_USE_GFILE is required when GDISP_NEED_TTF is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GDISP: GFX_USE_GFILE is required when GDISP_NEED_TTF is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GFX_USE_GFILE
+			#define GFX_USE_GFILE	GFXON
+		#endif
+	#endif
 #endif
 
 #endif /* _GDISP_RULES_H */
@@ -48,6 +48,12 @@ typedef const wchar_t * mf_str;
  */
 MF_EXTERN mf_char mf_getchar(mf_str *str);
 
+/* Same as mf_getchar() but plain ASCII characters are decoded inline without
+ * a function call. Only multi-byte sequences go through mf_getchar().
+ * Note: str is evaluated more than once.
+ */
+#define MF_GETCHAR(str)	((**(str) > 0 && **(str) < 0x80) ? (mf_char)*(*(str))++ : mf_getchar(str))
+
 /* Moves back the pointer to the beginning of the previous character.
  * Be careful not to go beyond the start of the string.
  */
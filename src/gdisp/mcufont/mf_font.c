@@ -48,6 +48,13 @@ gU8 mf_character_width(const struct mf_font_s *font,
                            mf_char character)
 {
     gU8 width;
+
+    if (font->ascii_widths &&
+        (unsigned)(MFCHAR2UINT16(character) - MF_ASCII_WIDTHS_FIRST) < MF_ASCII_WIDTHS_COUNT)
+    {
+        return pgm_read_byte(font->ascii_widths + (MFCHAR2UINT16(character) - MF_ASCII_WIDTHS_FIRST));
+    }
+
     width = font->character_width(font, character);
 
     if (!width)
@@ -66,8 +66,18 @@ struct mf_font_s
                                 mf_char character,
                                 mf_pixel_callback_t callback,
                                 void *state);
+
+    /* Optional table of tracking widths for the printable ASCII characters
+     * (MF_ASCII_WIDTHS_FIRST onwards) with the fallback character width
+     * already substituted for missing glyphs. Allows string measurement
+     * without touching the glyph data. NULL if not present. */
+    const gU8 *ascii_widths;
 };
 
+/* The range of characters covered by the ascii_widths table. */
+#define MF_ASCII_WIDTHS_FIRST  0x20
+#define MF_ASCII_WIDTHS_COUNT  95
+
 /* The flag definitions for the font.flags field. */
 #define MF_FONT_FLAG_MONOSPACE 0x01
 #define MF_FONT_FLAG_BW        0x02
@@ -52,31 +52,61 @@ gI16 mf_get_string_width(const struct mf_font_s *font, mf_str text,
                             gU16 count, bool kern)
 {
     gI16 result = 0;
-    gU16 c1 = 0, c2;
+    gU16 c2;
+#if MF_USE_KERNING
+    struct mf_kerning_edges_s edges[2];
+    gU8 cur = 0;
+    gBool have_prev = gFalse;
+#endif
     
     if (!count)
         count = 0xFFFF;
 
+    /* Monospace fonts are never kerned */
+    if (font->flags & MF_FONT_FLAG_MONOSPACE)
+        kern = gFalse;
+
+    /* Fast path for runs of printable ASCII when no kerning is needed. */
+    if (!kern && font->ascii_widths)
+    {
+        while (count && *text >= MF_ASCII_WIDTHS_FIRST &&
+               *text < MF_ASCII_WIDTHS_FIRST + MF_ASCII_WIDTHS_COUNT)
+        {
+            result += pgm_read_byte(font->ascii_widths + (*text++ - MF_ASCII_WIDTHS_FIRST));
+            count--;
+        }
+    }
+
     while (count-- && *text)
     {
-        c2 = mf_getchar(&text);
+        c2 = MF_GETCHAR(&text);
 
         if (c2 == '\t')
         {
 #if MF_USE_TABS
             result = mf_round_to_tab(font, 0, result);
-            c1 = ' ';
+#if MF_USE_KERNING
+            have_prev = gFalse;
+#endif
             continue;
 #else
             c2 = ' ';
 #endif
         }
 
-        if (kern && c1 != 0)
-            result += mf_compute_kerning(font, c1, c2);
+#if MF_USE_KERNING
+        /* Each glyph's edges are analyzed once and reused for the next pair */
+        if (kern)
+        {
+            gBool have_cur = mf_kerning_edges(font, c2, &edges[cur]);
+            if (have_cur && have_prev)
+                result += mf_kerning_from_edges(font, &edges[cur ^ 1], &edges[cur]);
+            have_prev = have_cur;
+            cur ^= 1;
+        }
+#endif
 
         result += mf_character_width(font, c2);
-        c1 = c2;
     }
 
     return result;
@@ -94,7 +124,7 @@ static gU16 strip_spaces(mf_str text, gU16 count, mf_char *last_char)
     while (count-- && *text)
     {
         i++;
-        tmp = mf_getchar(&text);
+        tmp = MF_GETCHAR(&text);
         if (tmp != ' ' && tmp != (mf_char)0xA0 && tmp != '\n' &&
             tmp != '\r' && tmp != '\t')
         {
@@ -126,7 +156,7 @@ static void render_left(const struct mf_font_s *font,
     x = x0 - font->baseline_x;
     while (count--)
     {
-        c2 = mf_getchar(&text);
+        c2 = MF_GETCHAR(&text);
 
         if (c2 == '\t')
         {
@@ -184,7 +214,7 @@ static void render_right(const struct mf_font_s *font,
     {
         mf_rewind(&text);
         tmp = text;
-        c1 = mf_getchar(&tmp);
+        c1 = MF_GETCHAR(&tmp);
 
         /* Perform tab alignment */
         if (c1 == '\t')
@@ -265,7 +295,7 @@ static gU16 count_spaces(mf_str text, gU16 count)
     gU16 spaces = 0;
     while (count-- && *text)
     {
-        if (is_justify_space(mf_getchar(&text)))
+        if (is_justify_space(MF_GETCHAR(&text)))
             spaces++;
     }
     return spaces;
@@ -301,7 +331,7 @@ void mf_render_justified(const struct mf_font_s *font,
         x = x0 - font->baseline_x;
         while (count--)
         {
-            c2 = mf_getchar(&text);
+            c2 = MF_GETCHAR(&text);
 
             if (c2 == '\t')
             {
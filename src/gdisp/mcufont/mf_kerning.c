@@ -13,40 +13,27 @@
 
 #if MF_USE_KERNING
 
-/* Structure for keeping track of the edge of the glyph as it is rendered. */
+/* Structure for keeping track of the edges of the glyph as it is rendered. */
 struct kerning_state_s
 {
-    gU8 edgepos[MF_KERNING_ZONES];
+    struct mf_kerning_edges_s *edges;
     gU8 zoneheight;
 };
 
-/* Pixel callback for analyzing the left edge of a glyph. */
-static void fit_leftedge(gI16 x, gI16 y, gU8 count, gU8 alpha,
-                         void *state)
+/* Pixel callback for analyzing the left and right edges of a glyph. */
+static void fit_edges(gI16 x, gI16 y, gU8 count, gU8 alpha,
+                      void *state)
 {
     struct kerning_state_s *s = state;
-    (void)count;
     
     if (alpha > 7)
     {
         gU8 zone = y / s->zoneheight;
-        if (x < s->edgepos[zone])
-            s->edgepos[zone] = x;
-    }
-}
-
-/* Pixel callback for analyzing the right edge of a glyph. */
-static void fit_rightedge(gI16 x, gI16 y, gU8 count, gU8 alpha,
-                         void *state)
-{
-    struct kerning_state_s *s = state;
-
-    if (alpha > 7)
-    {
-        gU8 zone = y / s->zoneheight;
+        if (x < s->edges->left[zone])
+            s->edges->left[zone] = x;
         x += count - 1;
-        if (x > s->edgepos[zone])
-            s->edgepos[zone] = x;
+        if (x > s->edges->right[zone])
+            s->edges->right[zone] = x;
     }
 }
 
@@ -69,44 +56,56 @@ static bool do_kerning(mf_char c)
 static gI16 max16(gI16 a, gI16 b) { return (a > b) ? a : b; }
 static gI16 avg16(gI16 a, gI16 b) { return (a + b) / 2; }
 
-gI8 mf_compute_kerning(const struct mf_font_s *font,
-                          mf_char c1, mf_char c2)
+gBool mf_kerning_edges(const struct mf_font_s *font, mf_char c,
+                       struct mf_kerning_edges_s *edges)
 {
-    struct kerning_state_s leftedge, rightedge;
-    gU8 w1, w2, i, min_space;
-    gI16 normal_space, adjust, max_adjust;
-    
+    struct kerning_state_s state;
+    gU8 i;
+
     if (font->flags & MF_FONT_FLAG_MONOSPACE)
-        return 0; /* No kerning for monospace fonts */
+        return gFalse; /* No kerning for monospace fonts */
 
-    if (!do_kerning(c1) || !do_kerning(c2))
-        return 0;
+    if (!do_kerning(c))
+        return gFalse;
 
     /* Compute the height of one kerning zone in pixels */
     i = (font->height + MF_KERNING_ZONES - 1) / MF_KERNING_ZONES;
     if (i < 1) i = 1;
 
     /* Initialize structures */
-    leftedge.zoneheight = rightedge.zoneheight = i;
+    state.zoneheight = i;
+    state.edges = edges;
     for (i = 0; i < MF_KERNING_ZONES; i++)
     {
-        leftedge.edgepos[i] = 255;
-        rightedge.edgepos[i] = 0;
+        edges->left[i] = 255;
+        edges->right[i] = 0;
     }
 
-    /* Analyze the edges of both glyphs. */
-    w1 = mf_render_character(font, 0, 0, c1, fit_rightedge, &rightedge);
-    w2 = mf_render_character(font, 0, 0, c2, fit_leftedge, &leftedge);
+    /* Analyze both edges of the glyph in a single pass. */
+    edges->width = mf_render_character(font, 0, 0, c, fit_edges, &state);
+    return gTrue;
+}
+
+gI8 mf_kerning_from_edges(const struct mf_font_s *font,
+                          const struct mf_kerning_edges_s *e1,
+                          const struct mf_kerning_edges_s *e2)
+{
+    gU8 w1, w2, i, min_space;
+    gI16 normal_space, adjust, max_adjust;
+    (void)font;
+
+    w1 = e1->width;
+    w2 = e2->width;
 
     /* Find the minimum horizontal space between the glyphs. */
     min_space = 255;
     for (i = 0; i < MF_KERNING_ZONES; i++)
     {
         gU8 space;
-        if (leftedge.edgepos[i] == 255 || rightedge.edgepos[i] == 0)
+        if (e2->left[i] == 255 || e1->right[i] == 0)
             continue; /* Outside glyph area. */
 
-        space = w1 - rightedge.edgepos[i] + leftedge.edgepos[i];
+        space = w1 - e1->right[i] + e2->left[i];
         if (space < min_space)
             min_space = space;
     }
@@ -126,6 +125,17 @@ gI8 mf_compute_kerning(const struct mf_font_s *font,
     return adjust;
 }
 
+gI8 mf_compute_kerning(const struct mf_font_s *font,
+                          mf_char c1, mf_char c2)
+{
+    struct mf_kerning_edges_s e1, e2;
+
+    if (!mf_kerning_edges(font, c1, &e1) || !mf_kerning_edges(font, c2, &e2))
+        return 0;
+
+    return mf_kerning_from_edges(font, &e1, &e2);
+}
+
 #endif
 
 #endif //MF_NO_COMPILE
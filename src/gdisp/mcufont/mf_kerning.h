@@ -27,6 +27,30 @@
 #if MF_USE_KERNING
 MF_EXTERN gI8 mf_compute_kerning(const struct mf_font_s *font,
                                     mf_char c1, mf_char c2);
+
+/* The left and right edge profile of a single glyph. Computing these once
+ * per character lets a string be kerned without rendering each glyph twice.
+ */
+struct mf_kerning_edges_s
+{
+    gU8 left[MF_KERNING_ZONES];
+    gU8 right[MF_KERNING_ZONES];
+    gU8 width;
+};
+
+/* Analyze the edges of character c.
+ *
+ * Returns false if no kerning should be done against this character.
+ */
+MF_EXTERN gBool mf_kerning_edges(const struct mf_font_s *font, mf_char c,
+                                 struct mf_kerning_edges_s *edges);
+
+/* Compute the kerning adjustment from the edges of two characters as
+ * returned by mf_kerning_edges(). Same result as mf_compute_kerning().
+ */
+MF_EXTERN gI8 mf_kerning_from_edges(const struct mf_font_s *font,
+                                    const struct mf_kerning_edges_s *e1,
+                                    const struct mf_kerning_edges_s *e2);
 #else
 #define mf_compute_kerning(f,c1,c2) (0)
 #endif
@@ -85,6 +85,7 @@ void mf_scale_font(struct mf_scaledfont_s *newfont,
     newfont->font.line_height *= y_scale;
     newfont->font.character_width = &mf_scaled_character_width;
     newfont->font.render_character = &mf_scaled_render_character;
+    newfont->font.ascii_widths = 0;
 
     newfont->x_scale = x_scale;
     newfont->y_scale = y_scale;
@@ -37,14 +37,14 @@ static bool get_wordlen(const struct mf_font_s *font, mf_str *text,
     result->space = 0;
     result->chars = 0;
 
-    c = mf_getchar(text);
+    c = MF_GETCHAR(text);
     while (c && !is_wrap_space(c))
     {
         result->chars++;
         result->word += mf_character_width(font, c);
 
         prev = *text;
-        c = mf_getchar(text);
+        c = MF_GETCHAR(text);
     }
 
     while (c && is_wrap_space(c))
@@ -62,7 +62,7 @@ static bool get_wordlen(const struct mf_font_s *font, mf_str *text,
         }
 
         prev = *text;
-        c = mf_getchar(text);
+        c = MF_GETCHAR(text);
     }
 
     /* The last loop reads the first character of next word, put it back. */
@@ -118,7 +118,7 @@ static bool append_char(const struct mf_font_s *font, gI16 width,
     mf_char c;
     gU16 w;
 
-    c = mf_getchar(&tmp);
+    c = MF_GETCHAR(&tmp);
     w = mf_character_width(font, c);
 
     if (current->width + w <= width)
@@ -263,7 +263,7 @@ void mf_wordwrap(const struct mf_font_s *font, gI16 width,
             mf_str tmp;
 
             tmp = text;
-            c = mf_getchar(&text);
+            c = MF_GETCHAR(&text);
             new_width = lw_cur + mf_character_width(font, c);
 
             if (c == '\n')
@@ -25,6 +25,10 @@
 typedef struct GMouseReading {
 	gCoord		x, y, z;
 	gU16	buttons;
+	#if GINPUT_NEED_MULTITOUCH
+		gU8				contacts;							// The number of contacts in contact[]. 0 if the driver doesn't report contacts.
+		GTouchContact	contact[GINPUT_TOUCH_MAX_CONTACTS];	// The contacts (in raw driver coordinates)
+	#endif
 	} GMouseReading;
 
 #if !GINPUT_TOUCH_NOCALIBRATE
@@ -71,14 +71,82 @@ static GTIMER_DECL(MouseTimer);
 #if !GINPUT_TOUCH_NOCALIBRATE
 	#include <string.h>							// Required for memcpy
 
-	static GFXINLINE void CalibrationTransform(GMouseReading *pt, const GMouseCalibration *c) {
+	static GFXINLINE void CalibrationTransform(gCoord *px, gCoord *py, const GMouseCalibration *c) {
 		gCoord x, y;
 
-		x = (gCoord) (c->ax * pt->x + c->bx * pt->y + c->cx);
-		y = (gCoord) (c->ay * pt->x + c->by * pt->y + c->cy);
+		x = (gCoord) (c->ax * *px + c->bx * *py + c->cx);
+		y = (gCoord) (c->ay * *px + c->by * *py + c->cy);
 
-		pt->x = x;
-		pt->y = y;
+		*px = x;
+		*py = y;
+	}
+#endif
+
+// Apply calibration, rotation and display clipping to a raw position
+static void PositionTransform(GMouse *m, gCoord *px, gCoord *py) {
+	#if !GINPUT_TOUCH_NOCALIBRATE
+		// Do we need to calibrate the reading?
+		if ((m->flags & GMOUSE_FLG_CALIBRATE))
+			CalibrationTransform(px, py, &m->caldata);
+	#endif
+
+	// We can't clip or rotate if we don't have a display
+	if (m->display) {
+		gCoord			w, h;
+
+		// We now need display information
+		w = gdispGGetWidth(m->display);
+		h = gdispGGetHeight(m->display);
+
+		#if GDISP_NEED_CONTROL
+			// Do we need to rotate the reading to match the display
+			if (!(gmvmt(m)->d.flags & GMOUSE_VFLG_SELFROTATION)) {
+				gCoord		t;
+
+				switch(gdispGGetOrientation(m->display)) {
+					case gOrientation0:
+						break;
+					case gOrientation90:
+						t = *px;
+						*px = w - 1 - *py;
+						*py = t;
+						break;
+					case gOrientation180:
+						*px = w - 1 - *px;
+						*py = h - 1 - *py;
+						break;
+					case gOrientation270:
+						t = *py;
+						*py = h - 1 - *px;
+						*px = t;
+						break;
+					default:
+						break;
+				}
+			}
+		#endif
+
+		// Do we need to clip the reading to the display
+		if ((m->flags & GMOUSE_FLG_CLIP)) {
+			if (*px < 0)		*px = 0;
+			else if (*px >= w)	*px = w-1;
+			if (*py < 0)		*py = 0;
+			else if (*py >= h)	*py = h-1;
+		}
+	}
+}
+
+#if GINPUT_NEED_MULTITOUCH
+	static gBool ContactsChanged(const GMouseReading *r, const GMouseReading *o) {
+		unsigned	i;
+
+		if (r->contacts != o->contacts)
+			return gTrue;
+		for(i = 0; i < r->contacts; i++) {
+			if (r->contact[i].id != o->contact[i].id || r->contact[i].x != o->contact[i].x || r->contact[i].y != o->contact[i].y)
+				return gTrue;
+		}
+		return gFalse;
 	}
 #endif
 
@@ -94,7 +162,11 @@ static void SendMouseEvent(GSourceListener	*psl, GMouse *m, GMouseReading *r) {
 
 	// If we haven't really moved (and there are no meta events) don't bother sending the event
 	if (!(r->buttons & GMETA_MASK) && !psl->srcflags && !(psl->listenflags & GLISTEN_MOUSENOFILTER)
-			&& r->x == m->r.x && r->y == m->r.y && (r->buttons & GINPUT_MOUSE_BTN_MASK) == (m->r.buttons & GINPUT_MOUSE_BTN_MASK))
+			&& r->x == m->r.x && r->y == m->r.y && (r->buttons & GINPUT_MOUSE_BTN_MASK) == (m->r.buttons & GINPUT_MOUSE_BTN_MASK)
+			#if GINPUT_NEED_MULTITOUCH
+				&& (!(psl->listenflags & GLISTEN_TOUCHES) || !ContactsChanged(r, &m->r))
+			#endif
+			)
 		return;
 
 	// Send the event only if we are listening for it
@@ -114,6 +186,18 @@ static void SendMouseEvent(GSourceListener	*psl, GMouse *m, GMouseReading *r) {
 	pe->buttons = r->buttons | psl->srcflags;
 	psl->srcflags = 0;
 	pe->display = m->display;
+	#if GINPUT_NEED_MULTITOUCH
+		if ((psl->listenflags & GLISTEN_TOUCHES)) {
+			GEventTouches	*pt;
+			unsigned		i;
+
+			pt = (GEventTouches *)pe;
+			pt->type = GEVENT_TOUCHES;
+			pt->cnt = r->contacts;
+			for(i = 0; i < r->contacts; i++)
+				pt->contacts[i] = r->contact[i];
+		}
+	#endif
 	geventSendEvent(psl);
 }
 
@@ -123,6 +207,9 @@ static void GetMouseReading(GMouse *m) {
 	// Step 1 - Get the Raw Reading
 	{
 		m->flags &= ~GMOUSE_FLG_NEEDREAD;
+		#if GINPUT_NEED_MULTITOUCH
+			r.contacts = 0;
+		#endif
 		if (!gmvmt(m)->get(m, &r))
 			return;
 	}
@@ -185,60 +272,19 @@ static void GetMouseReading(GMouse *m) {
 		if ((gmvmt(m)->d.flags & GMOUSE_VFLG_ONLY_DOWN) && !(r.buttons & GINPUT_MOUSE_BTN_LEFT)) {
 			r.x = m->r.x;
 			r.y = m->r.y;
+		} else
+			PositionTransform(m, &r.x, &r.y);
 
-		} else {
-
-			#if !GINPUT_TOUCH_NOCALIBRATE
-				// Do we need to calibrate the reading?
-				if ((m->flags & GMOUSE_FLG_CALIBRATE))
-					CalibrationTransform(&r, &m->caldata);
-			#endif
-
-			// We can't clip or rotate if we don't have a display
-			if (m->display) {
-				gCoord			w, h;
-
-				// We now need display information
-				w = gdispGGetWidth(m->display);
-				h = gdispGGetHeight(m->display);
-
-				#if GDISP_NEED_CONTROL
-					// Do we need to rotate the reading to match the display
-					if (!(gmvmt(m)->d.flags & GMOUSE_VFLG_SELFROTATION)) {
-						gCoord		t;
-
-						switch(gdispGGetOrientation(m->display)) {
-							case gOrientation0:
-								break;
-							case gOrientation90:
-								t = r.x;
-								r.x = w - 1 - r.y;
-								r.y = t;
-								break;
-							case gOrientation180:
-								r.x = w - 1 - r.x;
-								r.y = h - 1 - r.y;
-								break;
-							case gOrientation270:
-								t = r.y;
-								r.y = h - 1 - r.x;
-								r.x = t;
-								break;
-							default:
-								break;
-						}
-					}
-				#endif
+		#if GINPUT_NEED_MULTITOUCH
+		{
+			unsigned	i;
 
-				// Do we need to clip the reading to the display
-				if ((m->flags & GMOUSE_FLG_CLIP)) {
-					if (r.x < 0)		r.x = 0;
-					else if (r.x >= w)	r.x = w-1;
-					if (r.y < 0)		r.y = 0;
-					else if (r.y >= h)	r.y = h-1;
-				}
-			}
+			if (r.contacts > GINPUT_TOUCH_MAX_CONTACTS)
+				r.contacts = GINPUT_TOUCH_MAX_CONTACTS;
+			for(i = 0; i < r.contacts; i++)
+				PositionTransform(m, &r.contact[i].x, &r.contact[i].y);
 		}
+		#endif
 	}
 
 	// Step 4 - Apply jitter detection
@@ -317,6 +363,16 @@ static void GetMouseReading(GMouse *m) {
 	{
 		GSourceListener	*psl;
 
+		#if GINPUT_NEED_MULTITOUCH
+			// A driver that doesn't track contacts has a single contact while the surface is touched
+			if (!r.contacts && (r.buttons & GINPUT_MOUSE_BTN_LEFT)) {
+				r.contacts = 1;
+				r.contact[0].id = 0;
+				r.contact[0].x = r.x;
+				r.contact[0].y = r.y;
+			}
+		#endif
+
 		// Send to the "All Mice" source listeners
 		psl = 0;
 		while ((psl = geventGetSourceListener((GSourceHandle)&MouseTimer, psl)))
@@ -333,6 +389,15 @@ static void GetMouseReading(GMouse *m) {
 	m->r.y = r.y;
 	m->r.z = r.z;
 	m->r.buttons = r.buttons;
+	#if GINPUT_NEED_MULTITOUCH
+	{
+		unsigned	i;
+
+		m->r.contacts = r.contacts;
+		for(i = 0; i < r.contacts; i++)
+			m->r.contact[i] = r.contact[i];
+	}
+	#endif
 }
 
 static void MousePoll(void *param) {
@@ -565,7 +630,7 @@ static void MousePoll(void *param) {
 			pj = (m->flags & GMOUSE_FLG_FINGERMODE) ? &gmvmt(m)->finger_jitter : &gmvmt(m)->pen_jitter;
 
 			// Transform the co-ordinates
-			CalibrationTransform((GMouseReading *)&points[3], &m->caldata);
+			CalibrationTransform(&points[3].x, &points[3].y, &m->caldata);
 
 			// Do we need to rotate the reading to match the display
 			#if GDISP_NEED_CONTROL
@@ -822,6 +887,51 @@ gBool ginputGetMouseStatus(unsigned instance, GEventMouse *pe) {
 	}
 #endif
 
+#if GINPUT_NEED_MULTITOUCH
+	static gCoord ContactDistance(const GTouchContact *a, const GTouchContact *b) {
+		gU32	sq, root, bit;
+
+		sq = (gU32)(a->x - b->x) * (gU32)(a->x - b->x) + (gU32)(a->y - b->y) * (gU32)(a->y - b->y);
+
+		// Integer square root
+		root = 0;
+		for(bit = 1UL << 30; bit > sq; bit >>= 2);
+		for(; bit; bit >>= 2) {
+			if (sq >= root + bit) {
+				sq -= root + bit;
+				root = (root >> 1) + bit;
+			} else
+				root >>= 1;
+		}
+		return (gCoord)root;
+	}
+
+	gBool ginputTouchGesture(const GEventTouches *from, const GEventTouches *to, GTouchGesture *pg) {
+		const GTouchContact	*f0, *f1, *t0, *t1;
+
+		if (from->cnt != 2 || to->cnt != 2)
+			return gFalse;
+
+		// Match the contacts by their tracking id as the order may change
+		f0 = &from->contacts[0];
+		f1 = &from->contacts[1];
+		if (to->contacts[0].id == f0->id && to->contacts[1].id == f1->id) {
+			t0 = &to->contacts[0];
+			t1 = &to->contacts[1];
+		} else if (to->contacts[1].id == f0->id && to->contacts[0].id == f1->id) {
+			t0 = &to->contacts[1];
+			t1 = &to->contacts[0];
+		} else
+			return gFalse;
+
+		pg->dx = ((t0->x + t1->x) - (f0->x + f1->x)) / 2;
+		pg->dy = ((t0->y + t1->y) - (f0->y + f1->y)) / 2;
+		pg->distance = ContactDistance(t0, t1);
+		pg->spread = pg->distance - ContactDistance(f0, f1);
+		return gTrue;
+	}
+#endif
+
 /* Wake up the mouse driver from an interrupt service routine (there may be new readings available) */
 void _gmouseWakeup(GMouse *m) {
 	if (m)
@@ -56,6 +56,31 @@ typedef struct GEventMouse_t {
 	GDisplay *			display;		// The display this mouse is currently associated with.
 } GEventMouse;
 
+#if GINPUT_NEED_MULTITOUCH || defined(__DOXYGEN__)
+	/* A single contact on a multi-touch surface */
+	typedef struct GTouchContact {
+		gI16			id;								// The tracking id. It stays the same while the contact remains on the surface.
+		gCoord			x, y;							// The position of the contact
+	} GTouchContact;
+
+	/* The first fields match GEventMouse so a GEVENT_TOUCHES event can also be treated as a GEventMouse */
+	typedef struct GEventTouches_t {
+		GEventType		type;							// The type of this event (GEVENT_TOUCHES)
+		gCoord			x, y, z;						// The position of the primary contact (as for GEventMouse)
+		gU16			buttons;						// The button and meta status of the primary contact (as for GEventMouse)
+		GDisplay *		display;						// The display this mouse is currently associated with.
+		gU16			cnt;							// The number of contacts currently on the surface
+		GTouchContact	contacts[GINPUT_TOUCH_MAX_CONTACTS];	// The contacts (only the first cnt are valid)
+	} GEventTouches;
+
+	/* The change between two GEVENT_TOUCHES events with the same two contacts */
+	typedef struct GTouchGesture {
+		gCoord			dx, dy;							// The movement of the midpoint between the contacts (two finger scroll)
+		gCoord			distance;						// The current distance between the contacts
+		gCoord			spread;							// The change in distance. Negative is a pinch, positive is a spread (zoom)
+	} GTouchGesture;
+#endif
+
 // Mouse/Touch Listen Flags - passed to geventAddSourceToListener()
 #define GLISTEN_MOUSEMETA			0x0001			// Create events for meta events such as CLICK and CXTCLICK
 #define GLISTEN_MOUSEDOWNMOVES		0x0002			// Creates mouse move events when the primary mouse button is down (touch is on the surface)
@@ -65,10 +90,12 @@ typedef struct GEventMouse_t {
 #define GLISTEN_TOUCHDOWNMOVES		GLISTEN_MOUSEDOWNMOVES
 #define GLISTEN_TOUCHUPMOVES		GLISTEN_MOUSEUPMOVES
 #define	GLISTEN_TOUCHNOFILTER		GLISTEN_MOUSENOFILTER
+#define GLISTEN_TOUCHES				0x0010			// Send GEVENT_TOUCHES events (all contacts) instead of GEVENT_TOUCH. Also sent when only a secondary contact moves.
 
 // Event types for the mouse ginput source
 #define GEVENT_MOUSE		(GEVENT_GINPUT_FIRST+0)
 #define GEVENT_TOUCH		(GEVENT_GINPUT_FIRST+1)
+#define GEVENT_TOUCHES		(GEVENT_GINPUT_FIRST+5)
 
 // All mice
 #define GMOUSE_ALL_INSTANCES		((unsigned)-1)
@@ -175,6 +202,22 @@ gBool LoadMouseCalibration(unsigned instance, void *data, gMemSize sz);
  */
 gBool SaveMouseCalibration(unsigned instance, const void *data, gMemSize sz);
 
+#if GINPUT_NEED_MULTITOUCH || defined(__DOXYGEN__)
+	/**
+	 * @brief	Calculate a two finger gesture from two GEVENT_TOUCHES events
+	 * @return	gTrue if both events have exactly two contacts and they are the same two contacts
+	 *
+	 * @param[in] from		The earlier event
+	 * @param[in] to		The later event
+	 * @param[out] pg		The gesture. The midpoint movement gives a two finger scroll and
+	 * 						the spread gives a pinch (negative) or zoom (positive).
+	 *
+	 * @note	Keep a copy of the event where the second contact went down (or of the last event
+	 * 			used) and compare each new event against it.
+	 */
+	gBool ginputTouchGesture(const GEventTouches *from, const GEventTouches *to, GTouchGesture *pg);
+#endif
+
 #endif /* GINPUT_NEED_MOUSE */
 
 #endif /* _GINPUT_MOUSE_H */
@@ -30,6 +30,18 @@
 	#ifndef GINPUT_NEED_MOUSE
 		#define GINPUT_NEED_MOUSE		GFXOFF
 	#endif
+	/**
+	 * @brief   Should multi-touch functions be included.
+	 * @details	Defaults to GFXOFF
+	 * @note	Listeners using the GLISTEN_TOUCHES flag then get GEVENT_TOUCHES events
+	 * 			that list every contact on the touch surface.
+	 * @note	Touch drivers that only report a single contact still work. Their one
+	 * 			contact is reported while the surface is touched.
+	 * @note	Requires GINPUT_NEED_MOUSE
+	 */
+	#ifndef GINPUT_NEED_MULTITOUCH
+		#define GINPUT_NEED_MULTITOUCH	GFXOFF
+	#endif
 	/**
 	 * @brief   Should keyboard functions be included.
 	 * @details	Defaults to GFXOFF
@@ -66,6 +78,14 @@
  * @name    GINPUT Optional Sizing Parameters
  * @{
  */
+	/**
+	 * @brief   The maximum number of touch contacts tracked for GINPUT_NEED_MULTITOUCH.
+	 * @details	Defaults to 5
+	 * @note	Contacts beyond this number are ignored.
+	 */
+	#ifndef GINPUT_TOUCH_MAX_CONTACTS
+		#define GINPUT_TOUCH_MAX_CONTACTS		5
+	#endif
 /**
  * @}
  *
@@ -53,6 +53,20 @@
 		#if !GINPUT_TOUCH_NOTOUCH && GINPUT_MOUSE_CLICK_TIME > GINPUT_TOUCH_CXTCLICK_TIME
 			#error "GINPUT MOUSE: The GINPUT_MOUSE_CLICK_TIME must be <= GINPUT_TOUCH_CXTCLICK_TIME"
 		#endif
+		#if GINPUT_NEED_MULTITOUCH && GEVENT_MAXIMUM_SIZE < 32 + 8*GINPUT_TOUCH_MAX_CONTACTS
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GINPUT: GEVENT_MAXIMUM_SIZE is too small for GINPUT_NEED_MULTITOUCH events. It has been increased for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GINPUT: GEVENT_MAXIMUM_SIZE is too small for GINPUT_NEED_MULTITOUCH events. It has been increased for you.")
+				#endif
+			#endif
+			#undef GEVENT_MAXIMUM_SIZE
+			#define GEVENT_MAXIMUM_SIZE		(32 + 8*GINPUT_TOUCH_MAX_CONTACTS)
+		#endif
+	#else
+		#undef GINPUT_NEED_MULTITOUCH
+		#define GINPUT_NEED_MULTITOUCH		GFXOFF
 	#endif
 #endif
 
@@ -95,6 +95,9 @@ GHandle _gwindowCreate(GDisplay *g, GWindowObject *pgw, const GWindowInit *pInit
 	
 	// Initialise all basic fields
 	pgw->display = g;
+	#if GWIN_NEED_OFFSCREEN || GWIN_WIDGET_CACHE
+		pgw->drawdisplay = g;
+	#endif
 	pgw->vmt = vmt;
 	pgw->color = defaultFgColor;
 	pgw->bgcolor = defaultBgColor;
@@ -135,6 +138,9 @@ void _gwinDestroy(GHandle gh, GRedrawMethod how) {
 	// Remove from the window manager
 	#if GWIN_NEED_WINDOWMANAGER
 		_GWINwm->vmt->Delete(gh);
+		#if GWIN_NEED_HITGRID
+			_gwinHitInvalidate();
+		#endif
 	#endif
 
 	// Class destroy routine
@@ -220,6 +226,7 @@ gBool gwinGetEnabled(GHandle gh) {
 #if GDISP_NEED_TEXT
 	void gwinSetFont(GHandle gh, gFont font) {
 		gh->font = font;
+		_gwidgetCacheFlush(gh);
 	}
 #endif
 
@@ -230,7 +237,7 @@ void gwinClear(GHandle gh) {
 	 * need this to clear internal buffers or similar
 	 */
 	if (_gwinDrawStart(gh)) {
-		gdispGFillArea(gh->display, gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+		gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
 		_gwinDrawEnd(gh);
 	}
 	if (gh->vmt->AfterClear)
@@ -239,44 +246,44 @@ void gwinClear(GHandle gh) {
 
 void gwinDrawPixel(GHandle gh, gCoord x, gCoord y) {
 	if (!_gwinDrawStart(gh)) return;
-	gdispGDrawPixel(gh->display, gh->x+x, gh->y+y, gh->color);
+	gdispGDrawPixel(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, gh->color);
 	_gwinDrawEnd(gh);
 }
 
 void gwinDrawLine(GHandle gh, gCoord x0, gCoord y0, gCoord x1, gCoord y1) {
 	if (!_gwinDrawStart(gh)) return;
-	gdispGDrawLine(gh->display, gh->x+x0, gh->y+y0, gh->x+x1, gh->y+y1, gh->color);
+	gdispGDrawLine(gwinGetDrawDisplay(gh), gh->x+x0, gh->y+y0, gh->x+x1, gh->y+y1, gh->color);
 	_gwinDrawEnd(gh);
 }
 
 void gwinDrawBox(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
 	if (!_gwinDrawStart(gh)) return;
-	gdispGDrawBox(gh->display, gh->x+x, gh->y+y, cx, cy, gh->color);
+	gdispGDrawBox(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, cx, cy, gh->color);
 	_gwinDrawEnd(gh);
 }
 
 void gwinFillArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
 	if (!_gwinDrawStart(gh)) return;
-	gdispGFillArea(gh->display, gh->x+x, gh->y+y, cx, cy, gh->color);
+	gdispGFillArea(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, cx, cy, gh->color);
 	_gwinDrawEnd(gh);
 }
 
 void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord srcx, gCoord srcy, gCoord srccx, const gPixel *buffer) {
 	if (!_gwinDrawStart(gh)) return;
-	gdispGBlitArea(gh->display, gh->x+x, gh->y+y, cx, cy, srcx, srcy, srccx, buffer);
+	gdispGBlitArea(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, cx, cy, srcx, srcy, srccx, buffer);
 	_gwinDrawEnd(gh);
 }
 
 #if GDISP_NEED_CIRCLE
 	void gwinDrawCircle(GHandle gh, gCoord x, gCoord y, gCoord radius) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawCircle(gh->display, gh->x+x, gh->y+y, radius, gh->color);
+		gdispGDrawCircle(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillCircle(GHandle gh, gCoord x, gCoord y, gCoord radius) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGFillCircle(gh->display, gh->x+x, gh->y+y, radius, gh->color);
+		gdispGFillCircle(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius, gh->color);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -284,7 +291,7 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_DUALCIRCLE
 	void gwinFillDualCircle(GHandle gh, gCoord x, gCoord y, gCoord radius1, gCoord radius2) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGFillDualCircle(gh->display, gh->x+x, gh->y+y, radius1, gh->bgcolor, radius2, gh->color);
+		gdispGFillDualCircle(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius1, gh->bgcolor, radius2, gh->color);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -292,13 +299,13 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_ELLIPSE
 	void gwinDrawEllipse(GHandle gh, gCoord x, gCoord y, gCoord a, gCoord b) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawEllipse(gh->display, gh->x+x, gh->y+y, a, b, gh->color);
+		gdispGDrawEllipse(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, a, b, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillEllipse(GHandle gh, gCoord x, gCoord y, gCoord a, gCoord b) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGFillEllipse(gh->display, gh->x+x, gh->y+y, a, b, gh->color);
+		gdispGFillEllipse(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, a, b, gh->color);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -306,19 +313,19 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_ARC
 	void gwinDrawArc(GHandle gh, gCoord x, gCoord y, gCoord radius, gCoord startangle, gCoord endangle) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawArc(gh->display, gh->x+x, gh->y+y, radius, startangle, endangle, gh->color);
+		gdispGDrawArc(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius, startangle, endangle, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillArc(GHandle gh, gCoord x, gCoord y, gCoord radius, gCoord startangle, gCoord endangle) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGFillArc(gh->display, gh->x+x, gh->y+y, radius, startangle, endangle, gh->color);
+		gdispGFillArc(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius, startangle, endangle, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinDrawThickArc(GHandle gh, gCoord x, gCoord y, gCoord startradius, gCoord endradius, gCoord startangle, gCoord endangle) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawThickArc(gh->display, gh->x+x, gh->y+y, startradius, endradius, startangle, endangle, gh->color);
+		gdispGDrawThickArc(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, startradius, endradius, startangle, endangle, gh->color);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -326,13 +333,13 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_ARCSECTORS
 	void gwinDrawArcSectors(GHandle gh, gCoord x, gCoord y, gCoord radius, gU8 sectors) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawArcSectors(gh->display, gh->x+x, gh->y+y, radius, sectors, gh->color);
+		gdispGDrawArcSectors(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius, sectors, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillArcSectors(GHandle gh, gCoord x, gCoord y, gCoord radius, gU8 sectors) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGFillArcSectors(gh->display, gh->x+x, gh->y+y, radius, sectors, gh->color);
+		gdispGFillArcSectors(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, radius, sectors, gh->color);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -340,7 +347,7 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_PIXELREAD
 	gColor gwinGetPixelColor(GHandle gh, gCoord x, gCoord y) {
 		if (!_gwinDrawStart(gh)) return (gColor)0;
-		return gdispGGetPixelColor(gh->display, gh->x+x, gh->y+y);
+		return gdispGGetPixelColor(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -348,37 +355,37 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_TEXT
 	void gwinDrawChar(GHandle gh, gCoord x, gCoord y, char c) {
 		if (!gh->font || !_gwinDrawStart(gh)) return;
-		gdispGDrawChar(gh->display, gh->x+x, gh->y+y, c, gh->font, gh->color);
+		gdispGDrawChar(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, c, gh->font, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillChar(GHandle gh, gCoord x, gCoord y, char c) {
 		if (!gh->font || !_gwinDrawStart(gh)) return;
-		gdispGFillChar(gh->display, gh->x+x, gh->y+y, c, gh->font, gh->color, gh->bgcolor);
+		gdispGFillChar(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, c, gh->font, gh->color, gh->bgcolor);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinDrawString(GHandle gh, gCoord x, gCoord y, const char *str) {
 		if (!gh->font || !_gwinDrawStart(gh)) return;
-		gdispGDrawString(gh->display, gh->x+x, gh->y+y, str, gh->font, gh->color);
+		gdispGDrawString(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, str, gh->font, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillString(GHandle gh, gCoord x, gCoord y, const char *str) {
 		if (!gh->font || !_gwinDrawStart(gh)) return;
-		gdispGFillString(gh->display, gh->x+x, gh->y+y, str, gh->font, gh->color, gh->bgcolor);
+		gdispGFillString(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, str, gh->font, gh->color, gh->bgcolor);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinDrawStringBox(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gJustify justify) {
 		if (!gh->font || !_gwinDrawStart(gh)) return;
-		gdispGDrawStringBox(gh->display, gh->x+x, gh->y+y, cx, cy, str, gh->font, gh->color, justify);
+		gdispGDrawStringBox(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, cx, cy, str, gh->font, gh->color, justify);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillStringBox(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, const char* str, gJustify justify) {
 		if (!gh->font || !_gwinDrawStart(gh)) return;
-		gdispGFillStringBox(gh->display, gh->x+x, gh->y+y, cx, cy, str, gh->font, gh->color, gh->bgcolor, justify);
+		gdispGFillStringBox(gwinGetDrawDisplay(gh), gh->x+x, gh->y+y, cx, cy, str, gh->font, gh->color, gh->bgcolor, justify);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -386,18 +393,18 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 #if GDISP_NEED_CONVEX_POLYGON
 	void gwinDrawPoly(GHandle gh, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawPoly(gh->display, tx+gh->x, ty+gh->y, pntarray, cnt, gh->color);
+		gdispGDrawPoly(gwinGetDrawDisplay(gh), tx+gh->x, ty+gh->y, pntarray, cnt, gh->color);
 		_gwinDrawEnd(gh);
 	}
 
 	void gwinFillConvexPoly(GHandle gh, gCoord tx, gCoord ty, const gPoint *pntarray, unsigned cnt) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGFillConvexPoly(gh->display, tx+gh->x, ty+gh->y, pntarray, cnt, gh->color);
+		gdispGFillConvexPoly(gwinGetDrawDisplay(gh), tx+gh->x, ty+gh->y, pntarray, cnt, gh->color);
 		_gwinDrawEnd(gh);
 	}
 	void gwinDrawThickLine(GHandle gh, gCoord x0, gCoord y0, gCoord x1, gCoord y1, gCoord width, gBool round) {
 		if (!_gwinDrawStart(gh)) return;
-		gdispGDrawThickLine(gh->display, gh->x+x0, gh->y+y0, gh->x+x1, gh->y+y1, gh->color, width, round);
+		gdispGDrawThickLine(gwinGetDrawDisplay(gh), gh->x+x0, gh->y+y0, gh->x+x1, gh->y+y1, gh->color, width, round);
 		_gwinDrawEnd(gh);
 	}
 #endif
@@ -407,7 +414,7 @@ void gwinBlitArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy, gCoord s
 		gdispImageError		ret;
 
 		if (!_gwinDrawStart(gh)) return GDISP_IMAGE_ERR_OK;
-		ret = gdispGImageDraw(gh->display, img, gh->x+x, gh->y+y, cx, cy, sx, sy);
+		ret = gdispGImageDraw(gwinGetDrawDisplay(gh), img, gh->x+x, gh->y+y, cx, cy, sx, sy);
 		_gwinDrawEnd(gh);
 		return ret;
 	}
@@ -44,6 +44,9 @@ typedef struct GWindowObject {
 	#endif
 	const struct gwinVMT*	vmt;				/**< The VMT for this GWIN */
 	GDisplay *				display;			/**< The display this window is on */
+	#if GWIN_NEED_OFFSCREEN || GWIN_WIDGET_CACHE
+		GDisplay *			drawdisplay;		/**< The display drawing goes to. The pixmap of an off-screen container while drawing. */
+	#endif
 	gCoord					x;					/**< The position relative to the screen */
 	gCoord					y;					/**< The position relative to the screen */
 	gCoord					width;				/**< The width of this window */
@@ -57,6 +60,12 @@ typedef struct GWindowObject {
 	#if GWIN_NEED_CONTAINERS
 		GHandle				parent;				/**< The parent window */
 	#endif
+	#if GWIN_NEED_WINDOWMANAGER && GWIN_REDRAW_DAMAGE
+		gCoord				dmgx;				/**< The area waiting to be redrawn (relative to the window) */
+		gCoord				dmgy;				/**< The area waiting to be redrawn (relative to the window) */
+		gCoord				dmgcx;				/**< The width of the area waiting to be redrawn or 0 for the whole window */
+		gCoord				dmgcy;				/**< The height of the area waiting to be redrawn */
+	#endif
 } GWindowObject, * GHandle;
 /** @} */
 
@@ -89,6 +98,23 @@ typedef struct GWindowInit {
  */
 typedef enum { GWIN_NORMAL, GWIN_MAXIMIZE, GWIN_MINIMIZE } GWindowMinMax;
 
+#if (GWIN_NEED_WINDOWMANAGER && GWIN_REDRAW_FRAMES) || defined(__DOXYGEN__)
+	/**
+	 * @brief	Redraw frame statistics
+	 * @note	Times are in milliseconds
+	 * @{
+	 */
+	typedef struct GWindowRedrawStats {
+		gU32		frames;			/**< The number of frames drawn */
+		gU32		windows;		/**< The number of window redraws done */
+		gU32		deferred;		/**< The number of window redraws put off to a later frame */
+		gU32		overruns;		/**< The number of frames that took longer than GWIN_REDRAW_FRAME_BUDGET */
+		gU32		lastTime;		/**< How long the last frame took */
+		gU32		maxTime;		/**< The longest frame */
+	} GWindowRedrawStats;
+	/** @} */
+#endif
+
 /*-------------------------------------------------
  * Window Manager functions
  *-------------------------------------------------*/
@@ -280,6 +306,25 @@ typedef enum { GWIN_NORMAL, GWIN_MAXIMIZE, GWIN_MINIMIZE } GWindowMinMax;
 	 */
 	#define gwinGetHeight(gh)			((gh)->height)
 
+	/**
+	 * @brief	Get the display that drawing for a window goes to
+	 * @return	The display to draw on
+	 *
+	 * @param[in] gh		The window
+	 *
+	 * @note	This is the window's display except while a window inside an off-screen
+	 * 			container (GWIN_NEED_OFFSCREEN) is being drawn or a cached widget rendering
+	 * 			(GWIN_WIDGET_CACHE) is being made. Then it is the pixmap being drawn into.
+	 * @note	Custom draw routines (eg for widgets) should draw to this display.
+	 *
+	 * @api
+	 */
+	#if GWIN_NEED_OFFSCREEN || GWIN_WIDGET_CACHE
+		#define gwinGetDrawDisplay(gh)		((gh)->drawdisplay)
+	#else
+		#define gwinGetDrawDisplay(gh)		((gh)->display)
+	#endif
+
 	/**
 	 * @brief	Set foreground color
 	 * @details Set the color which will be used to draw
@@ -584,6 +629,36 @@ typedef enum { GWIN_NORMAL, GWIN_MAXIMIZE, GWIN_MINIMIZE } GWindowMinMax;
 		 * @api
 		 */
 		#define gwinNoFlash(gh)		gwinSetFlashing(gh, gFalse)
+
+		#if GWIN_REDRAW_FRAMES || defined(__DOXYGEN__)
+			/**
+			 * @brief	Allow a window's redraw to be put off to a later frame
+			 *
+			 * @param[in] gh			The window handle
+			 * @param[in] deferrable	gTrue if the redraw can wait when a frame runs out of time
+			 *
+			 * @note	Once a frame has taken GWIN_REDRAW_FRAME_BUDGET milliseconds the rest of the
+			 * 			deferrable windows are left for the next frame. At least one is drawn in each frame.
+			 * @note	A window that overlaps a window that has been put off is also put off so that
+			 * 			they are still drawn in z-order. This doesn't apply with GWIN_REDRAW_OCCLUSION.
+			 * @pre		Requires GWIN_REDRAW_FRAMES to be GFXON
+			 *
+			 * @api
+			 */
+			void gwinSetRedrawDeferrable(GHandle gh, gBool deferrable);
+
+			/**
+			 * @brief	Get the redraw frame statistics
+			 *
+			 * @param[out] pstats		The statistics are returned here
+			 * @param[in] reset			Clear the statistics after reading them
+			 *
+			 * @pre		Requires GWIN_REDRAW_FRAMES to be GFXON
+			 *
+			 * @api
+			 */
+			void gwinGetRedrawStats(GWindowRedrawStats *pstats, gBool reset);
+		#endif
 	#endif
 
 	#if GDISP_NEED_TEXT || defined(__DOXYGEN__)
@@ -171,10 +171,10 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		if (gw->g.vmt != (gwinVMT *)&buttonVMT)	return;
 		pcol = getButtonColors(gw);
 
-		gdispGFillStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
-		//gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
-		//gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
+		//gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
+		//gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);
 
 		// Render highlighted border if focused
 		_gwidgetDrawFocusRect(gw, 1, 1, gw->g.width-2, gw->g.height-2);
@@ -182,9 +182,6 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 #else
 	void gwinButtonDraw_Normal(GWidgetObject *gw, void *param) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		fixed				dalpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 
 		(void)				param;
@@ -195,13 +192,11 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		/* Fill the box blended from variants of the fill color */
 		tcol = gdispBlendColor(GFX_WHITE, pcol->fill, BTN_TOP_FADE);
 		bcol = gdispBlendColor(GFX_BLACK, pcol->fill, BTN_BOTTOM_FADE);
-		dalpha = FIXED(255)/gw->g.height;
-		for(alpha = 0, i = 0; i < gw->g.height; i++, alpha += dalpha)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+i, gw->g.x+gw->g.width-2, gw->g.y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+		gdispGFillGradient(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width-1, gw->g.height, gGradientVertical, tcol, bcol);
 
-		gdispGDrawStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
-		gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
 
 		// Render highlighted border if focused
 		_gwidgetDrawFocusRect(gw, 0, 0, gw->g.width-1, gw->g.height-1);
@@ -217,14 +212,14 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		if (gw->g.vmt != (gwinVMT *)&buttonVMT)	return;
 		pcol = getButtonColors(gw);
 
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
 		if (gw->g.width >= 2*BTN_CNR_SIZE+10) {
-			gdispGFillRoundedBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, BTN_CNR_SIZE-1, pcol->fill);
-			gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+BTN_CNR_SIZE, gw->g.width-2, gw->g.height-(2*BTN_CNR_SIZE), gw->text, gw->g.font, pcol->text, gJustifyCenter);
-			gdispGDrawRoundedBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, BTN_CNR_SIZE, pcol->edge);
+			gdispGFillRoundedBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, BTN_CNR_SIZE-1, pcol->fill);
+			gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+BTN_CNR_SIZE, gw->g.width-2, gw->g.height-(2*BTN_CNR_SIZE), gw->text, gw->g.font, pcol->text, gJustifyCenter);
+			gdispGDrawRoundedBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, BTN_CNR_SIZE, pcol->edge);
 		} else {
-			gdispGFillStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
-			gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);
+			gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
+			gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);
 		}
 	}
 #endif
@@ -238,10 +233,10 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		if (gw->g.vmt != (gwinVMT *)&buttonVMT)	return;
 		pcol = getButtonColors(gw);
 
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
-		gdispGFillEllipse(gw->g.display, gw->g.x+gw->g.width/2, gw->g.y+gw->g.height/2, gw->g.width/2-2, gw->g.height/2-2, pcol->fill);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
-		gdispGDrawEllipse(gw->g.display, gw->g.x+gw->g.width/2, gw->g.y+gw->g.height/2, gw->g.width/2-1, gw->g.height/2-1, pcol->edge);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+		gdispGFillEllipse(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width/2, gw->g.y+gw->g.height/2, gw->g.width/2-2, gw->g.height/2-2, pcol->fill);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGDrawEllipse(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width/2, gw->g.y+gw->g.height/2, gw->g.width/2-1, gw->g.height/2-1, pcol->edge);
 	}
 #endif
 
@@ -291,10 +286,10 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		/* arw[6].x set */											arw[6].y = arw[1].y;
 
 		// Draw
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
-		gdispGFillConvexPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->fill);
-		gdispGDrawPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->edge);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+		gdispGFillConvexPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->fill);
+		gdispGDrawPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 	}
 
 	void gwinButtonDraw_ArrowDown(GWidgetObject *gw, void *param) {
@@ -342,10 +337,10 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		/* arw[6].x set */											arw[6].y = arw[1].y;
 
 		// Draw
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
-		gdispGFillConvexPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->fill);
-		gdispGDrawPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->edge);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+		gdispGFillConvexPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->fill);
+		gdispGDrawPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 	}
 
 	void gwinButtonDraw_ArrowLeft(GWidgetObject *gw, void *param) {
@@ -393,10 +388,10 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		arw[6].x = arw[1].x;										/* arw[6].y set */
 
 		// Draw
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
-		gdispGFillConvexPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->fill);
-		gdispGDrawPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->edge);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+		gdispGFillConvexPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->fill);
+		gdispGDrawPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 	}
 
 	void gwinButtonDraw_ArrowRight(GWidgetObject *gw, void *param) {
@@ -444,10 +439,10 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 		arw[6].x = arw[1].x;										/* arw[6].y set */
 
 		// Draw
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
-		gdispGFillConvexPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->fill);
-		gdispGDrawPoly(gw->g.display, gw->g.x, gw->g.y, arw, 7, pcol->edge);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+		gdispGFillConvexPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->fill);
+		gdispGDrawPoly(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, arw, 7, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 	}
 #endif
 
@@ -467,8 +462,8 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 			sy = 0;
 		}
 
-		gdispGImageDraw(gw->g.display, (gImage *)param, gw->g.x, gw->g.y, gw->g.width, gw->g.height, 0, sy);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGImageDraw(gwinGetDrawDisplay(&gw->g), (gImage *)param, gw->g.x, gw->g.y, gw->g.width, gw->g.height, 0, sy);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 	}
 
 	void gwinButtonDraw_Image_Icon(GWidgetObject *gw, void *param) {
@@ -489,18 +484,18 @@ static const GColorSet *getButtonColors(GWidgetObject *gw) {
 */
 
 		// Draw the box
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width/*-1*/, gw->g.height/*-1*/, pcol->fill);
-		//gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width/*-1*/, gw->g.height/*-1*/, gw->g.bgcolor);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width/*-1*/, gw->g.height/*-1*/, pcol->fill);
+		//gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width/*-1*/, gw->g.height/*-1*/, gw->g.bgcolor);
 
 		// Draw the icon
-		gdispGImageDraw(gw->g.display, (gdispImage *)param, gw->g.x+16, gw->g.y+6, gw->g.width, gw->g.height, 0, sy);
+		gdispGImageDraw(gwinGetDrawDisplay(&gw->g), (gdispImage *)param, gw->g.x+16, gw->g.y+6, gw->g.width, gw->g.height, 0, sy);
 
 		// Draw Text below
-		gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1+25, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, justifyCenter );
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1+25, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, justifyCenter );
 
 
-		//gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
-		//gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
+		//gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
+		//gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
 
 		// Render highlighted border if focused
 		//_gwidgetDrawFocusRect(gw, 1, 1, gw->g.width-2, gw->g.height-2);
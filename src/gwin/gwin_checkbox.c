@@ -184,19 +184,19 @@ void gwinCheckboxDraw_CheckOnLeft(GWidgetObject *gw, void *param) {
 	ld = gw->g.width < gw->g.height ? gw->g.width : gw->g.height;
 
 	// Draw the empty check box
-	gdispGFillArea(gw->g.display, gw->g.x+1, gw->g.y+1, ld, ld-2, gw->pstyle->background);
-	gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, ld, ld, pcol->edge);
+	gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, ld, ld-2, gw->pstyle->background);
+	gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, ld, ld, pcol->edge);
 
 	// Draw the check
 	df = ld < 4 ? 1 : 2;
 	if (gw->g.flags & GCHECKBOX_FLG_CHECKED)
-		gdispGFillArea(gw->g.display, gw->g.x+df, gw->g.y+df, ld-2*df, ld-2*df, pcol->fill);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+df, gw->g.y+df, ld-2*df, ld-2*df, pcol->fill);
 
 	// Render highlighted border if focused
 	_gwidgetDrawFocusRect(gw, 1, 1, ld-2, ld-2);
 
 	// Draw the text
-	gdispGFillStringBox(gw->g.display, gw->g.x+ld+1, gw->g.y, gw->g.width-ld-1, gw->g.height, gw->text, gw->g.font, pcol->text, gw->pstyle->background, gJustifyLeft);
+	gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+ld+1, gw->g.y, gw->g.width-ld-1, gw->g.height, gw->text, gw->g.font, pcol->text, gw->pstyle->background, gJustifyLeft);
 	#undef gcw
 }
 
@@ -216,19 +216,19 @@ void gwinCheckboxDraw_CheckOnRight(GWidgetObject *gw, void *param) {
 	ep = gw->g.width-ld;
 
 	// Draw the empty check box
-	gdispGFillArea(gw->g.display, gw->g.x+ep-1, gw->g.y+1, ld, ld-2, gw->pstyle->background);
-	gdispGDrawBox(gw->g.display, gw->g.x+ep, gw->g.y, ld, ld, pcol->edge);
+	gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+ep-1, gw->g.y+1, ld, ld-2, gw->pstyle->background);
+	gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x+ep, gw->g.y, ld, ld, pcol->edge);
 
 	// Draw the check
 	df = ld < 4 ? 1 : 2;
 	if (gw->g.flags & GCHECKBOX_FLG_CHECKED)
-		gdispGFillArea(gw->g.display, gw->g.x+ep+df, gw->g.y+df, ld-2*df, ld-2*df, pcol->fill);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+ep+df, gw->g.y+df, ld-2*df, ld-2*df, pcol->fill);
 
 	// Render highlighted border if focused
 	_gwidgetDrawFocusRect(gw, ep+1, 1, ld-2, ld-2);
 
 	// Draw the text
-	gdispGFillStringBox(gw->g.display, gw->g.x, gw->g.y, ep-1, gw->g.height, gw->text, gw->g.font, pcol->text, gw->pstyle->background, gJustifyRight);
+	gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, ep-1, gw->g.height, gw->text, gw->g.font, pcol->text, gw->pstyle->background, gJustifyRight);
 	#undef gcw
 }
 
@@ -245,16 +245,13 @@ void gwinCheckboxDraw_CheckOnRight(GWidgetObject *gw, void *param) {
 			pcol = _gwinGetFlashedColor(gw, pcol, gTrue);
 		#endif
 
-		gdispGFillStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
-		gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
 	}
 #else
 	void gwinCheckboxDraw_Button(GWidgetObject *gw, void *param) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		fixed				dalpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 		(void)				param;
 
@@ -269,13 +266,11 @@ void gwinCheckboxDraw_CheckOnRight(GWidgetObject *gw, void *param) {
 		/* Fill the box blended from variants of the fill color */
 		tcol = gdispBlendColor(GFX_WHITE, pcol->fill, CHK_TOP_FADE);
 		bcol = gdispBlendColor(GFX_BLACK, pcol->fill, CHK_BOTTOM_FADE);
-		dalpha = FIXED(255)/gw->g.height;
-		for(alpha = 0, i = 0; i < gw->g.height; i++, alpha += dalpha)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+i, gw->g.x+gw->g.width-2, gw->g.y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
+		gdispGFillGradient(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width-1, gw->g.height, gGradientVertical, tcol, bcol);
 
-		gdispGDrawStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
-		gdispGDrawLine(gw->g.display, gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width-1, gw->g.height-1, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gw->g.width-1, gw->g.y, gw->g.x+gw->g.width-1, gw->g.y+gw->g.height-1, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gw->g.height-1, gw->g.x+gw->g.width-2, gw->g.y+gw->g.height-1, pcol->edge);
 	}
 #endif
 
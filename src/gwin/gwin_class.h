@@ -204,6 +204,27 @@ GHandle _gwindowCreate(GDisplay *g, GWindowObject *pgw, const GWindowInit *pInit
  */
 void _gwinUpdate(GHandle gh);
 
+#if GWIN_REDRAW_DAMAGE || defined(__DOXYGEN__)
+	/**
+	 * @brief	Redraw part of the window after a status change.
+	 *
+	 * @param[in]	gh		The window to redraw
+	 * @param[in]	x,y		The top left corner of the changed area (relative to the window)
+	 * @param[in]	cx,cy	The size of the changed area
+	 *
+	 * @note	The redraw is clipped to the changed area so the draw routine must be able
+	 * 			to redraw any part of the window from scratch.
+	 * @note	Changes made before the window is redrawn are merged. If the whole window is
+	 * 			already waiting to be redrawn this adds nothing.
+	 * @note	Without GWIN_REDRAW_DAMAGE this is the same as @p _gwinUpdate()
+	 *
+	 * @notapi
+	 */
+	void _gwinUpdateArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy);
+#else
+	#define _gwinUpdateArea(gh, x, y, cx, cy)		((void)(x), (void)(y), (void)(cx), (void)(cy), _gwinUpdate(gh))
+#endif
+
 /**
  * @brief	How to flush the redraws
  * @notes	REDRAW_WAIT			- Wait for a drawing session to be available
@@ -268,6 +289,42 @@ void _gwinDestroy(GHandle gh, GRedrawMethod how);
  */
 gBool _gwinWMAdd(GHandle gh, const GWindowInit *pInit);
 
+#if (GWIN_NEED_WINDOWMANAGER && GWIN_NEED_HITGRID) || defined(__DOXYGEN__)
+	/**
+	 * @brief	Mark the hit grids as out of date
+	 *
+	 * @note	This must be called whenever a window is added, deleted, moved, resized or changes z-order.
+	 * 			The grids are rebuilt the next time they are used.
+	 * 			Visibility changes don't need this as the visibility is tested on each hit.
+	 *
+	 * @notapi
+	 */
+	void _gwinHitInvalidate(void);
+
+	/**
+	 * @brief	Find the top most visible window under a point
+	 * @return	The window or NULL if there is no visible window at that point
+	 *
+	 * @param[in]	g		The display
+	 * @param[in]	x,y		The point in display coordinates
+	 *
+	 * @note	If the grid for the display is out of date it is rebuilt first.
+	 *
+	 * @notapi
+	 */
+	GHandle _gwinHitTest(GDisplay *g, gCoord x, gCoord y);
+
+	/**
+	 * @brief	Get the slot that records the window that has captured the mouse on a display
+	 * @return	A pointer to the slot or NULL if there is not enough memory to track the display
+	 *
+	 * @param[in]	g		The display
+	 *
+	 * @notapi
+	 */
+	GHandle *_gwinHitCapture(GDisplay *g);
+#endif
+
 #if GWIN_NEED_WIDGET || defined(__DOXYGEN__)
 	/**
 	 * @brief	Initialise (and allocate if necessary) the base Widget object
@@ -393,8 +450,41 @@ gBool _gwinWMAdd(GHandle gh, const GWindowInit *pInit);
 		 */
 		const GColorSet *_gwinGetFlashedColor(GWidgetObject *gw, const GColorSet *pcol, gBool flashOffState);
 	#endif
+
+	#if (GWIN_NEED_LABEL && GWIN_REDRAW_DAMAGE) || defined(__DOXYGEN__)
+		/**
+		 * @brief	Get the columns of a label that its text is drawn in
+		 * @return	gFalse if the window is not a label drawn by a built-in routine
+		 *
+		 * @param[in]	gh		The window
+		 * @param[out]	px		The first column (relative to the window)
+		 * @param[out]	pcx		The number of columns
+		 *
+		 * @note	Used to only redraw the old and new text when the text of a label is changed.
+		 *
+		 * @notapi
+		 */
+		gBool _gwinLabelTextArea(GHandle gh, gCoord *px, gCoord *pcx);
+	#endif
+
+	#if GWIN_WIDGET_CACHE || defined(__DOXYGEN__)
+		/**
+		 * @brief	Throw away the cached renderings of a widget
+		 *
+		 * @param[in]	gh		The window
+		 *
+		 * @note	Call this when something the widget draw routine uses changes other than
+		 * 			the widget size or state flags.
+		 *
+		 * @notapi
+		 */
+		void _gwidgetCacheFlush(GHandle gh);
+	#else
+		#define _gwidgetCacheFlush(gh)
+	#endif
 #else
 	#define _gwinFixFocus(gh)
+	#define _gwidgetCacheFlush(gh)
 #endif
 
 #if GWIN_NEED_CONTAINERS || defined(__DOXYGEN__)
@@ -25,6 +25,7 @@
 // Our control flags
 #define GCONSOLE_FLG_NOSTORE					(GWIN_FIRST_CONTROL_FLAG<<0)
 #define GCONSOLE_FLG_OVERRUN					(GWIN_FIRST_CONTROL_FLAG<<1)
+#define GCONSOLE_FLG_NODRAW						(GWIN_FIRST_CONTROL_FLAG<<2)
 
 // Meaning of our attribute bits.
 #define	ESC_REDBIT		0x01
@@ -140,25 +141,68 @@
 #endif
 
 #if GWIN_CONSOLE_USE_HISTORY
+	static void PutChar(GHandle gh, char c);
+
 	static void HistoryDestroy(GWindowObject *gh) {
 		#define gcw		((GConsoleObject *)gh)
 
 		// Deallocate the history buffer if required.
 		if (gcw->buffer) {
-			gfxFree(gcw->buffer);
+			gfxFree(gcw->lines);
 			gcw->buffer = 0;
 		}
 
 		#undef gcw
 	}
 
+	/**
+	 * Empty the history buffer
+	 */
+	static void resetBuffer(GConsoleObject *gcw) {
+		gcw->bufstart = 0;
+		gcw->buflen = 0;
+		gcw->linefirst = 0;
+		gcw->linecnt = 1;
+		gcw->lines[0].start = 0;
+	}
+
+	/**
+	 * Remove the first line from the history buffer.
+	 * The line index tells us where the next line starts so nothing needs to be searched or moved.
+	 */
+	static void dropLine(GConsoleObject *gcw) {
+		struct GConsoleLine	*pl;
+		gMemSize			len;
+
+		// Was there a newline, if not delete everything.
+		if (gcw->linecnt <= 1) {
+			#if GWIN_CONSOLE_ESCSEQ
+				gcw->startattr = gcw->currattr;
+			#endif
+			resetBuffer(gcw);
+			return;
+		}
+
+		// Move the start of the buffer to the second line
+		if (++gcw->linefirst >= gcw->linesize)
+			gcw->linefirst = 0;
+		gcw->linecnt--;
+		pl = gcw->lines + gcw->linefirst;
+		if (pl->start > gcw->bufstart)
+			len = pl->start - gcw->bufstart;
+		else
+			len = pl->start + gcw->bufsize - gcw->bufstart;		// Wrapped (or the line filled the whole buffer)
+		gcw->bufstart = pl->start;
+		gcw->buflen -= len;
+		#if GWIN_CONSOLE_ESCSEQ
+			gcw->startattr = pl->attr;
+		#endif
+	}
+
 	/**
 	 * Scroll the history buffer by one line
 	 */
 	static void scrollBuffer(GConsoleObject *gcw) {
-		char	*p, *ep;
-		gPtrDiff	dp;
-
 		// Only scroll if we need to
 		if (!gcw->buffer || (gcw->g.flags & GCONSOLE_FLG_NOSTORE))
 			return;
@@ -169,31 +213,31 @@
 			return;
 		}
 
-		// Remove one line from the start
-		ep = gcw->buffer+gcw->bufpos;
-		for(p = gcw->buffer; p < ep && *p != '\n'; p++) {
-			#if GWIN_CONSOLE_ESCSEQ
-				if (*p == 27)
-					ESCtoAttr(p[1], &gcw->startattr);
-			#endif
-		}
+		dropLine(gcw);
+	}
 
-		// Was there a newline, if not delete everything.
-		if (p >= ep) {
-			gcw->bufpos = 0;
-			return;
+	/**
+	 * Print the history buffer
+	 */
+	static void HistoryReplay(GWindowObject *gh) {
+		#define gcw		((GConsoleObject *)gh)
+		gMemSize	pos, len;
+
+		for(pos = gcw->bufstart, len = gcw->buflen; len; len--) {
+			PutChar(gh, gcw->buffer[pos]);
+			if (++pos >= gcw->bufsize)
+				pos = 0;
 		}
 
-		// Delete the data
-		dp = ++p - gcw->buffer;						// Calculate the amount to to be removed
-		gcw->bufpos -= dp;							// Calculate the new size
-		if (gcw->bufpos)
-			memcpy(gcw->buffer, p, gcw->bufpos);	// Move the rest of the data
+		#undef gcw
 	}
 
 	static void HistoryRedraw(GWindowObject *gh) {
 		#define gcw		((GConsoleObject *)gh)
 		gCoord fy;
+		#if GWIN_CONSOLE_ESCSEQ
+			gU16	escstate;
+		#endif
 
 		// No redrawing if there is no history
 		if (!gcw->buffer)
@@ -211,8 +255,25 @@
 
 		#if !GWIN_CONSOLE_USE_CLEAR_LINES
 			// Clear the screen
-			gdispGFillArea(gh->display, gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+			gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+		#endif
+
+		// Don't let a half received escape sequence swallow the first character
+		#if GWIN_CONSOLE_ESCSEQ
+			escstate = gcw->escstate;
+			gcw->escstate = 0;
+		#endif
+
+		// Count the lines that scroll off the top (eg. after the window got narrower) so only the visible lines are drawn
+		gh->flags |= GCONSOLE_FLG_NODRAW;
+		gcw->pending = 0;
+		gcw->cx = 0;
+		gcw->cy = 0;
+		#if GWIN_CONSOLE_ESCSEQ
+			gcw->currattr = gcw->startattr;
 		#endif
+		HistoryReplay(gh);
+		gh->flags &= ~GCONSOLE_FLG_NODRAW;
 
 		// Reset the cursor
 		gcw->cx = 0;
@@ -224,7 +285,11 @@
 		#endif
 
 		// Print the buffer
-		gwinPutCharArray(gh, gcw->buffer, gcw->bufpos);
+		HistoryReplay(gh);
+
+		#if GWIN_CONSOLE_ESCSEQ
+			gcw->escstate = escstate;
+		#endif
 
 		#if GWIN_CONSOLE_USE_CLEAR_LINES
 			// Clear the remaining space
@@ -235,7 +300,7 @@
 				if (gcw->cx)
 					y += gdispGetFontMetric(gh->font, gFontHeight);
 				if (y < gh->height)
-					gdispGFillArea(gh->display, gh->x, gh->y+y, gh->width, gh->height-y, gh->bgcolor);
+					gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y+y, gh->width, gh->height-y, gh->bgcolor);
 			}
 		#endif
 
@@ -249,15 +314,16 @@
 	 * Put a character into our history buffer
 	 */
 	static void putCharInBuffer(GConsoleObject *gcw, char c) {
+		struct GConsoleLine	*pl;
+		gMemSize			pos;
+		unsigned			line;
+
 		// Only store if we need to
 		if (!gcw->buffer || (gcw->g.flags & GCONSOLE_FLG_NOSTORE))
 			return;
 
 		// Do we have enough space in the buffer
-		if (gcw->bufpos >= gcw->bufsize) {
-			char	*p, *ep;
-			gPtrDiff	dp;
-
+		if (gcw->buflen >= gcw->bufsize) {
 			/**
 			 * This should never really happen except if the user has changed the window
 			 * size without turning off and then on the buffer. Even then it is unlikely
@@ -268,31 +334,42 @@
 			 * than one line will lead to some interesting scrolling and refreshing
 			 * effects.
 			 */
-
-			// Remove one line from the start
-			ep = gcw->buffer+gcw->bufpos;
-			for(p = gcw->buffer; p < ep && *p != '\n'; p++) {
-				#if GWIN_CONSOLE_ESCSEQ
-					if (*p == 27)
-						ESCtoAttr(p[1], &gcw->startattr);
-				#endif
-			}
-
-			// Was there a newline?
-			if (*p != '\n')
-				p = gcw->buffer;						// Oops - no newline, just delete one char
-			else
+			if (gcw->linecnt > 1) {
+				dropLine(gcw);
 				gcw->g.flags |= GCONSOLE_FLG_OVERRUN;	// Mark the overrun
-
-			// Delete the data
-			dp = ++p - gcw->buffer;						// Calculate the amount to to be removed
-			gcw->bufpos -= dp;							// Calculate the new size
-			if (gcw->bufpos)
-				memcpy(gcw->buffer, p, gcw->bufpos);	// Move the rest of the data
+			} else {
+				// Oops - no newline, just delete one char
+				if (++gcw->bufstart >= gcw->bufsize)
+					gcw->bufstart = 0;
+				gcw->buflen--;
+				gcw->lines[gcw->linefirst].start = gcw->bufstart;
+			}
 		}
 
 		// Save the character
-		gcw->buffer[gcw->bufpos++] = c;
+		pos = gcw->bufstart + gcw->buflen++;
+		if (pos >= gcw->bufsize)
+			pos -= gcw->bufsize;
+		gcw->buffer[pos] = c;
+
+		// A newline starts the next line in the index
+		if (c == '\n') {
+			// The same applies to the line index as to the buffer
+			if (gcw->linecnt >= gcw->linesize) {
+				dropLine(gcw);
+				gcw->g.flags |= GCONSOLE_FLG_OVERRUN;
+			}
+			if (++pos >= gcw->bufsize)
+				pos = 0;
+			line = gcw->linefirst + gcw->linecnt++;
+			if (line >= gcw->linesize)
+				line -= gcw->linesize;
+			pl = gcw->lines + line;
+			pl->start = pos;
+			#if GWIN_CONSOLE_ESCSEQ
+				pl->attr = gcw->currattr;
+			#endif
+		}
 	}
 
 	/**
@@ -304,7 +381,7 @@
 		if (!gcw->buffer || (gcw->g.flags & GCONSOLE_FLG_NOSTORE))
 			return;
 
-		gcw->bufpos = 0;
+		resetBuffer(gcw);
 	}
 
 #else
@@ -354,6 +431,7 @@ GHandle gwinGConsoleCreate(GDisplay *g, GConsoleObject *gc, const GWindowInit *p
 
 	gc->cx = 0;
 	gc->cy = 0;
+	gc->pending = 0;
 
 	#if GWIN_CONSOLE_ESCSEQ
 		gc->startattr = gc->currattr = 0;
@@ -385,7 +463,7 @@ GHandle gwinGConsoleCreate(GDisplay *g, GConsoleObject *gc, const GWindowInit *p
 		// Do we want the buffer turned off?
 		if (!onoff) {
 			if (gcw->buffer) {
-				gfxFree(gcw->buffer);
+				gfxFree(gcw->lines);
 				gcw->buffer = 0;
 			}
 			return gFalse;
@@ -404,15 +482,20 @@ GHandle gwinGConsoleCreate(GDisplay *g, GConsoleObject *gc, const GWindowInit *p
 		gcw->bufsize++;				// Allow space for a newline on each line.
 
 		// Multiply by the number of lines
-		gcw->bufsize *= gh->height / gdispGetFontMetric(gh->font, gFontHeight);
+		gcw->linesize = gh->height / gdispGetFontMetric(gh->font, gFontHeight);
+		gcw->bufsize *= gcw->linesize;
+
+		// Allow for the partially filled line at the bottom and the lazy scroll
+		gcw->linesize += 2;
 
-		// Allocate the buffer
-		if (!(gcw->buffer = gfxAlloc(gcw->bufsize)))
+		// Allocate the line index and the buffer together
+		if (!(gcw->lines = gfxAlloc(gcw->linesize * sizeof(struct GConsoleLine) + gcw->bufsize)))
 			return gFalse;
+		gcw->buffer = (char *)(gcw->lines + gcw->linesize);
 
 		// All good!
 		gh->flags &= ~GCONSOLE_FLG_OVERRUN;
-		gcw->bufpos = 0;
+		resetBuffer(gcw);
 		return gTrue;
 		
 		#undef gcw
@@ -420,23 +503,34 @@ GHandle gwinGConsoleCreate(GDisplay *g, GConsoleObject *gc, const GWindowInit *p
 #endif
 
 /*
- *  We can get into gwinPutChar() 2 ways -
+ *  We can get into PutChar() 3 ways -
  *  	1. when the user calls us, and
  *  	2. when the redraw uses us to redraw the display.
+ *  	3. when a batched write or the redraw is only working out where the text goes.
  *  When called by option 2 we MUST not try to obtain a draw session
- *  as we already have one.
+ *  as we already have one. When called by option 3 we must not draw at all.
  *
  *  We use these macro's below to make sure we do that safely
  */
-#define DrawStart(gh)		((gh->flags & GCONSOLE_FLG_NOSTORE) || _gwinDrawStart(gh))
+#define DrawStart(gh)		(!(gh->flags & GCONSOLE_FLG_NODRAW) && ((gh->flags & GCONSOLE_FLG_NOSTORE) || _gwinDrawStart(gh)))
 #define DrawEnd(gh)			{ if (!(gh->flags & GCONSOLE_FLG_NOSTORE)) _gwinDrawEnd(gh); }
 
-void gwinPutChar(GHandle gh, char c) {
+/**
+ * Get the display position of the cursor line.
+ * A batched write scrolls the display once before printing so, until the cursor catches up,
+ * the cursor line is drawn higher up or not at all if it has already scrolled off the top.
+ */
+static gBool CursorLine(GConsoleObject *gcw, gCoord fy, gCoord *py) {
+	if (gcw->pending && gcw->pending > (gMemSize)(gcw->cy / fy))
+		return gFalse;
+	*py = gcw->g.y + gcw->cy - (gCoord)gcw->pending * fy;
+	return gTrue;
+}
+
+static void PutChar(GHandle gh, char c) {
 	#define gcw		((GConsoleObject *)gh)
 	gU8			width, fy;
-
-	if (gh->vmt != &consoleVMT || !gh->font)
-		return;
+	gCoord		y;
 
 	fy = gdispGetFontMetric(gh->font, gFontHeight);
 
@@ -469,7 +563,7 @@ void gwinPutChar(GHandle gh, char c) {
 					// Clear the console and reset the cursor
 					clearBuffer(gcw);
 					if (DrawStart(gh)) {
-						gdispGFillArea(gh->display, gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+						gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
 						DrawEnd(gh);
 					}
 					gcw->cx = 0;
@@ -496,8 +590,8 @@ void gwinPutChar(GHandle gh, char c) {
 	case '\n':
 		// clear to the end of the line
 		#if GWIN_CONSOLE_USE_CLEAR_LINES
-			if (gcw->cx == 0 && gcw->cy+fy < gh->height && DrawStart(gh)) {
-				gdispGFillArea(gh->display, gh->x, gh->y + gcw->cy, gh->width, fy, gh->bgcolor);
+			if (gcw->cx == 0 && gcw->cy+fy < gh->height && CursorLine(gcw, fy, &y) && DrawStart(gh)) {
+				gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, y, gh->width, fy, gh->bgcolor);
 				DrawEnd(gh);
 			}
 		#endif
@@ -538,11 +632,21 @@ void gwinPutChar(GHandle gh, char c) {
 
 	// Do we need to scroll to fit this character?
 	if (gcw->cy + fy > gh->height) {
+		if ((gh->flags & GCONSOLE_FLG_NODRAW) || gcw->pending) {
+			// Part of a batch - the display gets scrolled once for the whole batch
+			if ((gh->flags & GCONSOLE_FLG_NODRAW))
+				gcw->pending++;
+			else
+				gcw->pending--;
+			scrollBuffer(gcw);
+			gcw->cx = 0;
+			gcw->cy = (((gCoord)(gh->height/fy))-1)*fy;
+		} else
 		#if GWIN_CONSOLE_USE_HISTORY && GWIN_CONSOLE_BUFFER_SCROLLING
 			if (gcw->buffer) {
 				// If flag GCONSOLE_FLG_NOSTORE is set, then do not recursivly call HistoryRedraw - just drop the buffer
 				if (gh->flags & GCONSOLE_FLG_NOSTORE)
-					gcw->bufpos = 0;
+					resetBuffer(gcw);
 					
 				// Scroll the buffer and then redraw using the buffer
 				scrollBuffer(gcw);
@@ -557,7 +661,7 @@ void gwinPutChar(GHandle gh, char c) {
 				// Scroll the console using hardware
 				scrollBuffer(gcw);
 				if (DrawStart(gh)) {
-					gdispGVerticalScroll(gh->display, gh->x, gh->y, gh->width, gh->height, fy, gh->bgcolor);
+					gdispGVerticalScroll(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, fy, gh->bgcolor);
 					DrawEnd(gh);
 				}
 
@@ -570,7 +674,7 @@ void gwinPutChar(GHandle gh, char c) {
 				// Clear the console and reset the cursor
 				clearBuffer(gcw);
 				if (DrawStart(gh)) {
-					gdispGFillArea(gh->display, gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+					gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
 					DrawEnd(gh);
 				}
 				gcw->cx = 0;
@@ -586,29 +690,29 @@ void gwinPutChar(GHandle gh, char c) {
 	putCharInBuffer(gcw, c);
 
 	// Draw the character
-	if (DrawStart(gh)) {
+	if (CursorLine(gcw, fy, &y) && DrawStart(gh)) {
 
 		// If we are at the beginning of a new line clear the line
 		#if GWIN_CONSOLE_USE_CLEAR_LINES
 			if (gcw->cx == 0)
-				gdispGFillArea(gh->display, gh->x, gh->y + gcw->cy, gh->width, fy, gh->bgcolor);
+				gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, y, gh->width, fy, gh->bgcolor);
 		#endif
 
 		#if GWIN_CONSOLE_USE_FILLED_CHARS
-			gdispGFillChar(gh->display, gh->x + gcw->cx, gh->y + gcw->cy, c, gh->font, ESCPrintColor(gcw), gh->bgcolor);
+			gdispGFillChar(gwinGetDrawDisplay(gh), gh->x + gcw->cx, y, c, gh->font, ESCPrintColor(gcw), gh->bgcolor);
 		#else
-			gdispGDrawChar(gh->display, gh->x + gcw->cx, gh->y + gcw->cy, c, gh->font, ESCPrintColor(gcw));
+			gdispGDrawChar(gwinGetDrawDisplay(gh), gh->x + gcw->cx, y, c, gh->font, ESCPrintColor(gcw));
 		#endif
 
 		#if GWIN_CONSOLE_ESCSEQ
 			// Draw the underline
 			if ((gcw->currattr & ESC_UNDERLINE))
-				gdispGDrawLine(gh->display, gh->x + gcw->cx, gh->y + gcw->cy + fy - gdispGetFontMetric(gh->font, gFontDescendersHeight),
-											gh->x + gcw->cx + width + gdispGetFontMetric(gh->font, gFontCharPadding), gh->y + gcw->cy + fy - gdispGetFontMetric(gh->font, gFontDescendersHeight),
+				gdispGDrawLine(gwinGetDrawDisplay(gh), gh->x + gcw->cx, y + fy - gdispGetFontMetric(gh->font, gFontDescendersHeight),
+											gh->x + gcw->cx + width + gdispGetFontMetric(gh->font, gFontCharPadding), y + fy - gdispGetFontMetric(gh->font, gFontDescendersHeight),
 											ESCPrintColor(gcw));
 			// Bold (very crude)
 			if ((gcw->currattr & ESC_BOLD))
-				gdispGDrawChar(gh->display, gh->x + gcw->cx + 1, gh->y + gcw->cy, c, gh->font, ESCPrintColor(gcw));
+				gdispGDrawChar(gwinGetDrawDisplay(gh), gh->x + gcw->cx + 1, y, c, gh->font, ESCPrintColor(gcw));
 		#endif
 
 		DrawEnd(gh);
@@ -620,14 +724,132 @@ void gwinPutChar(GHandle gh, char c) {
 	#undef gcw
 }
 
+void gwinPutChar(GHandle gh, char c) {
+	if (gh->vmt != &consoleVMT || !gh->font)
+		return;
+
+	PutChar(gh, c);
+}
+
 void gwinPutString(GHandle gh, const char *str) {
-	while(*str)
-		gwinPutChar(gh, *str++);
+	gwinPutCharArray(gh, str, strlen(str));
+}
+
+/**
+ * Work out how many lines the start of a batch scrolls the console by (returned in gcw->pending)
+ * without drawing or storing anything. Returns how many characters belong to the batch.
+ */
+static gMemSize MeasureBatch(GHandle gh, const char *str, gMemSize n) {
+	#define gcw		((GConsoleObject *)gh)
+	gU32		flags;
+	gCoord		cx, cy;
+	gMemSize	i;
+	#if GWIN_CONSOLE_ESCSEQ
+		gU8		startattr, currattr;
+		gU16	escstate;
+	#endif
+
+	// Save the console state
+	flags = gh->flags & (GCONSOLE_FLG_NODRAW|GCONSOLE_FLG_NOSTORE);
+	cx = gcw->cx;
+	cy = gcw->cy;
+	#if GWIN_CONSOLE_ESCSEQ
+		startattr = gcw->startattr;
+		currattr = gcw->currattr;
+		escstate = gcw->escstate;
+	#endif
+
+	gh->flags |= GCONSOLE_FLG_NODRAW|GCONSOLE_FLG_NOSTORE;
+	gcw->pending = 0;
+	for(i = 0; i < n;) {
+		#if GWIN_CONSOLE_ESCSEQ
+			// A clear screen ends the batch as the lines before it don't need to be scrolled
+			if (gcw->escstate == 1 && str[i] == 'J') {
+				i++;
+				break;
+			}
+		#endif
+		PutChar(gh, str[i++]);
+	}
+
+	// Restore the console state
+	gh->flags = (gh->flags & ~(GCONSOLE_FLG_NODRAW|GCONSOLE_FLG_NOSTORE)) | flags;
+	gcw->cx = cx;
+	gcw->cy = cy;
+	#if GWIN_CONSOLE_ESCSEQ
+		gcw->startattr = startattr;
+		gcw->currattr = currattr;
+		gcw->escstate = escstate;
+	#endif
+	return i;
+
+	#undef gcw
 }
 
 void gwinPutCharArray(GHandle gh, const char *str, gMemSize n) {
-	while(n--)
-		gwinPutChar(gh, *str++);
+	#define gcw		((GConsoleObject *)gh)
+	gMemSize	len;
+	#if GWIN_CONSOLE_USE_HISTORY && GWIN_CONSOLE_BUFFER_SCROLLING
+		gU32		nodraw;
+	#endif
+	#if GDISP_NEED_SCROLL
+		gMemSize	fy;
+	#endif
+
+	if (gh->vmt != &consoleVMT || !gh->font)
+		return;
+
+	#if !GDISP_NEED_SCROLL
+		#if GWIN_CONSOLE_USE_HISTORY && GWIN_CONSOLE_BUFFER_SCROLLING
+			if (!gcw->buffer)
+		#endif
+		{
+			// Without scrolling a full console is just cleared so there is nothing to gain from batching
+			while(n--)
+				PutChar(gh, *str++);
+			return;
+		}
+	#endif
+
+	while(n) {
+		len = MeasureBatch(gh, str, n);
+		n -= len;
+
+		if (gcw->pending) {
+			#if GWIN_CONSOLE_USE_HISTORY && GWIN_CONSOLE_BUFFER_SCROLLING
+				if (gcw->buffer) {
+					// Store the batch without drawing it and then redraw once using the buffer
+					nodraw = gh->flags & GCONSOLE_FLG_NODRAW;
+					gh->flags |= GCONSOLE_FLG_NODRAW;
+					while(len--)
+						PutChar(gh, *str++);
+					gh->flags = (gh->flags & ~GCONSOLE_FLG_NODRAW) | nodraw;
+					gcw->pending = 0;
+					if (DrawStart(gh)) {
+						HistoryRedraw(gh);
+						DrawEnd(gh);
+					}
+					continue;
+				}
+			#endif
+			#if GDISP_NEED_SCROLL
+				// Scroll the console using hardware - once for the whole batch
+				if (DrawStart(gh)) {
+					fy = gdispGetFontMetric(gh->font, gFontHeight);
+					gdispGVerticalScroll(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height,
+						gcw->pending * fy < (gMemSize)gh->height ? (int)(gcw->pending * fy) : gh->height,
+						gh->bgcolor);
+					DrawEnd(gh);
+				}
+			#endif
+		}
+
+		// Print the batch. The lines scrolled in advance are caught up as the cursor reaches them.
+		while(len--)
+			PutChar(gh, *str++);
+	}
+
+	#undef gcw
 }
 
 #include <stdarg.h>
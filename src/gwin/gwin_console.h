@@ -40,11 +40,23 @@ typedef struct GConsoleObject {
 	#endif
 
 	#if GWIN_CONSOLE_USE_HISTORY
-		char *		buffer;			// buffer to store console content
+		char *		buffer;			// ring buffer to store console content
 		gMemSize	bufsize;		// size of buffer
-		gMemSize	bufpos;			// the position of the next char
+		gMemSize	bufstart;		// the position of the first char
+		gMemSize	buflen;			// the number of chars in the buffer
+		struct GConsoleLine {		// where each line starts in the buffer
+			gMemSize	start;
+			#if GWIN_CONSOLE_ESCSEQ
+				gU8		attr;		// the attributes at the start of the line
+			#endif
+		} *			lines;
+		unsigned	linesize;		// size of the line index
+		unsigned	linefirst;		// the index of the first line
+		unsigned	linecnt;		// the number of lines in the buffer
 	#endif
 
+	gMemSize		pending;		// Lines a batched write has already scrolled the display by
+
 	#if GFX_USE_OS_CHIBIOS && GWIN_CONSOLE_USE_BASESTREAM
 		struct GConsoleWindowStream_t {
 			const struct GConsoleWindowVMT_t *vmt;
@@ -139,6 +151,9 @@ void gwinPutString(GHandle gh, const char *str);
  * @param[in] str	The string to draw
  * @param[in] n		The number of characters to draw
  *
+ * @note	The whole array is written as one batch. If it scrolls the console the display is scrolled
+ * 			(or redrawn from the history buffer) once for the batch rather than once for each line.
+ *
  * @api
  */
 void gwinPutCharArray(GHandle gh, const char *str, gMemSize n);
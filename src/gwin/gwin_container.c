@@ -150,7 +150,7 @@ void gwinContainerDraw_Transparent(GWidgetObject *gw, void *param) {
 		return;
 
 	if ((gw->g.flags & GWIN_CONTAINER_BORDER))
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, (gw->g.flags & GWIN_FLG_SYSENABLED) ? gw->pstyle->enabled.edge : gw->pstyle->disabled.edge);
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, (gw->g.flags & GWIN_FLG_SYSENABLED) ? gw->pstyle->enabled.edge : gw->pstyle->disabled.edge);
 
 	// Don't touch the client area
 }
@@ -161,7 +161,7 @@ void gwinContainerDraw_Std(GWidgetObject *gw, void *param) {
 	if (gw->g.vmt != (gwinVMT *)&containerVMT)
 		return;
 
-	gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
+	gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->pstyle->background);
 	gwinContainerDraw_Transparent(gw, param);
 }
 
@@ -194,7 +194,7 @@ void gwinContainerDraw_Std(GWidgetObject *gw, void *param) {
 			for(iw=gi->width; x < mx; x += iw) {
 				if (iw > mx - x)
 					iw = mx - x;
-				gdispGImageDraw(gw->g.display, gi, x, y, iw, ih, 0, 0);
+				gdispGImageDraw(gwinGetDrawDisplay(&gw->g), gi, x, y, iw, ih, 0, 0);
 			}
 		}
 
@@ -94,6 +94,27 @@ gCoord gwinGetInnerWidth(GHandle gh);
  */
 gCoord gwinGetInnerHeight(GHandle gh);
 
+#if GWIN_NEED_OFFSCREEN || defined(__DOXYGEN__)
+	/**
+	 * @brief	Draw a container and its children off-screen
+	 *
+	 * @return	gFalse if this is not a container or there is not enough memory for the pixmap
+	 *
+	 * @param[in] gh			The container
+	 * @param[in] offscreen		gTrue to draw into a pixmap, gFalse to draw directly to the display again
+	 *
+	 * @note	The container and its children are drawn into a pixmap the size of the container which is then
+	 * 			copied to the display. Updates are tear and flicker free and when the container is uncovered
+	 * 			it is copied back from the pixmap without redrawing anything.
+	 * @note	If an off-screen container is inside another off-screen container only the outer one is used.
+	 * @note	This only works with the default window manager.
+	 * @pre		GWIN_NEED_OFFSCREEN must be GFXON
+	 *
+	 * @api
+	 */
+	gBool gwinSetOffscreen(GHandle gh, gBool offscreen);
+#endif
+
 
 /**
  * @brief	 Flags for gwinContainerCreate()
@@ -29,6 +29,11 @@ static const GGraphStyle GGraphDefaultStyle = {
 	GWIN_GRAPH_STYLE_XAXIS_ARROWS|GWIN_GRAPH_STYLE_YAXIS_ARROWS		// flags
 };
 
+#if GWIN_GRAPH_STREAMING
+	static void GraphDestroy(GHandle gh);
+	static void GraphRedraw(GHandle gh);
+#endif
+
 static const gwinVMT graphVMT = {
 		"Graph",				// The classname
 		sizeof(GGraphObject),	// The object size
@@ -37,6 +42,20 @@ static const gwinVMT graphVMT = {
 		0,						// The after-clear routine
 };
 
+#if GWIN_GRAPH_STREAMING
+	// A streaming graph remembers what it draws so it can redraw itself
+	static const gwinVMT streamVMT = {
+			"Graph",				// The classname
+			sizeof(GGraphObject),	// The object size
+			GraphDestroy,			// The destroy routine
+			GraphRedraw,			// The redraw routine
+			0,						// The after-clear routine
+	};
+	#define IsGraph(gh)		((gh)->vmt == &graphVMT || (gh)->vmt == &streamVMT)
+#else
+	#define IsGraph(gh)		((gh)->vmt == &graphVMT)
+#endif
+
 static void pointto(GGraphObject *gg, gCoord x, gCoord y, const GGraphPointStyle *style) {
 	if (style->type == GGRAPH_POINT_NONE)
 		return;
@@ -46,22 +65,22 @@ static void pointto(GGraphObject *gg, gCoord x, gCoord y, const GGraphPointStyle
 	y = gg->g.y + gg->g.height - 1 - gg->yorigin - y;
 
 	if (style->size <= 1) {
-		gdispGDrawPixel(gg->g.display, x, y, style->color);
+		gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), x, y, style->color);
 		return;
 	}
 
 	switch(style->type) {
 	case GGRAPH_POINT_SQUARE:
-		gdispGDrawBox(gg->g.display, x-style->size, y-style->size, 2*style->size, 2*style->size, style->color);
+		gdispGDrawBox(gwinGetDrawDisplay(&gg->g), x-style->size, y-style->size, 2*style->size, 2*style->size, style->color);
 		break;
 #if GDISP_NEED_CIRCLE
 	case GGRAPH_POINT_CIRCLE:
-		gdispGDrawCircle(gg->g.display, x, y, style->size, style->color);
+		gdispGDrawCircle(gwinGetDrawDisplay(&gg->g), x, y, style->size, style->color);
 		break;
 #endif
 	case GGRAPH_POINT_DOT:
 	default:
-		gdispGDrawPixel(gg->g.display, x, y, style->color);
+		gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), x, y, style->color);
 		break;
 	}
 }
@@ -83,7 +102,7 @@ static void lineto(GGraphObject *gg, gCoord x0, gCoord y0, gCoord x1, gCoord y1,
 
 	if (style->size <= 0) {
 		// Use the driver to draw a solid line
-		gdispGDrawLine(gg->g.display, x0, y0, x1, y1, style->color);
+		gdispGDrawLine(gwinGetDrawDisplay(&gg->g), x0, y0, x1, y1, style->color);
 		return;
 	}
 
@@ -101,7 +120,7 @@ static void lineto(GGraphObject *gg, gCoord x0, gCoord y0, gCoord x1, gCoord y1,
 	case GGRAPH_LINE_SOLID:
 	default:
 		// Use the driver to draw a solid line
-		gdispGDrawLine(gg->g.display, x0, y0, x1, y1, style->color);
+		gdispGDrawLine(gwinGetDrawDisplay(&gg->g), x0, y0, x1, y1, style->color);
 		return;
 	}
 
@@ -131,7 +150,7 @@ static void lineto(GGraphObject *gg, gCoord x0, gCoord y0, gCoord x1, gCoord y1,
 			if (run++ >= 0) {
 				if (run >= run_on)
 					run = run_off;
-				gdispGDrawPixel(gg->g.display, x0, y0, style->color);
+				gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), x0, y0, style->color);
 			}
 			if (P < 0) {
 				P  += dy;
@@ -151,7 +170,7 @@ static void lineto(GGraphObject *gg, gCoord x0, gCoord y0, gCoord x1, gCoord y1,
 			if (run++ >= 0) {
 				if (run >= run_on)
 					run = run_off;
-				gdispGDrawPixel(gg->g.display, x0, y0, style->color);
+				gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), x0, y0, style->color);
 			}
 			if (P < 0) {
 				P  += dx;
@@ -170,6 +189,10 @@ GHandle gwinGGraphCreate(GDisplay *g, GGraphObject *gg, const GWindowInit *pInit
 		return 0;
 	gg->xorigin = gg->yorigin = 0;
 	gg->lastx = gg->lasty = 0;
+	#if GWIN_GRAPH_STREAMING
+		gg->series = 0;
+		gg->samples = 0;
+	#endif
 	gwinGraphSetStyle((GHandle)gg, &GGraphDefaultStyle);
 	gwinSetVisible((GHandle)gg, pInit->show);
 	_gwinFlushRedraws(REDRAW_WAIT);
@@ -179,7 +202,7 @@ GHandle gwinGGraphCreate(GDisplay *g, GGraphObject *gg, const GWindowInit *pInit
 void gwinGraphSetStyle(GHandle gh, const GGraphStyle *pstyle) {
 	#define gg	((GGraphObject *)gh)
 
-	if (gh->vmt != &graphVMT)
+	if (!IsGraph(gh))
 		return;
 
 	gg->style.point = pstyle->point;
@@ -196,7 +219,7 @@ void gwinGraphSetStyle(GHandle gh, const GGraphStyle *pstyle) {
 void gwinGraphSetOrigin(GHandle gh, gCoord x, gCoord y) {
 	#define gg	((GGraphObject *)gh)
 
-	if (gh->vmt != &graphVMT)
+	if (!IsGraph(gh))
 		return;
 
 	gg->xorigin = x;
@@ -205,17 +228,40 @@ void gwinGraphSetOrigin(GHandle gh, gCoord x, gCoord y) {
 	#undef gg
 }
 
-void gwinGraphDrawAxis(GHandle gh) {
-	#define gg	((GGraphObject *)gh)
-	gCoord		i, xmin, ymin, xmax, ymax;
+static void DrawArrows(GGraphObject *gg, gCoord xmin, gCoord xmax, gCoord ymin, gCoord ymax) {
+	if ((gg->style.flags & GWIN_GRAPH_STYLE_XAXIS_NEGATIVE_ARROWS)) {
+		if (xmin > 0 || xmin < -(GGRAPH_ARROW_SIZE+1)) {
+			lineto(gg, xmin, 0, xmin+GGRAPH_ARROW_SIZE, GGRAPH_ARROW_SIZE, &gg->style.xaxis);
+			lineto(gg, xmin, 0, xmin+GGRAPH_ARROW_SIZE, -GGRAPH_ARROW_SIZE, &gg->style.xaxis);
+		}
+	}
+	if ((gg->style.flags & GWIN_GRAPH_STYLE_XAXIS_POSITIVE_ARROWS)) {
+		if (xmax < 0 || xmax > (GGRAPH_ARROW_SIZE+1)) {
+			lineto(gg, xmax, 0, xmax-GGRAPH_ARROW_SIZE, GGRAPH_ARROW_SIZE, &gg->style.xaxis);
+			lineto(gg, xmax, 0, xmax-GGRAPH_ARROW_SIZE, -GGRAPH_ARROW_SIZE, &gg->style.xaxis);
+		}
+	}
+	if ((gg->style.flags & GWIN_GRAPH_STYLE_YAXIS_NEGATIVE_ARROWS)) {
+		if (ymin > 0 || ymin < -(GGRAPH_ARROW_SIZE+1)) {
+			lineto(gg, 0, ymin, GGRAPH_ARROW_SIZE, ymin+GGRAPH_ARROW_SIZE, &gg->style.yaxis);
+			lineto(gg, 0, ymin, -GGRAPH_ARROW_SIZE, ymin+GGRAPH_ARROW_SIZE, &gg->style.yaxis);
+		}
+	}
+	if ((gg->style.flags & GWIN_GRAPH_STYLE_YAXIS_POSITIVE_ARROWS)) {
+		if (ymax < 0 || ymax > (GGRAPH_ARROW_SIZE+1)) {
+			lineto(gg, 0, ymax, GGRAPH_ARROW_SIZE, ymax-GGRAPH_ARROW_SIZE, &gg->style.yaxis);
+			lineto(gg, 0, ymax, -GGRAPH_ARROW_SIZE, ymax-GGRAPH_ARROW_SIZE, &gg->style.yaxis);
+		}
+	}
+}
 
-	if (gh->vmt != &graphVMT || !_gwinDrawStart(gh))
-		return;
+static void DrawAxis(GGraphObject *gg) {
+	gCoord		i, xmin, ymin, xmax, ymax;
 
 	xmin = -gg->xorigin;
-	xmax = gh->width-gg->xorigin-1;
+	xmax = gg->g.width-gg->xorigin-1;
 	ymin = -gg->yorigin;
-	ymax = gh->height-gg->yorigin-1;
+	ymax = gg->g.height-gg->yorigin-1;
 
 	// x grid - this code assumes that the GGraphGridStyle is a superset of GGraphListStyle
 	if (gg->style.xgrid.type != GGRAPH_LINE_NONE && gg->style.xgrid.spacing >= 2) {
@@ -235,40 +281,232 @@ void gwinGraphDrawAxis(GHandle gh) {
 
 	// x axis
 	lineto(gg, xmin, 0, xmax, 0, &gg->style.xaxis);
-	if ((gg->style.flags & GWIN_GRAPH_STYLE_XAXIS_NEGATIVE_ARROWS)) {
-		if (xmin > 0 || xmin < -(GGRAPH_ARROW_SIZE+1)) {
-			lineto(gg, xmin, 0, xmin+GGRAPH_ARROW_SIZE, GGRAPH_ARROW_SIZE, &gg->style.xaxis);
-			lineto(gg, xmin, 0, xmin+GGRAPH_ARROW_SIZE, -GGRAPH_ARROW_SIZE, &gg->style.xaxis);
+
+	// y axis
+	lineto(gg, 0, ymin, 0, ymax, &gg->style.yaxis);
+
+	// The arrows
+	DrawArrows(gg, xmin, xmax, ymin, ymax);
+}
+
+#if GWIN_GRAPH_STREAMING
+	/**
+	 * Get the columns (in graph coordinates) of the streaming plot area - to the right of the y axis.
+	 */
+	static gBool StreamArea(GGraphObject *gg, gCoord *px0, gCoord *px1) {
+		*px0 = gg->xorigin >= 0 ? 1 : -gg->xorigin;
+		*px1 = gg->g.width - gg->xorigin - 1;
+		return *px0 <= *px1;
+	}
+
+	/**
+	 * Get the first column shown when the newest sample is in the given column
+	 */
+	static gU32 StreamFirstColumn(gU32 clast, gCoord ncols) {
+		return clast >= (gU32)ncols ? clast - (ncols - 1) : 0;
+	}
+
+	/**
+	 * Get the minimum, maximum and last value of a series in a column.
+	 * Returns gFalse if none of the samples in the column are kept.
+	 */
+	static gBool StreamColumn(GGraphObject *gg, gU32 c, unsigned series, gCoord *pmin, gCoord *pmax, gCoord *plast) {
+		gU32		a0, a1;
+		unsigned	slot;
+		gCoord		v;
+
+		// The samples in the column that we still have
+		a0 = c * gg->decimate;
+		a1 = a0 + gg->decimate;
+		if (a1 > gg->total)
+			a1 = gg->total;
+		if (a0 < gg->total - gg->count)
+			a0 = gg->total - gg->count;
+		if (a0 >= a1)
+			return gFalse;
+
+		// Where the first of them is in the ring
+		slot = gg->total - a0;
+		slot = gg->head >= slot ? gg->head - slot : gg->head + gg->depth - slot;
+
+		*pmin = *pmax = gg->samples[slot * gg->nseries + series];
+		while(++a0 < a1) {
+			if (++slot >= gg->depth)
+				slot = 0;
+			v = gg->samples[slot * gg->nseries + series];
+			if (v < *pmin) *pmin = v;
+			if (v > *pmax) *pmax = v;
 		}
+		*plast = gg->samples[slot * gg->nseries + series];
+		return gTrue;
 	}
-	if ((gg->style.flags & GWIN_GRAPH_STYLE_XAXIS_POSITIVE_ARROWS)) {
-		if (xmax < 0 || xmax > (GGRAPH_ARROW_SIZE+1)) {
-			lineto(gg, xmax, 0, xmax-GGRAPH_ARROW_SIZE, GGRAPH_ARROW_SIZE, &gg->style.xaxis);
-			lineto(gg, xmax, 0, xmax-GGRAPH_ARROW_SIZE, -GGRAPH_ARROW_SIZE, &gg->style.xaxis);
+
+	/**
+	 * Is a horizontal line pattern drawn at this position
+	 */
+	static gBool StreamPattern(const GGraphLineStyle *style, gU32 pos) {
+		if (style->type == GGRAPH_LINE_NONE)
+			return gFalse;
+		if (style->size <= 0)
+			return gTrue;
+		switch(style->type) {
+		case GGRAPH_LINE_DOT:
+			return pos % (style->size+1) == 0;
+		case GGRAPH_LINE_DASH:
+			return pos % (2*style->size) < (gU32)style->size;
+		default:
+			return gTrue;
 		}
 	}
 
-	// y axis
-	lineto(gg, 0, ymin, 0, ymax, &gg->style.yaxis);
-	if ((gg->style.flags & GWIN_GRAPH_STYLE_YAXIS_NEGATIVE_ARROWS)) {
-		if (ymin > 0 || ymin < -(GGRAPH_ARROW_SIZE+1)) {
-			lineto(gg, 0, ymin, GGRAPH_ARROW_SIZE, ymin+GGRAPH_ARROW_SIZE, &gg->style.yaxis);
-			lineto(gg, 0, ymin, -GGRAPH_ARROW_SIZE, ymin+GGRAPH_ARROW_SIZE, &gg->style.yaxis);
+	/**
+	 * Draw some columns of the streaming plot area.
+	 * If clip is set the drawing is clipped to the columns so the lines and points that reach into them from either
+	 * side can be drawn too. Nothing is drawn to the left of the plot area so the full area can be drawn without clipping.
+	 * The grid and axis patterns are positioned by the column number so that they scroll along with the samples.
+	 */
+	static void StreamDraw(GGraphObject *gg, gCoord x0, gCoord x1, gBool clip) {
+		const GGraphSeries	*ps;
+		gCoord				sx0, sx1, ymin, ymax, x, y, i, m;
+		gCoord				vmin, vmax, vlast, pmin, pmax, plast;
+		gU32				cfirst, clast, c, c0, c1, pos;
+		gBool				prev;
+		unsigned			s;
+
+		if (!StreamArea(gg, &sx0, &sx1))
+			return;
+		if (x0 < sx0)
+			x0 = sx0;
+		if (x1 > sx1)
+			x1 = sx1;
+		if (x0 > x1)
+			return;
+
+		ymin = -gg->yorigin;
+		ymax = gg->g.height-gg->yorigin-1;
+		clast = gg->total ? (gg->total - 1) / gg->decimate : 0;
+		cfirst = StreamFirstColumn(clast, sx1 - sx0 + 1);
+
+		if (clip)
+			gdispGSetClip(gwinGetDrawDisplay(&gg->g), gg->g.x + gg->xorigin + x0, gg->g.y, x1 - x0 + 1, gg->g.height);
+		gdispGFillArea(gwinGetDrawDisplay(&gg->g), gg->g.x + gg->xorigin + x0, gg->g.y, x1 - x0 + 1, gg->g.height, gg->g.bgcolor);
+
+		// The background of each column
+		for(x = x0; x <= x1; x++) {
+			c = cfirst + (x - sx0);
+
+			// Position in the patterns when the stream started at the left of the plot area
+			pos = c + sx0 + gg->xorigin;
+
+			// x grid
+			if (gg->style.xgrid.type != GGRAPH_LINE_NONE && gg->style.xgrid.spacing >= 2 && (c + sx0) % gg->style.xgrid.spacing == 0)
+				lineto(gg, x, ymin, x, ymax, (GGraphLineStyle *)&gg->style.xgrid);
+
+			// y grid
+			if (gg->style.ygrid.spacing >= 2 && StreamPattern((GGraphLineStyle *)&gg->style.ygrid, pos)) {
+				for(i = gg->style.ygrid.spacing; i <= ymax; i += gg->style.ygrid.spacing)
+					gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), gg->g.x + gg->xorigin + x, gg->g.y + gg->g.height - 1 - gg->yorigin - i, gg->style.ygrid.color);
+				for(i = -gg->style.ygrid.spacing; i >= ymin; i -= gg->style.ygrid.spacing)
+					gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), gg->g.x + gg->xorigin + x, gg->g.y + gg->g.height - 1 - gg->yorigin - i, gg->style.ygrid.color);
+			}
+
+			// x axis
+			if (StreamPattern(&gg->style.xaxis, pos))
+				gdispGDrawPixel(gwinGetDrawDisplay(&gg->g), gg->g.x + gg->xorigin + x, gg->g.y + gg->g.height - 1 - gg->yorigin, gg->style.xaxis.color);
+		}
+		DrawArrows(gg, -gg->xorigin, sx1, ymin, ymax);
+
+		// The series
+		for(s = 0, ps = gg->series; s < gg->nseries && gg->total; s++, ps++) {
+
+			// Include enough columns either side to cover anything that reaches into the area
+			m = 1 + (ps->point.size > 0 ? ps->point.size : 0);
+			c0 = cfirst + (x0 - sx0);
+			c0 = c0 > cfirst + m ? c0 - m : cfirst;
+			c1 = cfirst + (x1 - sx0) + m;
+			if (c1 > clast)
+				c1 = clast;
+
+			// The lines
+			prev = c0 > cfirst && StreamColumn(gg, c0-1, s, &pmin, &pmax, &plast);
+			for(c = c0; c <= c1; c++) {
+				if (!StreamColumn(gg, c, s, &vmin, &vmax, &vlast)) {
+					prev = gFalse;
+					continue;
+				}
+				x = sx0 + (gCoord)(c - cfirst);
+				if (gg->decimate > 1) {
+					// The range of the column joined to the previous column
+					if (prev) {
+						if (plast < vmin) vmin = plast;
+						if (plast > vmax) vmax = plast;
+					}
+					lineto(gg, x, vmin, x, vmax, &ps->line);
+				} else if (prev)
+					lineto(gg, x-1, plast, x, vlast, &ps->line);
+				prev = gTrue;
+				plast = vlast;
+			}
+
+			// The points
+			if (gg->decimate <= 1 && ps->point.type != GGRAPH_POINT_NONE) {
+				for(c = c0; c <= c1; c++) {
+					x = sx0 + (gCoord)(c - cfirst);
+					if (x - ps->point.size >= sx0 && StreamColumn(gg, c, s, &vmin, &vmax, &y))
+						pointto(gg, x, y, &ps->point);
+				}
+			}
 		}
+
+		if (clip)
+			gdispGSetClip(gwinGetDrawDisplay(&gg->g), gg->g.x, gg->g.y, gg->g.width, gg->g.height);
 	}
-	if ((gg->style.flags & GWIN_GRAPH_STYLE_YAXIS_POSITIVE_ARROWS)) {
-		if (ymax < 0 || ymax > (GGRAPH_ARROW_SIZE+1)) {
-			lineto(gg, 0, ymax, GGRAPH_ARROW_SIZE, ymax-GGRAPH_ARROW_SIZE, &gg->style.yaxis);
-			lineto(gg, 0, ymax, -GGRAPH_ARROW_SIZE, ymax-GGRAPH_ARROW_SIZE, &gg->style.yaxis);
+
+	static void GraphDestroy(GHandle gh) {
+		#define gg	((GGraphObject *)gh)
+
+		if (gg->series) {
+			gfxFree(gg->series);
+			gg->series = 0;
+			gg->samples = 0;
 		}
+
+		// Without a stream it is a plain graph again
+		gh->vmt = &graphVMT;
+
+		#undef gg
+	}
+
+	static void GraphRedraw(GHandle gh) {
+		#define gg	((GGraphObject *)gh)
+
+		gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+		DrawAxis(gg);
+		StreamDraw(gg, 0, gh->width - gg->xorigin, gFalse);
+
+		#undef gg
 	}
+#endif
+
+void gwinGraphDrawAxis(GHandle gh) {
+	#define gg	((GGraphObject *)gh)
+
+	if (!IsGraph(gh) || !_gwinDrawStart(gh))
+		return;
+
+	DrawAxis(gg);
+
+	#if GWIN_GRAPH_STREAMING
+		if (gg->samples)
+			StreamDraw(gg, 0, gh->width - gg->xorigin, gFalse);
+	#endif
 
 	_gwinDrawEnd(gh);
 	#undef gg
 }
 
 void gwinGraphStartSet(GHandle gh) {
-	if (gh->vmt != &graphVMT)
+	if (!IsGraph(gh))
 		return;
 
 	gh->flags &= ~GGRAPH_FLG_CONNECTPOINTS;
@@ -277,7 +515,7 @@ void gwinGraphStartSet(GHandle gh) {
 void gwinGraphDrawPoint(GHandle gh, gCoord x, gCoord y) {
 	#define gg	((GGraphObject *)gh)
 
-	if (gh->vmt != &graphVMT || !_gwinDrawStart(gh))
+	if (!IsGraph(gh) || !_gwinDrawStart(gh))
 		return;
 
 	if ((gh->flags & GGRAPH_FLG_CONNECTPOINTS)) {
@@ -306,7 +544,7 @@ void gwinGraphDrawPoints(GHandle gh, const gPoint *points, unsigned count) {
 	unsigned		i;
 	const gPoint	*p;
 
-	if (gh->vmt != &graphVMT || !_gwinDrawStart(gh))
+	if (!IsGraph(gh) || !_gwinDrawStart(gh))
 		return;
 
 	// Draw the connecting lines
@@ -336,4 +574,150 @@ void gwinGraphDrawPoints(GHandle gh, const gPoint *points, unsigned count) {
 	#undef gg
 }
 
+#if GWIN_GRAPH_STREAMING
+	gBool gwinGraphSetStream(GHandle gh, unsigned series, unsigned decimate) {
+		#define gg	((GGraphObject *)gh)
+		gCoord		x0, x1;
+		unsigned	i;
+
+		if (!IsGraph(gh))
+			return gFalse;
+
+		// Throw away any existing stream
+		GraphDestroy(gh);
+		if (!series)
+			return gFalse;
+
+		// Keep enough samples to fill the plot area plus one column
+		if (!decimate)
+			decimate = 1;
+		gg->depth = StreamArea(gg, &x0, &x1) ? x1 - x0 + 2 : 1;
+		gg->depth *= decimate;
+
+		// Allocate the series styles and the samples together
+		if (!(gg->series = gfxAlloc(series * sizeof(GGraphSeries) + gg->depth * series * sizeof(gCoord))))
+			return gFalse;
+		gg->samples = (gCoord *)(gg->series + series);
+		for(i = 0; i < series; i++) {
+			gg->series[i].point = gg->style.point;
+			gg->series[i].line = gg->style.line;
+		}
+		gg->nseries = series;
+		gg->decimate = decimate;
+		gg->head = gg->count = 0;
+		gg->total = 0;
+		gh->vmt = &streamVMT;
+		return gTrue;
+
+		#undef gg
+	}
+
+	void gwinGraphSetStreamStyle(GHandle gh, unsigned series, const GGraphPointStyle *ppoint, const GGraphLineStyle *pline) {
+		#define gg	((GGraphObject *)gh)
+
+		if (gh->vmt != &streamVMT || series >= gg->nseries)
+			return;
+
+		if (ppoint)
+			gg->series[series].point = *ppoint;
+		if (pline)
+			gg->series[series].line = *pline;
+
+		#undef gg
+	}
+
+	void gwinGraphStreamAdd(GHandle gh, const gCoord *samples, unsigned count) {
+		#define gg	((GGraphObject *)gh)
+		gCoord		sx0, sx1, ncols, x0, reach;
+		#if GDISP_NEED_SCROLL && !GWIN_REDRAW_OCCLUSION
+			gCoord	x1, shift;
+		#endif
+		gU32		oldtotal, ofirst, olast, cfirst, clast;
+		unsigned	i;
+
+		if (gh->vmt != &streamVMT || !count)
+			return;
+
+		// Save the samples
+		oldtotal = gg->total;
+		for(; count; count--) {
+			for(i = 0; i < gg->nseries; i++)
+				gg->samples[gg->head * gg->nseries + i] = *samples++;
+			if (++gg->head >= gg->depth)
+				gg->head = 0;
+			if (gg->count < gg->depth)
+				gg->count++;
+			gg->total++;
+		}
+
+		if (!StreamArea(gg, &sx0, &sx1) || !_gwinDrawStart(gh))
+			return;
+
+		// Which columns are shown before and after
+		ncols = sx1 - sx0 + 1;
+		olast = oldtotal ? (oldtotal - 1) / gg->decimate : 0;
+		ofirst = StreamFirstColumn(olast, ncols);
+		clast = (gg->total - 1) / gg->decimate;
+		cfirst = StreamFirstColumn(clast, ncols);
+
+		// Redraw from the old last column as it may not have been complete
+		x0 = olast < cfirst ? sx0 : sx0 + (gCoord)(olast - cfirst);
+
+		// The points of the new samples can reach into the columns either side
+		reach = 0;
+		if (gg->decimate <= 1) {
+			for(i = 0; i < gg->nseries; i++) {
+				if (gg->series[i].point.type != GGRAPH_POINT_NONE && gg->series[i].point.size > reach)
+					reach = gg->series[i].point.size;
+			}
+		}
+
+		if (cfirst != ofirst && x0 > sx0) {
+			#if GDISP_NEED_SCROLL && !GWIN_REDRAW_OCCLUSION
+				// Move what is still shown to the left
+				shift = (gCoord)(cfirst - ofirst);
+				if (gdispGCopyArea(gwinGetDrawDisplay(gh), gh->x + gg->xorigin + sx0, gh->y, ncols - shift, gh->height, gh->x + gg->xorigin + sx0 + shift, gh->y)) {
+					// The first columns are no longer joined to the ones before them and the arrows have moved too
+					x1 = sx0 + reach;
+					if ((gg->style.flags & GWIN_GRAPH_STYLE_ALL_AXIS_ARROWS)) {
+						if (x1 < sx0 + GGRAPH_ARROW_SIZE)
+							x1 = sx0 + GGRAPH_ARROW_SIZE;
+						if (x0 > sx1 - shift - GGRAPH_ARROW_SIZE)
+							x0 = sx1 - shift - GGRAPH_ARROW_SIZE;
+					}
+					if (x0 - reach > x1 + 1)
+						StreamDraw(gg, sx0, x1, gTrue);
+					else
+						x0 = sx0;
+				} else
+					x0 = sx0;
+			#else
+				x0 = sx0;
+			#endif
+		}
+
+		StreamDraw(gg, x0 - reach, sx0 + (gCoord)(clast - cfirst) + reach, gTrue);
+		_gwinDrawEnd(gh);
+
+		#undef gg
+	}
+
+	void gwinGraphStreamClear(GHandle gh) {
+		#define gg	((GGraphObject *)gh)
+
+		if (gh->vmt != &streamVMT)
+			return;
+
+		gg->head = gg->count = 0;
+		gg->total = 0;
+
+		if (_gwinDrawStart(gh)) {
+			StreamDraw(gg, 0, gh->width - gg->xorigin, gFalse);
+			_gwinDrawEnd(gh);
+		}
+
+		#undef gg
+	}
+#endif
+
 #endif /* GFX_USE_GWIN && GWIN_NEED_GRAPH */
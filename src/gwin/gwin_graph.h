@@ -73,12 +73,28 @@ typedef struct GGraphStyle_t {
 		#define GWIN_GRAPH_STYLE_ALL_AXIS_ARROWS		(GWIN_GRAPH_STYLE_XAXIS_ARROWS|GWIN_GRAPH_STYLE_YAXIS_ARROWS)
 } GGraphStyle;
 
+// The style of a streaming data series
+typedef struct GGraphSeries_t {
+	GGraphPointStyle	point;
+	GGraphLineStyle		line;
+	} GGraphSeries;
+
 // A graph window
 typedef struct GGraphObject {
 	GWindowObject		g;
 	GGraphStyle			style;
 	gCoord				xorigin, yorigin;
 	gCoord				lastx, lasty;
+	#if GWIN_GRAPH_STREAMING
+		GGraphSeries *	series;			// The style of each series (allocated together with the samples)
+		gCoord *		samples;		// Ring of samples - one value for each series per sample
+		unsigned		nseries;		// The number of series
+		unsigned		decimate;		// The number of samples in each column
+		unsigned		depth;			// The number of samples in the ring
+		unsigned		head;			// Where the next sample goes in the ring
+		unsigned		count;			// The number of samples in the ring
+		gU32			total;			// The number of samples added since the stream was started
+	#endif
 	} GGraphObject;
 
 /*===========================================================================*/
@@ -137,6 +153,7 @@ void gwinGraphSetOrigin(GHandle gh, gCoord x, gCoord y);
  *
  * @param[in] gh		The window handle (must be a graph window)
  * @note				The graph is not automatically cleared. You must do that first by calling gwinClear().
+ * @note				In streaming mode the samples are drawn as well.
  *
  * @api
  */
@@ -176,6 +193,74 @@ void gwinGraphDrawPoint(GHandle gh, gCoord x, gCoord y);
  */
 void gwinGraphDrawPoints(GHandle gh, const gPoint *points, unsigned count);
 
+#if GWIN_GRAPH_STREAMING || defined(__DOXYGEN__)
+	/**
+	 * @brief   Turn streaming (strip chart) mode on or off.
+	 * @details	In streaming mode the graph keeps the latest samples of one or more data series.
+	 * 			Each new sample goes in the next pixel column to the right of the y axis. When the
+	 * 			plot area is full it scrolls left as samples are added.
+	 *
+	 * @return	gTrue if streaming is now turned on. gFalse if it is off or there is not enough memory.
+	 *
+	 * @param[in] gh		The window handle (must be a graph window)
+	 * @param[in] series	The number of data series. 0 turns streaming off.
+	 * @param[in] decimate	The number of samples shown in each pixel column. If this is more than 1 each
+	 * 						column is drawn as a line covering the minimum to maximum of its samples.
+	 *
+	 * @note	Any existing samples are thrown away. Every series starts with the point and line style of the graph.
+	 * @note	Enough samples are kept to fill the plot area at the current window size and origin.
+	 * @note	The graph is not automatically redrawn. @p gwinGraphDrawAxis() draws the axis and the samples.
+	 * @note	While streaming, a window redraw clears the graph and draws the axis and the samples again.
+	 * 			Without a stream a redraw just clears the graph as before.
+	 * @pre		GWIN_GRAPH_STREAMING must be GFXON
+	 *
+	 * @api
+	 */
+	gBool gwinGraphSetStream(GHandle gh, unsigned series, unsigned decimate);
+
+	/**
+	 * @brief   Set the style of a streaming data series.
+	 *
+	 * @param[in] gh		The window handle (must be a graph window)
+	 * @param[in] series	The series number (starting at 0)
+	 * @param[in] ppoint	The point style or NULL to leave it unchanged
+	 * @param[in] pline		The line style or NULL to leave it unchanged
+	 *
+	 * @note	Points are not drawn when samples are decimated. The line style is used for the range in each column.
+	 * @note	The graph is not automatically redrawn. The new style applies to newly drawn samples.
+	 * @pre		GWIN_GRAPH_STREAMING must be GFXON
+	 *
+	 * @api
+	 */
+	void gwinGraphSetStreamStyle(GHandle gh, unsigned series, const GGraphPointStyle *ppoint, const GGraphLineStyle *pline);
+
+	/**
+	 * @brief   Add samples to a streaming graph.
+	 *
+	 * @param[in] gh		The window handle (must be a graph window in streaming mode)
+	 * @param[in] samples	The y values (in graph coordinates). Each sample has one value for each series.
+	 * @param[in] count		The number of samples
+	 *
+	 * @note	The plot area is scrolled once for all the samples and only the new columns are drawn.
+	 * @note	The grid lines and axis patterns in the plot area scroll with the samples.
+	 * @pre		GWIN_GRAPH_STREAMING must be GFXON
+	 *
+	 * @api
+	 */
+	void gwinGraphStreamAdd(GHandle gh, const gCoord *samples, unsigned count);
+
+	/**
+	 * @brief   Throw away the samples of a streaming graph and clear its plot area.
+	 *
+	 * @param[in] gh		The window handle (must be a graph window in streaming mode)
+	 *
+	 * @pre		GWIN_GRAPH_STREAMING must be GFXON
+	 *
+	 * @api
+	 */
+	void gwinGraphStreamClear(GHandle gh);
+#endif
+
 #endif	/* _GWIN_GRAPH_H */
 /** @} */
 
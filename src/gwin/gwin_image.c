@@ -51,7 +51,7 @@ static void ImageRedraw(GHandle gh) {
 
 	// If the image isn't open just clear the area
 	if (!gdispImageIsOpen(&gw->image)) {
-		gdispGFillArea(gh->display, x, y, w, h, bg);
+		gdispGFillArea(gwinGetDrawDisplay(gh), x, y, w, h, bg);
 		return;
 	}
 
@@ -61,8 +61,8 @@ static void ImageRedraw(GHandle gh) {
 		dx = (gh->width-w)/2;
 		x += dx;
 		if (dx)
-			gdispGFillArea(gh->display, gh->x, y, dx, h, bg);
-		gdispGFillArea(gh->display, x+w, y, gh->width-dx-w, h, bg);
+			gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, y, dx, h, bg);
+		gdispGFillArea(gwinGetDrawDisplay(gh), x+w, y, gh->width-dx-w, h, bg);
 		dx = 0;
 	}
 
@@ -77,8 +77,8 @@ static void ImageRedraw(GHandle gh) {
 		dy = (gh->height-h)/2;
 		y += dy;
 		if (dy)
-			gdispGFillArea(gh->display, x, gh->y, w, dy, bg);
-		gdispGFillArea(gh->display, x, y+h, w, gh->height-dy-h, bg);
+			gdispGFillArea(gwinGetDrawDisplay(gh), x, gh->y, w, dy, bg);
+		gdispGFillArea(gwinGetDrawDisplay(gh), x, y+h, w, gh->height-dy-h, bg);
 		dy = 0;
 	}
 
@@ -90,8 +90,12 @@ static void ImageRedraw(GHandle gh) {
 	// Reset the background color in case it has changed
 	gdispImageSetBgColor(&gw->image, bg);
 
+	// Transparent parts of a still image show the background. Animations draw each frame over the last.
+	if ((gw->image.flags & (GDISP_IMAGE_FLG_TRANSPARENT|GDISP_IMAGE_FLG_ANIMATED)) == GDISP_IMAGE_FLG_TRANSPARENT)
+		gdispGFillArea(gwinGetDrawDisplay(gh), x, y, w, h, bg);
+
 	// Display the image
-	gdispGImageDraw(gh->display, &gw->image, x, y, w, h, dx, dy);
+	gdispGImageDraw(gwinGetDrawDisplay(gh), &gw->image, x, y, w, h, dx, dy);
 
 	#if GWIN_NEED_IMAGE_ANIMATION
 		// read the delay for the next frame
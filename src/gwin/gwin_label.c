@@ -14,6 +14,8 @@
 
 #if GFX_USE_GWIN && GWIN_NEED_LABEL
 
+#include <string.h>
+
 #include "gwin_class.h"
 
 // macros to assist in data type conversions
@@ -106,6 +108,68 @@ void gwinLabelSetBorder(GHandle gh, gBool border) {
 	}
 #endif // GWIN_LABEL_ATTRIBUTE
 
+#if GWIN_REDRAW_DAMAGE
+	gBool _gwinLabelTextArea(GHandle gh, gCoord *px, gCoord *pcx) {
+		gJustify	justify;
+		gCoord		x, cx, w, m;
+
+		// is it a valid handle drawn by us?
+		if (gh->vmt != (gwinVMT *)&labelVMT)
+			return gFalse;
+		if (gh2obj->w.fnDraw == gwinLabelDrawJustified)
+			justify = (gJustify)gh2obj->w.fnParam;
+		else if (gh2obj->w.fnDraw == gwinLabelDrawJustifiedLeft)
+			justify = gJustifyLeft;
+		else if (gh2obj->w.fnDraw == gwinLabelDrawJustifiedRight)
+			justify = gJustifyRight;
+		else if (gh2obj->w.fnDraw == gwinLabelDrawJustifiedCenter)
+			justify = gJustifyCenter;
+		else
+			return gFalse;
+
+		// The box the text is drawn in
+		x = 0;
+		cx = gh->width;
+		#if GWIN_LABEL_ATTRIBUTE
+			if (gh2obj->attr) {
+				x = gh2obj->tab;
+				cx -= gh2obj->tab;
+			}
+		#endif
+		*px = x;
+		*pcx = cx;
+
+		// Text that fills the box (or may wrap onto more lines) uses all of it
+		if (!gh->font || strchr(gh2obj->w.text, '\n'))
+			return gTrue;
+		w = gdispGetStringWidth(gh2obj->w.text, gh->font);
+
+		// Allow for the padding and for characters drawn outside their advance width
+		m = gdispGetFontMetric(gh->font, gFontMaxWidth);
+		#if GDISP_NEED_TEXT_BOXPADLR != 0
+			if (!(justify & gJustifyNoPad))
+				m += GDISP_NEED_TEXT_BOXPADLR;
+		#endif
+		if (w + 2*m >= cx)
+			return gTrue;
+
+		switch(justify & JUSTIFYMASK_HORIZONTAL) {
+		case gJustifyCenter:
+			*px = x + (cx - w)/2 - m;
+			*pcx = w + 2*m;
+			break;
+		case gJustifyRight:
+			*px = x + cx - w - m;
+			*pcx = w + m;
+			break;
+		default:
+			*pcx = w + m;
+			break;
+		}
+		return gTrue;
+	}
+#endif
+
 void gwinLabelDrawJustified(GWidgetObject *gw, void *param) {
 	gColor		c;
 	gJustify 	justify = (gJustify)param;
@@ -118,17 +182,17 @@ void gwinLabelDrawJustified(GWidgetObject *gw, void *param) {
 
 	#if GWIN_LABEL_ATTRIBUTE
 		if (gw2obj->attr) {
-			gdispGFillStringBox(gw->g.display, gw->g.x, gw->g.y, gw2obj->tab, gw->g.height, gw2obj->attr, gw->g.font, c, gw->pstyle->background, justify);
-			gdispGFillStringBox(gw->g.display, gw->g.x + gw2obj->tab, gw->g.y, gw->g.width-gw2obj->tab, gw->g.height, gw->text, gw->g.font, c, gw->pstyle->background, justify);
+			gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw2obj->tab, gw->g.height, gw2obj->attr, gw->g.font, c, gw->pstyle->background, justify);
+			gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x + gw2obj->tab, gw->g.y, gw->g.width-gw2obj->tab, gw->g.height, gw->text, gw->g.font, c, gw->pstyle->background, justify);
 		} else
-			gdispGFillStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font, c, gw->pstyle->background, justify);
+			gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font, c, gw->pstyle->background, justify);
 	#else
-		gdispGFillStringBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font, c, gw->pstyle->background, justify);
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, gw->text, gw->g.font, c, gw->pstyle->background, justify);
 	#endif
 
 	// render the border (if any)
 	if (gw->g.flags & GLABEL_FLG_BORDER)
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, (gw->g.flags & GWIN_FLG_SYSENABLED) ? gw->pstyle->enabled.edge : gw->pstyle->disabled.edge);
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, (gw->g.flags & GWIN_FLG_SYSENABLED) ? gw->pstyle->enabled.edge : gw->pstyle->disabled.edge);
 }
 
 void gwinLabelDrawJustifiedLeft(GWidgetObject *gw, void *param) {
@@ -23,12 +23,11 @@
 #define LST_ARROW_SZ		10	// arrow side length
 #define LST_HORIZ_PAD		5	// extra horizontal padding for text
 #define LST_VERT_PAD		2	// extra vertical padding for text
+#define LST_ALLOC_MIN		16	// the minimum number of item slots to allocate
 
 // Macro's to assist in data type conversions
 #define gh2obj		((GListObject *)gh)
 #define gw2obj		((GListObject *)gw)
-#define qi2li		((ListItem *)qi)
-#define qix2li		((ListItem *)qix)
 #define ple			((GEventGWinList *)pe)
 
 static void sendListEvent(GWidgetObject *gw, int item) {
@@ -53,10 +52,153 @@ static void sendListEvent(GWidgetObject *gw, int item) {
 	}
 }
 
+// Make room for more items
+static gBool ListGrow(GListObject *gl) {
+	ListItem **	p;
+	int			size;
+
+	size = gl->size ? gl->size * 2 : LST_ALLOC_MIN;
+	if (gl->items)
+		p = gfxRealloc(gl->items, gl->size * sizeof(ListItem *), size * sizeof(ListItem *));
+	else
+		p = gfxAlloc(size * sizeof(ListItem *));
+	if (!p)
+		return gFalse;
+	gl->items = p;
+	gl->size = size;
+	return gTrue;
+}
+
+// Free all the items
+static void ListFreeItems(GListObject *gl) {
+	int		i;
+
+	for(i = 0; i < gl->cnt; i++)
+		gfxFree(gl->items[i]);
+	if (gl->items)
+		gfxFree(gl->items);
+	gl->items = 0;
+	gl->size = 0;
+	gl->cnt = 0;
+	gl->sel = -1;
+}
+
+// Select an item. Any other selected item in a single-select list is deselected.
+static void ListSelect(GListObject *gl, int item) {
+	if (!(gl->w.g.flags & GLIST_FLG_MULTISELECT)) {
+		if (gl->sel >= 0)
+			gl->items[gl->sel]->flags &= ~GLIST_FLG_SELECTED;
+		gl->sel = item;
+	}
+	gl->items[item]->flags |= GLIST_FLG_SELECTED;
+}
+
+// Draw the items covering the rows y0 to y1 of the list window and fill any space after the last item.
+//	Only the items in that area are looked at. The caller sets the clipping.
+static void ListDrawItems(GWidgetObject* gw, const GColorSet *ps, gCoord x, gCoord iwidth, gCoord y0, gCoord y1) {
+	const ListItem *			pi;
+	int							i;
+	gCoord						y, iheight;
+	gColor						fill;
+	#if GWIN_NEED_LIST_IMAGES
+		gCoord					sy;
+	#endif
+
+	iheight = gdispGetFontMetric(gw->g.font, gFontHeight) + LST_VERT_PAD;
+
+	// Find the first item in the area
+	i = (gw2obj->top + y0 - 1) / iheight;
+
+	// Draw until we run out of room or items
+	for (y = 1 + i*iheight - gw2obj->top; y < y1 && i < gw2obj->cnt; i++, y += iheight) {
+		pi = gw2obj->items[i];
+		fill = (pi->flags & GLIST_FLG_SELECTED) ? ps->fill : gw->pstyle->background;
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+y, iwidth, iheight, fill);
+		#if GWIN_NEED_LIST_IMAGES
+			if ((gw->g.flags & GLIST_FLG_HASIMAGES)) {
+				// Clear the image area
+				if (pi->pimg && gdispImageIsOpen(pi->pimg)) {
+					// Calculate which image
+					sy = (pi->flags & GLIST_FLG_SELECTED) ? 0 : (iheight-LST_VERT_PAD);
+					if (!(gw->g.flags & GWIN_FLG_SYSENABLED))
+						sy += 2*(iheight-LST_VERT_PAD);
+					while (sy > pi->pimg->height)
+						sy -= iheight-LST_VERT_PAD;
+					// Draw the image
+					gdispImageSetBgColor(pi->pimg, fill);
+					gdispGImageDraw(gwinGetDrawDisplay(&gw->g), pi->pimg, gw->g.x+1, gw->g.y+y, iheight-LST_VERT_PAD, iheight-LST_VERT_PAD, 0, sy);
+				}
+			}
+		#endif
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+x+LST_HORIZ_PAD, gw->g.y+y, iwidth-LST_HORIZ_PAD, iheight, pi->text, gw->g.font, ps->text, fill, gJustifyLeft);
+	}
+
+	// Fill any remaining item space
+	if (y < y1)
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+y, iwidth, y1-y, gw->pstyle->background);
+}
+
+// Draw the position bar of a smooth scrolling list
+static void ListDrawSmoothBar(GWidgetObject* gw, const GColorSet *ps, gCoord iheight) {
+	if (gw2obj->cnt > 0) {
+		int max_scroll_value = gw2obj->cnt * iheight - gw->g.height-2;
+		if (max_scroll_value > 0) {
+			int bar_height = (gw->g.height-2) * (gw->g.height-2) / (gw2obj->cnt * iheight);
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + gw->g.width-4, gw->g.y + 1, 2, gw->g.height-1, gw->pstyle->background);
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + gw->g.width-4, gw->g.y + gw2obj->top * ((gw->g.height-2)-bar_height) / max_scroll_value, 2, bar_height, ps->edge);
+		}
+	}
+}
+
+#if GINPUT_NEED_MOUSE && GDISP_NEED_SCROLL && GDISP_NEED_CLIP && !GWIN_REDRAW_OCCLUSION
+	// Smooth scroll the list by moving the items already on the display and only drawing the revealed items
+	static void ListScroll(GWidgetObject* gw, int oldtop) {
+		const GColorSet *	ps;
+		gCoord				x, iwidth, iheight, lines, cy;
+
+		// Only the default rendering is known to draw the items where we expect them
+		lines = gw2obj->top - oldtop;
+		cy = gw->g.height-2;
+		if (gw->fnDraw != gwinListDefaultDraw || !(gw->g.flags & GLIST_FLG_ENABLERENDER) || lines >= cy || -lines >= cy) {
+			_gwinUpdate(&gw->g);
+			return;
+		}
+
+		if (!_gwinDrawStart(&gw->g))
+			return;
+
+		ps = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->enabled : &gw->pstyle->disabled;
+		iheight = gdispGetFontMetric(gw->g.font, gFontHeight) + LST_VERT_PAD;
+		x = 1;
+		iwidth = gw->g.width - 2 - 4;
+		#if GWIN_NEED_LIST_IMAGES
+			if ((gw->g.flags & GLIST_FLG_HASIMAGES)) {
+				x += iheight;
+				iwidth -= iheight;
+			}
+		#endif
+
+		// Move the items and then draw the strip that has been uncovered
+		gdispGSetClip(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, x-1+iwidth, cy);
+		gdispGVerticalScroll(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, x-1+iwidth, cy, lines, gw->pstyle->background);
+		if (lines > 0) {
+			gdispGSetClip(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1+cy-lines, x-1+iwidth, lines);
+			ListDrawItems(gw, ps, x, iwidth, 1+cy-lines, 1+cy);
+		} else {
+			gdispGSetClip(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, x-1+iwidth, -lines);
+			ListDrawItems(gw, ps, x, iwidth, 1, 1-lines);
+		}
+
+		// Move the position bar without drawing over the frame
+		gdispGSetClip(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2);
+		ListDrawSmoothBar(gw, ps, iheight);
+		_gwinDrawEnd(&gw->g);
+	}
+#endif
+
 #if GINPUT_NEED_MOUSE
     static void ListMouseSelect(GWidgetObject* gw, gCoord x, gCoord y) {
-        const gfxQueueASyncItem*    qi;
-        int                         item, i;
+        int                         item;
         gCoord                     iheight;
         (void)						x;
 
@@ -68,19 +210,10 @@ static void sendListEvent(GWidgetObject *gw, int item) {
         if (item < 0 || item >= gw2obj->cnt)
             return;
 
-        for(qi = gfxQueueASyncPeek(&gw2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-            if ((gw->g.flags & GLIST_FLG_MULTISELECT)) {
-                if (item == i) {
-                    qi2li->flags ^= GLIST_FLG_SELECTED;
-                    break;
-                }
-            } else {
-                if (item == i)
-                    qi2li->flags |= GLIST_FLG_SELECTED;
-                else
-                    qi2li->flags &=~ GLIST_FLG_SELECTED;
-            }
-        }
+        if ((gw->g.flags & GLIST_FLG_MULTISELECT))
+            gw2obj->items[item]->flags ^= GLIST_FLG_SELECTED;
+        else
+            ListSelect(gw2obj, item);
 
         _gwinUpdate(&gw->g);
         sendListEvent(gw, item);
@@ -171,8 +304,13 @@ static void sendListEvent(GWidgetObject *gw, int item) {
             if (gw2obj->top < 0)
                 gw2obj->top = 0;
             gw2obj->last_mouse_y = y;
-            if (oldtop != gw2obj->top)
-            	_gwinUpdate(&gw->g);
+            if (oldtop != gw2obj->top) {
+                #if GDISP_NEED_SCROLL && GDISP_NEED_CLIP && !GWIN_REDRAW_OCCLUSION
+                    ListScroll(gw, oldtop);
+                #else
+                    _gwinUpdate(&gw->g);
+                #endif
+            }
         }
 	}
 #endif
@@ -180,57 +318,49 @@ static void sendListEvent(GWidgetObject *gw, int item) {
 #if GINPUT_NEED_TOGGLE
 	// a toggle-on has occurred
 	static void ListToggleOn(GWidgetObject *gw, gU16 role) {
-		const gfxQueueASyncItem	*	qi;
-		const gfxQueueASyncItem	*	qix;
-		int							i;
-		
+		int			i;
 		gCoord		iheight;
+
 		iheight = gdispGetFontMetric(gw->g.font, gFontHeight) + LST_VERT_PAD;
 
+		// Find the selected item
+		if (!(gw->g.flags & GLIST_FLG_MULTISELECT))
+			i = gw2obj->sel;
+		else
+			for(i = 0; i < gw2obj->cnt && !(gw2obj->items[i]->flags & GLIST_FLG_SELECTED); i++);
+		if (i < 0 || i >= gw2obj->cnt)
+			return;
+
 		switch (role) {
 			// select down
 			case 0:
-				for (i = 0, qi = gfxQueueASyncPeek(&gw2obj->list_head); qi; qi = gfxQueueASyncNext(qi), i++) {
-					if ((qi2li->flags & GLIST_FLG_SELECTED)) {
-						qix = gfxQueueASyncNext(qi);
-						if (qix) {
-							qi2li->flags &=~ GLIST_FLG_SELECTED;
-							qix2li->flags |= GLIST_FLG_SELECTED;
-
-							//if we need to scroll down
-							if (((i+2)*iheight - gw2obj->top) > gw->g.height){
-								gw2obj->top += iheight;
-							}
-
-							_gwinUpdate(&gw->g);
-						}
-						break;
+				if (i+1 < gw2obj->cnt) {
+					gw2obj->items[i]->flags &=~ GLIST_FLG_SELECTED;
+					ListSelect(gw2obj, i+1);
+
+					//if we need to scroll down
+					if (((i+2)*iheight - gw2obj->top) > gw->g.height){
+						gw2obj->top += iheight;
 					}
+
+					_gwinUpdate(&gw->g);
 				}
 				break;
 
 			// select up
 			case 1:
-				qi = gfxQueueASyncPeek(&gw2obj->list_head);
-				qix = 0;
-
-				for (i = 0; qi; qix = qi, qi = gfxQueueASyncNext(qi), i++) {
-					if ((qi2li->flags & GLIST_FLG_SELECTED)) {
-						if (qix) {
-							qi2li->flags &=~ GLIST_FLG_SELECTED;
-							qix2li->flags |= GLIST_FLG_SELECTED;
-
-							//if we need to scroll up
-							if (((i-1)*iheight) < gw2obj->top){
-								gw2obj->top -= iheight;
-								if (gw2obj->top < 0)
-									gw2obj->top = 0;
-							}
-
-							_gwinUpdate(&gw->g);
-						}
-						break;
+				if (i > 0) {
+					gw2obj->items[i]->flags &=~ GLIST_FLG_SELECTED;
+					ListSelect(gw2obj, i-1);
+
+					//if we need to scroll up
+					if (((i-1)*iheight) < gw2obj->top){
+						gw2obj->top -= iheight;
+						if (gw2obj->top < 0)
+							gw2obj->top = 0;
 					}
+
+					_gwinUpdate(&gw->g);
 				}
 				break;
 		}
@@ -249,11 +379,7 @@ static void sendListEvent(GWidgetObject *gw, int item) {
 #endif
 
 static void ListDestroy(GHandle gh) {
-	const gfxQueueASyncItem* qi;
-
-	while((qi = gfxQueueASyncGet(&gh2obj->list_head)))
-		gfxFree((void *)qi);
-
+	ListFreeItems(gh2obj);
 	_gwidgetDestroy(gh);
 }
 
@@ -301,10 +427,12 @@ GHandle gwinGListCreate(GDisplay *g, GListObject* gobj, GWidgetInit* pInit, gBoo
 	if (!(gobj = (GListObject *)_gwidgetCreate(g, &gobj->w, pInit, &listVMT)))
 		return 0;
 
-	// initialize the item queue
-	gfxQueueASyncInit(&gobj->list_head);
+	// initialize the item array
+	gobj->items = 0;
+	gobj->size = 0;
 	gobj->cnt = 0;
 	gobj->top = 0;
+	gobj->sel = -1;
 	if (multiselect)
 		gobj->w.g.flags |= GLIST_FLG_MULTISELECT;
 	gobj->w.g.flags |= GLIST_FLG_SCROLLALWAYS;
@@ -375,15 +503,16 @@ int gwinListAddItem(GHandle gh, const char* text, gBool useAlloc) {
 		newItem->pimg = 0;
 	#endif
 
-	// select the item if it's the first in the list
-	if (gh2obj->cnt == 0 && !(gh->flags & GLIST_FLG_MULTISELECT))
-		newItem->flags |= GLIST_FLG_SELECTED;
-
-	// add the new item to the list
-	gfxQueueASyncPut(&gh2obj->list_head, &newItem->q_item);
+	// add the new item to the end of the list
+	if (gh2obj->cnt >= gh2obj->size && !ListGrow(gh2obj)) {
+		gfxFree(newItem);
+		return -1;
+	}
+	gh2obj->items[gh2obj->cnt++] = newItem;
 
-	// increment the total amount of entries in the list widget
-	gh2obj->cnt++;
+	// select the item if it's the first in the list
+	if (gh2obj->cnt == 1 && !(gh->flags & GLIST_FLG_MULTISELECT))
+		ListSelect(gh2obj, 0);
 
 	_gwinUpdate(gh);
 
@@ -392,8 +521,7 @@ int gwinListAddItem(GHandle gh, const char* text, gBool useAlloc) {
 }
 
 void gwinListItemSetText(GHandle gh, int item, const char* text, gBool useAlloc) {
-	const gfxQueueASyncItem		*qi;
-	int							i;
+	ListItem					*oldItem;
 	ListItem					*newItem;
 
 	// is it a valid handle?
@@ -404,45 +532,36 @@ void gwinListItemSetText(GHandle gh, int item, const char* text, gBool useAlloc)
 	if (item < 0 || item > (gh2obj->cnt) - 1)
 		return;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item) {
-		
-			// create the new object
-			if (useAlloc) {
-				gMemSize len = strlen(text)+1;
-				if (!(newItem = gfxAlloc(sizeof(ListItem) + len)))
-					return;
-		
-				memcpy((char *)(newItem+1), text, len);
-				text = (const char *)(newItem+1);
-			} else {
-				if (!(newItem = gfxAlloc(sizeof(ListItem))))
-					return;
-			}
-		
-			// copy the info from the existing object
-			newItem->flags = qi2li->flags;
-			newItem->param = qi2li->param;
-			newItem->text = text;
-			#if GWIN_NEED_LIST_IMAGES
-				newItem->pimg = qi2li->pimg;
-			#endif
-		
-			// add the new item to the list and remove the old item
-			gfxQueueASyncInsert(&gh2obj->list_head, &newItem->q_item, &qi2li->q_item);
-			gfxQueueASyncRemove(&gh2obj->list_head, &qi2li->q_item);
-			gfxFree(qi2li);
-		
-			_gwinUpdate(gh);
-			break;
-		}
+	// create the new object
+	if (useAlloc) {
+		gMemSize len = strlen(text)+1;
+		if (!(newItem = gfxAlloc(sizeof(ListItem) + len)))
+			return;
+
+		memcpy((char *)(newItem+1), text, len);
+		text = (const char *)(newItem+1);
+	} else {
+		if (!(newItem = gfxAlloc(sizeof(ListItem))))
+			return;
 	}
+
+	// copy the info from the existing object
+	oldItem = gh2obj->items[item];
+	newItem->flags = oldItem->flags;
+	newItem->param = oldItem->param;
+	newItem->text = text;
+	#if GWIN_NEED_LIST_IMAGES
+		newItem->pimg = oldItem->pimg;
+	#endif
+
+	// replace the old item
+	gh2obj->items[item] = newItem;
+	gfxFree(oldItem);
+
+	_gwinUpdate(gh);
 }
 
 const char* gwinListItemGetText(GHandle gh, int item) {
-	const gfxQueueASyncItem*	qi;
-	int							i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return 0;
@@ -451,15 +570,10 @@ const char* gwinListItemGetText(GHandle gh, int item) {
 	if (item < 0 || item >= gh2obj->cnt)
 		return 0;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item)
-			return qi2li->text;
-	}
-	return 0;
+	return gh2obj->items[item]->text;
 }
 
 int gwinListFindText(GHandle gh, const char* text) {
-	const gfxQueueASyncItem*	qi;
 	int							i;
 
 	// is it a valid handle?
@@ -470,18 +584,15 @@ int gwinListFindText(GHandle gh, const char* text) {
 	if (!text)
 		return -1;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (strcmp(((ListItem *)qi)->text, text) == 0)
-			return i;	
+	for(i = 0; i < gh2obj->cnt; i++) {
+		if (strcmp(gh2obj->items[i]->text, text) == 0)
+			return i;
 	}
 
 	return -1;
 }
 
 int gwinListGetSelected(GHandle gh) {
-	const gfxQueueASyncItem	*	qi;
-	int							i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return -1;
@@ -490,18 +601,10 @@ int gwinListGetSelected(GHandle gh) {
 	if ((gh->flags & GLIST_FLG_MULTISELECT))
 		return -1;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (qi2li->flags & GLIST_FLG_SELECTED)
-			return i;
-	}
-
-	return -1;
+	return gh2obj->sel;
 }
 
 void gwinListItemSetParam(GHandle gh, int item, gU16 param) {
-	const gfxQueueASyncItem	*	qi;
-	int							i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return;
@@ -510,34 +613,22 @@ void gwinListItemSetParam(GHandle gh, int item, gU16 param) {
 	if (item < 0 || item > (gh2obj->cnt) - 1)
 		return;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item) {
-			qi2li->param = param;
-			break;
-		}
-	}
+	gh2obj->items[item]->param = param;
 }
 
 void gwinListDeleteAll(GHandle gh) {
-	gfxQueueASyncItem* qi;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return;
 
-	while((qi = gfxQueueASyncGet(&gh2obj->list_head)))
-		gfxFree(qi);
+	ListFreeItems(gh2obj);
 
 	gh->flags &= ~GLIST_FLG_HASIMAGES;
-	gh2obj->cnt = 0;
 	gh2obj->top = 0;
 	_gwinUpdate(gh);
 }
 
 void gwinListItemDelete(GHandle gh, int item) {
-	const gfxQueueASyncItem	*	qi;
-	int							i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return;
@@ -546,23 +637,22 @@ void gwinListItemDelete(GHandle gh, int item) {
 	if (item < 0 || item >= gh2obj->cnt)
 		return;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item) {
-			gfxQueueASyncRemove(&gh2obj->list_head, (gfxQueueASyncItem*)qi);
-			gfxFree((void *)qi);
-			gh2obj->cnt--;
-			if (gh2obj->top >= item && gh2obj->top)
-				gh2obj->top--;
-			_gwinUpdate(gh);
-			break;
-		}
-	}
+	gfxFree(gh2obj->items[item]);
+	gh2obj->cnt--;
+	memmove(gh2obj->items+item, gh2obj->items+item+1, (gh2obj->cnt-item)*sizeof(ListItem *));
+
+	// keep the selection on the same item
+	if (gh2obj->sel == item)
+		gh2obj->sel = -1;
+	else if (gh2obj->sel > item)
+		gh2obj->sel--;
+
+	if (gh2obj->top >= item && gh2obj->top)
+		gh2obj->top--;
+	_gwinUpdate(gh);
 }
 
 gU16 gwinListItemGetParam(GHandle gh, int item) {
-	const gfxQueueASyncItem	*	qi;
-	int							i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return 0;
@@ -571,17 +661,10 @@ gU16 gwinListItemGetParam(GHandle gh, int item) {
 	if (item < 0 || item > (gh2obj->cnt) - 1)
 		return 0;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item)
-			return qi2li->param;
-	}
-	return 0;
+	return gh2obj->items[item]->param;
 }
 
 gBool gwinListItemIsSelected(GHandle gh, int item) {
-	const gfxQueueASyncItem	*	qi;
-	int							i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return gFalse;
@@ -590,11 +673,7 @@ gBool gwinListItemIsSelected(GHandle gh, int item) {
 	if (item < 0 || item > (gh2obj->cnt) - 1)
 		return gFalse;
 
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item)
-			return (qi2li->flags &  GLIST_FLG_SELECTED) ? gTrue : gFalse;
-	}
-	return gFalse;
+	return (gh2obj->items[item]->flags & GLIST_FLG_SELECTED) ? gTrue : gFalse;
 }
 
 int gwinListItemCount(GHandle gh) {
@@ -618,9 +697,6 @@ const char* gwinListGetSelectedText(GHandle gh) {
 }
 
 void gwinListSetSelected(GHandle gh, int item, gBool doSelect) {
-	const gfxQueueASyncItem   *   qi;
-	int                     i;
-
 	// is it a valid handle?
 	if (gh->vmt != (gwinVMT *)&listVMT)
 		return;
@@ -629,25 +705,17 @@ void gwinListSetSelected(GHandle gh, int item, gBool doSelect) {
 	if (item < 0 || item >= gh2obj->cnt)
 		return;
 
-	// If not a multiselect mode - clear previous selected item
-	if (doSelect && !(gh->flags & GLIST_FLG_MULTISELECT)) {
-		for(qi = gfxQueueASyncPeek(&gh2obj->list_head); qi; qi = gfxQueueASyncNext(qi)) {
-			if (qi2li->flags & GLIST_FLG_SELECTED) {
-				qi2li->flags &= ~GLIST_FLG_SELECTED;
-				break;
-			}
-		}
-	}
-
-	// Find item and set selected or not
-	for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-		if (i == item) {
-			if (doSelect)
-				qi2li->flags |= GLIST_FLG_SELECTED;
-			else
-				qi2li->flags &= ~GLIST_FLG_SELECTED;
-			break;
-		}
+	// In single-select mode selecting an item clears the previous selected item
+	if ((gh->flags & GLIST_FLG_MULTISELECT)) {
+		if (doSelect)
+			gh2obj->items[item]->flags |= GLIST_FLG_SELECTED;
+		else
+			gh2obj->items[item]->flags &= ~GLIST_FLG_SELECTED;
+	} else if (doSelect)
+		ListSelect(gh2obj, item);
+	else if (gh2obj->sel == item) {
+		gh2obj->items[item]->flags &= ~GLIST_FLG_SELECTED;
+		gh2obj->sel = -1;
 	}
 	_gwinUpdate(gh);
 }
@@ -678,9 +746,6 @@ void gwinListViewItem(GHandle gh, int item) {
 
 #if GWIN_NEED_LIST_IMAGES
 	void gwinListItemSetImage(GHandle gh, int item, gImage *pimg) {
-		const gfxQueueASyncItem	*	qi;
-		int							i;
-
 		// is it a valid handle?
 		if (gh->vmt != (gwinVMT *)&listVMT)
 			return;
@@ -689,26 +754,15 @@ void gwinListViewItem(GHandle gh, int item) {
 		if (item < 0 || item > (gh2obj->cnt) - 1)
 			return;
 
-		for(qi = gfxQueueASyncPeek(&gh2obj->list_head), i = 0; qi; qi = gfxQueueASyncNext(qi), i++) {
-			if (i == item) {
-				qi2li->pimg = pimg;
-				if (pimg)
-					gh->flags |= GLIST_FLG_HASIMAGES;
-				break;
-			}
-		}
+		gh2obj->items[item]->pimg = pimg;
+		if (pimg)
+			gh->flags |= GLIST_FLG_HASIMAGES;
 	}
 #endif
 
 void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
-	const gfxQueueASyncItem*	qi;
-	int							i;
-	gCoord						x, y, iheight, iwidth;
-	gColor						fill;
+	gCoord						x, iheight, iwidth;
 	const GColorSet *			ps;
-	#if GWIN_NEED_LIST_IMAGES
-		gCoord					sy;
-	#endif
 	#if GDISP_NEED_CONVEX_POLYGON
 		static const gPoint upArrow[] = { {0, LST_ARROW_SZ}, {LST_ARROW_SZ, LST_ARROW_SZ}, {LST_ARROW_SZ/2, 0} };
 		static const gPoint downArrow[] = { {0, 0}, {LST_ARROW_SZ, 0}, {LST_ARROW_SZ/2, LST_ARROW_SZ} };
@@ -731,29 +785,22 @@ void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 	// the scroll area
 	if (gw->g.flags & GLIST_FLG_SCROLLSMOOTH) {
 		iwidth = gw->g.width - 2 - 4;
-		if (gw2obj->cnt > 0) {
-			int max_scroll_value = gw2obj->cnt * iheight - gw->g.height-2;
-			if (max_scroll_value > 0) {
-				int bar_height = (gw->g.height-2) * (gw->g.height-2) / (gw2obj->cnt * iheight);
-				gdispGFillArea(gw->g.display, gw->g.x + gw->g.width-4, gw->g.y + 1, 2, gw->g.height-1, gw->pstyle->background);
-				gdispGFillArea(gw->g.display, gw->g.x + gw->g.width-4, gw->g.y + gw2obj->top * ((gw->g.height-2)-bar_height) / max_scroll_value, 2, bar_height, ps->edge);
-			}
-		}
+		ListDrawSmoothBar(gw, ps, iheight);
 	} else if ((gw2obj->cnt > (gw->g.height-2) / iheight) || (gw->g.flags & GLIST_FLG_SCROLLALWAYS)) {
 		iwidth = gw->g.width - (LST_SCROLLWIDTH+3);
-		gdispGFillArea(gw->g.display, gw->g.x+iwidth+2, gw->g.y+1, LST_SCROLLWIDTH, gw->g.height-2, gdispBlendColor(ps->fill, gw->pstyle->background, 128));
-		gdispGDrawLine(gw->g.display, gw->g.x+iwidth+1, gw->g.y+1, gw->g.x+iwidth+1, gw->g.y+gw->g.height-2, ps->edge);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+iwidth+2, gw->g.y+1, LST_SCROLLWIDTH, gw->g.height-2, gdispBlendColor(ps->fill, gw->pstyle->background, 128));
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+iwidth+1, gw->g.y+1, gw->g.x+iwidth+1, gw->g.y+gw->g.height-2, ps->edge);
 		#if GDISP_NEED_CONVEX_POLYGON
-			gdispGFillConvexPoly(gw->g.display, gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+(LST_ARROW_SZ/2+1), upArrow, 3, ps->fill);
-			gdispGFillConvexPoly(gw->g.display, gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+gw->g.height-(LST_ARROW_SZ+LST_ARROW_SZ/2+1), downArrow, 3, ps->fill);
+			gdispGFillConvexPoly(gwinGetDrawDisplay(&gw->g), gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+(LST_ARROW_SZ/2+1), upArrow, 3, ps->fill);
+			gdispGFillConvexPoly(gwinGetDrawDisplay(&gw->g), gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+gw->g.height-(LST_ARROW_SZ+LST_ARROW_SZ/2+1), downArrow, 3, ps->fill);
 		#else
 			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
 				#warning "GWIN: Lists display better when GDISP_NEED_CONVEX_POLYGON is turned on"
 			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
 				COMPILER_WARNING("GWIN: Lists display better when GDISP_NEED_CONVEX_POLYGON is turned on")
 			#endif
-			gdispGFillArea(gw->g.display, gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+(LST_ARROW_SZ/2+1), LST_ARROW_SZ, LST_ARROW_SZ, ps->fill);
-			gdispGFillArea(gw->g.display, gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+gw->g.height-(LST_ARROW_SZ+LST_ARROW_SZ/2+1), LST_ARROW_SZ, LST_ARROW_SZ, ps->fill);
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+(LST_ARROW_SZ/2+1), LST_ARROW_SZ, LST_ARROW_SZ, ps->fill);
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+iwidth+((LST_SCROLLWIDTH-LST_ARROW_SZ)/2+2), gw->g.y+gw->g.height-(LST_ARROW_SZ+LST_ARROW_SZ/2+1), LST_ARROW_SZ, LST_ARROW_SZ, ps->fill);
 		#endif
 	} else
 		iwidth = gw->g.width - 2;
@@ -766,48 +813,19 @@ void gwinListDefaultDraw(GWidgetObject* gw, void* param) {
 	#endif
 
 
-	// Find the top item
-	for (qi = gfxQueueASyncPeek(&gw2obj->list_head), i = iheight - 1; i < gw2obj->top && qi; qi = gfxQueueASyncNext(qi), i+=iheight);
-
 	// the list frame
-	gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, ps->edge);
+	gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, ps->edge);
 
 	// Set the clipping region so we do not override the frame.
 	#if GDISP_NEED_CLIP
-		gdispGSetClip(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2);
+		gdispGSetClip(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2);
 	#endif
 
-	// Draw until we run out of room or items
-	for (y = 1-(gw2obj->top%iheight); y < gw->g.height-2 && qi; qi = gfxQueueASyncNext(qi), y += iheight) {
-		fill = (qi2li->flags & GLIST_FLG_SELECTED) ? ps->fill : gw->pstyle->background;
-		gdispGFillArea(gw->g.display, gw->g.x+1, gw->g.y+y, iwidth, iheight, fill);
-		#if GWIN_NEED_LIST_IMAGES
-			if ((gw->g.flags & GLIST_FLG_HASIMAGES)) {
-				// Clear the image area
-				if (qi2li->pimg && gdispImageIsOpen(qi2li->pimg)) {
-					// Calculate which image
-					sy = (qi2li->flags & GLIST_FLG_SELECTED) ? 0 : (iheight-LST_VERT_PAD);
-					if (!(gw->g.flags & GWIN_FLG_SYSENABLED))
-						sy += 2*(iheight-LST_VERT_PAD);
-					while (sy > qi2li->pimg->height)
-						sy -= iheight-LST_VERT_PAD;
-					// Draw the image
-					gdispImageSetBgColor(qi2li->pimg, fill);
-					gdispGImageDraw(gw->g.display, qi2li->pimg, gw->g.x+1, gw->g.y+y, iheight-LST_VERT_PAD, iheight-LST_VERT_PAD, 0, sy);
-				}
-			}
-		#endif
-		gdispGFillStringBox(gw->g.display, gw->g.x+x+LST_HORIZ_PAD, gw->g.y+y, iwidth-LST_HORIZ_PAD, iheight, qi2li->text, gw->g.font, ps->text, fill, gJustifyLeft);
-	}
-
-	// Fill any remaining item space
-	if (y < gw->g.height-1)
-		gdispGFillArea(gw->g.display, gw->g.x+1, gw->g.y+y, iwidth, gw->g.height-1-y, gw->pstyle->background);
+	// Draw just the items that can be seen
+	ListDrawItems(gw, ps, x, iwidth, 1, gw->g.height-1);
 }
 
 #undef gh2obj
 #undef gw2obj
-#undef qi2li
-#undef qix2li
 #undef ple
 #endif // GFX_USE_GWIN && GWIN_NEED_LIST
@@ -61,9 +61,11 @@ typedef struct GListObject {
 		gU16	t_dn;
 	#endif
 
-	int				cnt;		// Number of items currently in the list (quicker than counting each time)
+	int				cnt;		// Number of items currently in the list
 	int				top;		// Viewing offset in pixels from the top of the list
-	gfxQueueASync	list_head;	// The list of items
+	int				size;		// Number of item slots allocated
+	int				sel;		// The selected item in a single-select list or -1 if none
+	struct ListItem	**items;	// The items in list order
 } GListObject;
 
 /**
@@ -93,8 +95,6 @@ typedef enum scroll_t { scrollAlways, scrollAuto, scrollSmooth } scroll_t;
  * @note	Used only for writing a custom draw routine.
  */
 typedef struct ListItem {
-	gfxQueueASyncItem	q_item;		// This must be the first member in the struct
-
 	gU16			flags;
 		#define GLIST_FLG_SELECTED			0x0001
 	gU16			param;		// A parameter the user can specify himself
@@ -149,6 +149,8 @@ void gwinListEnableRender(GHandle gh, gBool ena);
  * @brief				Change the behaviour of the scroll bar
  *
  * @note				Current possible values: @p scrollAlways, @p scrollAuto and  @p scrollSmooth
+ * @note				If GDISP_NEED_SCROLL is GFXON a smooth scrolling list with the default rendering moves the items
+ * 						already on the display and only draws the items that are scrolled into view.
  *
  * @param[in] gh		The widget handle (must be a list handle)
  * @param[in] flag		The behaviour to be set
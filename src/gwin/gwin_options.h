@@ -37,6 +37,19 @@
 	#ifndef GWIN_NEED_CONTAINERS
 		#define GWIN_NEED_CONTAINERS	GFXOFF
 	#endif
+	/**
+	 * @brief	Should containers be able to draw their contents off-screen.
+	 * @details	Defaults to GFXOFF
+	 * @details	A container marked with @p gwinSetOffscreen() gets a pixmap the size of the container.
+	 * 			The container and everything in it are drawn into the pixmap and then copied to the
+	 * 			display in one blit. Only the windows that change are redrawn and an area that is
+	 * 			uncovered is copied straight back from the pixmap.
+	 * @note	Each off-screen container needs width * height pixels of RAM.
+	 * @note	This turns on GWIN_NEED_CONTAINERS, GDISP_NEED_PIXMAP and GWIN_NEED_HITGRID.
+	 */
+	#ifndef GWIN_NEED_OFFSCREEN
+		#define GWIN_NEED_OFFSCREEN		GFXOFF
+	#endif
 	/**
 	 * @brief   Should widget functions be included. Needed for any widget (eg Buttons, Sliders etc)
 	 * @details	Defaults to GFXOFF
@@ -187,6 +200,25 @@
 	#ifndef GWIN_FLAT_STYLING
 		#define GWIN_FLAT_STYLING		GFXOFF
 	#endif
+	/**
+	 * @brief   Allow widgets to be drawn from cached renderings
+	 * @details	Defaults to GFXOFF
+	 * @note	A widget marked with @p gwinSetCached() is rendered into a pixmap once for each state
+	 * 			it is drawn in and then redrawn by copying the pixmap.
+	 * @note	This turns on GDISP_NEED_PIXMAP.
+	 */
+	#ifndef GWIN_WIDGET_CACHE
+		#define GWIN_WIDGET_CACHE		GFXOFF
+	#endif
+	/**
+	 * @brief   The most memory (in bytes) the cached widget renderings can use
+	 * @details	Defaults to 32768
+	 * @note	The least recently used renderings are freed to make room for new ones.
+	 * 			A widget too big to fit is always drawn directly.
+	 */
+	#ifndef GWIN_WIDGET_CACHE_SIZE
+		#define GWIN_WIDGET_CACHE_SIZE	32768
+	#endif
 	/**
 	 * @brief	Don't use a timer for redrawing windows
 	 * @details	Defaults to GFXOFF
@@ -214,6 +246,92 @@
 	#ifndef GWIN_REDRAW_SINGLEOP
 		#define GWIN_REDRAW_SINGLEOP	GFXOFF
 	#endif
+	/**
+	 * @brief	Only redraw the parts of windows that are not covered by other windows
+	 * @details	Defaults to GFXOFF
+	 * @note	The window manager clips each redraw to the visible region of the window
+	 * 			(its area less the windows above it) so each pixel is painted once. Exposed
+	 * 			areas are repainted by just the windows underneath.
+	 * @note	This turns on GDISP_NEED_CLIP_REGION. Displays that clip in hardware
+	 * 			fall back to the normal redraw.
+	 * @note	This is only relevant if GWIN_NEED_WINDOWMANAGER is GFXON.
+	 */
+	#ifndef GWIN_REDRAW_OCCLUSION
+		#define GWIN_REDRAW_OCCLUSION	GFXOFF
+	#endif
+	/**
+	 * @brief	Redraw windows in frames at a steady rate
+	 * @details	Defaults to GFXOFF
+	 * @note	Redraw requests are collected and done together once every GWIN_REDRAW_FRAME_PERIOD
+	 * 			milliseconds. Each frame redraws the windows in z-order and then flushes the display once.
+	 * @note	Windows marked with @p gwinSetRedrawDeferrable() are put off to a later frame once
+	 * 			a frame has taken GWIN_REDRAW_FRAME_BUDGET milliseconds.
+	 * @note	This can't be used with GWIN_REDRAW_IMMEDIATE. GWIN_REDRAW_SINGLEOP is ignored.
+	 */
+	#ifndef GWIN_REDRAW_FRAMES
+		#define GWIN_REDRAW_FRAMES		GFXOFF
+	#endif
+	/**
+	 * @brief	The time between redraw frames in milliseconds
+	 * @details	Defaults to 20 (50 frames per second)
+	 */
+	#ifndef GWIN_REDRAW_FRAME_PERIOD
+		#define GWIN_REDRAW_FRAME_PERIOD	20
+	#endif
+	/**
+	 * @brief	How long a redraw frame can take in milliseconds before deferrable windows are put off
+	 * @details	Defaults to 10
+	 */
+	#ifndef GWIN_REDRAW_FRAME_BUDGET
+		#define GWIN_REDRAW_FRAME_BUDGET	10
+	#endif
+	/**
+	 * @brief	Only redraw the part of a widget that changed
+	 * @details	Defaults to GFXOFF
+	 * @note	Widgets report the area a state change affects (the moved part of a slider or
+	 * 			progressbar, the edited end of a textedit, the text of a label) and the redraw
+	 * 			is clipped to it. Several changes before the redraw are merged into one area.
+	 * @note	The built-in draw routines handle this. A widget with a custom draw routine
+	 * 			is still redrawn in full.
+	 * @note	This turns on GDISP_NEED_CLIP.
+	 */
+	#ifndef GWIN_REDRAW_DAMAGE
+		#define GWIN_REDRAW_DAMAGE			GFXOFF
+	#endif
+	/**
+	 * @brief	Move windows by copying their pixels instead of redrawing them
+	 * @details	Defaults to GFXOFF
+	 * @note	A visible window that is not covered by another window is copied to its new
+	 * 			position on the display (or from its pixmap if it is an off-screen container).
+	 * 			Only the strips of the old area it uncovers are redrawn by the windows underneath.
+	 * 			Otherwise, or if the display can't read back pixels, the window is redrawn as normal.
+	 * @note	This turns on GDISP_NEED_SCROLL and GDISP_NEED_CLIP.
+	 * @note	This is only relevant if GWIN_NEED_WINDOWMANAGER is GFXON.
+	 */
+	#ifndef GWIN_MOVE_BLIT
+		#define GWIN_MOVE_BLIT				GFXOFF
+	#endif
+	/**
+	 * @brief	Use a grid to find the window under the mouse
+	 * @details	Defaults to GFXOFF
+	 * @note	Normally every mouse or touch event walks the whole window list to find the
+	 * 			top most window under the pointer. With this option each display is divided into
+	 * 			square cells that list the windows overlapping them, so only the windows in one
+	 * 			cell are tested. This is worthwhile with many widgets and a fast touch stream.
+	 * @note	The grid is rebuilt on the first event after a window is created, destroyed,
+	 * 			moved, resized or raised. It uses memory from the heap.
+	 * @note	This is only relevant if GWIN_NEED_WIDGET is GFXON.
+	 */
+	#ifndef GWIN_NEED_HITGRID
+		#define GWIN_NEED_HITGRID		GFXOFF
+	#endif
+	/**
+	 * @brief	The size of a hit grid cell as a power of 2
+	 * @details	Defaults to 5 (32 x 32 pixel cells)
+	 */
+	#ifndef GWIN_HITGRID_SHIFT
+		#define GWIN_HITGRID_SHIFT		5
+	#endif
 	/**
 	 * @brief   Buttons should not insist the mouse is over the button on mouse release
 	 * @details	Defaults to GFXOFF
@@ -307,6 +425,20 @@
 	#ifndef GWIN_CONSOLE_USE_BASESTREAM
 		#define GWIN_CONSOLE_USE_BASESTREAM		GFXOFF
 	#endif
+	/**
+	 * @brief   Graph windows can optionally keep a rolling history of samples (a strip chart)
+	 * @details	Defaults to GFXOFF
+	 * @details	If this feature is enabled, @p gwinGraphSetStream() keeps the latest samples of one or
+	 * 			more data series. As new samples are added the plot area is scrolled and only the
+	 * 			new columns are drawn. The graph can also be redrawn from the kept samples.
+	 * @note	Scrolling copies the plot area with @p gdispGCopyArea() when GDISP_NEED_SCROLL is turned on
+	 * 			and the display can read back its pixels. Otherwise the plot area is redrawn.
+	 * @note	With this feature a graph window has a redraw routine. A graph that is not streaming is
+	 * 			simply cleared when it is redrawn.
+	 */
+	#ifndef GWIN_GRAPH_STREAMING
+		#define GWIN_GRAPH_STREAMING			GFXOFF
+	#endif
 	/**
 	 * @brief   Image windows can optionally support animated images
 	 * @details	Defaults to GFXOFF
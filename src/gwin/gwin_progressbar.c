@@ -24,6 +24,36 @@ static void PBResetDisplayPos(GProgressbarObject *gsw) {
 		gsw->dpos = ((gsw->w.g.width-1)*(gsw->pos-gsw->min))/(gsw->max-gsw->min);
 }
 
+// Redraw the progressbar after the display position has moved from odpos
+static void PBUpdate(GProgressbarObject *gsw, gCoord odpos) {
+	gCoord		p0, p1;
+
+	// Only the built-in drawing routines are known to depend on nothing but the display position
+	if (gsw->w.fnDraw != gwinProgressbarDraw_Std
+			#if GDISP_NEED_IMAGE
+				&& gsw->w.fnDraw != gwinProgressbarDraw_Image
+			#endif
+			) {
+		_gwinUpdate(&gsw->w.g);
+		return;
+	}
+
+	// Just the part between the old and new thumb
+	if (odpos == gsw->dpos)
+		return;
+	if (odpos < gsw->dpos) {
+		p0 = odpos;
+		p1 = gsw->dpos;
+	} else {
+		p0 = gsw->dpos;
+		p1 = odpos;
+	}
+	if (gsw->w.g.width < gsw->w.g.height)
+		_gwinUpdateArea(&gsw->w.g, 0, p0, gsw->w.g.width, p1-p0+1);
+	else
+		_gwinUpdateArea(&gsw->w.g, p0, 0, p1-p0+1, gsw->w.g.height);
+}
+
 // We have to deinitialize the timer which auto updates the progressbar if any
 static void PBDestroy(GHandle gh) {
 	#if GWIN_PROGRESSBAR_AUTO
@@ -121,6 +151,7 @@ void gwinProgressbarSetRange(GHandle gh, int min, int max) {
 
 void gwinProgressbarSetPosition(GHandle gh, int pos) {
 	#define gsw		((GProgressbarObject *)gh)
+	gCoord	odpos;
 
 	if (gh->vmt != (gwinVMT *)&progressbarVMT)
 		return;
@@ -129,8 +160,9 @@ void gwinProgressbarSetPosition(GHandle gh, int pos) {
 	else if (pos > gsw->max) gsw->pos = gsw->max;
 	else gsw->pos = pos;
 
+	odpos = gsw->dpos;
 	PBResetDisplayPos(gsw);
-	_gwinUpdate(gh);
+	PBUpdate(gsw, odpos);
 
 	#undef gsw
 }
@@ -148,6 +180,7 @@ void gwinProgressbarSetResolution(GHandle gh, int resolution) {
 
 void gwinProgressbarIncrement(GHandle gh) {
 	#define gsw		((GProgressbarObject *)gh)
+	gCoord	odpos;
 
 	if (gh->vmt != (gwinVMT *)&progressbarVMT)
 		return;
@@ -156,14 +189,16 @@ void gwinProgressbarIncrement(GHandle gh) {
 	if (gsw->pos < gsw->min) gsw->pos = gsw->min;
 	else if (gsw->pos > gsw->max) gsw->pos = gsw->max;
 
+	odpos = gsw->dpos;
 	PBResetDisplayPos(gsw);
-	_gwinUpdate(gh);
+	PBUpdate(gsw, odpos);
 
 	#undef gsw
 }
 
 void gwinProgressbarDecrement(GHandle gh) {
 	#define gsw		((GProgressbarObject *)gh)
+	gCoord	odpos;
 
 	if (gh->vmt != (gwinVMT *)&progressbarVMT)
 		return;
@@ -172,8 +207,9 @@ void gwinProgressbarDecrement(GHandle gh) {
 	if (gsw->pos < gsw->min) gsw->pos = gsw->min;
 	else if (gsw->pos > gsw->max) gsw->pos = gsw->max;
 
+	odpos = gsw->dpos;
 	PBResetDisplayPos(gsw);
-	_gwinUpdate(gh);
+	PBUpdate(gsw, odpos);
 
 	#undef gsw
 }
@@ -240,22 +276,22 @@ void gwinProgressbarDraw_Std(GWidgetObject *gw, void *param) {
 	// Vertical progressbar
 	if (gw->g.width < gw->g.height) {
 		if (gsw->dpos != gw->g.height-1)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y+gsw->dpos, gw->g.width, gw->g.height - gsw->dpos, pcol->progress);				// Active Area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos, gw->g.width, gw->g.height - gsw->dpos, pcol->progress);				// Active Area
 		if (gsw->dpos != 0)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gsw->dpos, pcol->fill);											// Inactive area
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);												// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos, pcol->edge);					// Thumb
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gsw->dpos, pcol->fill);											// Inactive area
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);												// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos, pcol->edge);					// Thumb
 
 	// Horizontal progressbar
 	} else {
 		if (gsw->dpos != gw->g.width-1)
-			gdispGFillArea(gw->g.display, gw->g.x+gsw->dpos, gw->g.y, gw->g.width-gsw->dpos, gw->g.height, pcol->fill);						// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y, gw->g.width-gsw->dpos, gw->g.height, pcol->fill);						// Inactive area
 		if (gsw->dpos != 0)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gsw->dpos, gw->g.height, pcol->progress);										// Active Area
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);												// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos, gw->g.y, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-1, pcol->edge);					// Thumb
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gsw->dpos, gw->g.height, pcol->progress);										// Active Area
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);												// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-1, pcol->edge);					// Thumb
 	}
-	gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+	gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 
 	#undef gsw
 }
@@ -278,7 +314,7 @@ void gwinProgressbarDraw_Image(GWidgetObject *gw, void *param) {
 	// Vertical progressbar
 	if (gw->g.width < gw->g.height) {
 		if (gsw->dpos != 0)							// The unfilled area
-			gdispGFillArea(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gsw->dpos-1, gw->pstyle->enabled.progress);	// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gsw->dpos-1, gw->pstyle->enabled.progress);	// Inactive area
 		if (gsw->dpos != gw->g.height-1) {			// The filled area
 			for(z=gw->g.height, v=gi->height; z > gsw->dpos;) {
 				z -= v;
@@ -286,27 +322,27 @@ void gwinProgressbarDraw_Image(GWidgetObject *gw, void *param) {
 					v -= gsw->dpos - z;
 					z = gsw->dpos;
 				}
-				gdispGImageDraw(gw->g.display, gi, gw->g.x+1, gw->g.y+z+1, gw->g.width-1, v-2, 0, gi->height-v);
+				gdispGImageDraw(gwinGetDrawDisplay(&gw->g), gi, gw->g.x+1, gw->g.y+z+1, gw->g.width-1, v-2, 0, gi->height-v);
 			}
 		}
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x+1, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-2, gw->g.y+gsw->dpos, pcol->edge);	// Thumb
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-2, gw->g.y+gsw->dpos, pcol->edge);	// Thumb
 
 	// Horizontal progressbar
 	} else {
 		if (gsw->dpos != gw->g.width-1)				// The unfilled area
-			gdispGFillArea(gw->g.display, gw->g.x+gsw->dpos+1, gw->g.y+1, gw->g.width-gsw->dpos-2, gw->g.height-2, gw->pstyle->enabled.progress);	// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos+1, gw->g.y+1, gw->g.width-gsw->dpos-2, gw->g.height-2, gw->pstyle->enabled.progress);	// Inactive area
 		if (gsw->dpos != 0) {						// The filled area
 			for(z=0, v=gi->width; z < gsw->dpos; z += v) {
 				if (z+v > gsw->dpos)
 					v -= z+v - gsw->dpos;
-				gdispGImageDraw(gw->g.display, gi, gw->g.x+z+1, gw->g.y+1, v-1, gw->g.height-2, 0, 0);
+				gdispGImageDraw(gwinGetDrawDisplay(&gw->g), gi, gw->g.x+z+1, gw->g.y+1, v-1, gw->g.height-2, 0, 0);
 			}
 		}
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos, gw->g.y+1, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-2, pcol->edge);	// Thumb
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y+1, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-2, pcol->edge);	// Thumb
 	}
-	gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+	gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 
 	#undef gsw
 }
@@ -31,6 +31,76 @@
 		#endif
 	#endif
 
+	// Off-screen containers draw into a pixmap and route the mouse using the hit grid
+	#if GWIN_NEED_OFFSCREEN
+		#if !GWIN_NEED_CONTAINERS
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GWIN_NEED_CONTAINERS is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GWIN_NEED_CONTAINERS is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GWIN_NEED_CONTAINERS
+			#define GWIN_NEED_CONTAINERS	GFXON
+		#endif
+		#if !GDISP_NEED_PIXMAP
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GDISP_NEED_PIXMAP is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GDISP_NEED_PIXMAP is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_PIXMAP
+			#define GDISP_NEED_PIXMAP	GFXON
+		#endif
+		#if !GDISP_NEED_CLIP
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GDISP_NEED_CLIP is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GDISP_NEED_CLIP is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_CLIP
+			#define GDISP_NEED_CLIP	GFXON
+		#endif
+		#if !GWIN_NEED_HITGRID
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GWIN_NEED_HITGRID is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GWIN_NEED_HITGRID is required when GWIN_NEED_OFFSCREEN is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GWIN_NEED_HITGRID
+			#define GWIN_NEED_HITGRID	GFXON
+		#endif
+	#endif
+	#if GWIN_REDRAW_DAMAGE && !GDISP_NEED_CLIP
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GWIN: GDISP_NEED_CLIP is required when GWIN_REDRAW_DAMAGE is GFXON. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GWIN: GDISP_NEED_CLIP is required when GWIN_REDRAW_DAMAGE is GFXON. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_CLIP
+		#define GDISP_NEED_CLIP	GFXON
+	#endif
+	#if GWIN_WIDGET_CACHE && !GDISP_NEED_PIXMAP
+		#if GFX_DISPLAY_RULE_WARNINGS
+			#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+				#warning "GWIN: GDISP_NEED_PIXMAP is required when GWIN_WIDGET_CACHE is GFXON. It has been turned on for you."
+			#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+				COMPILER_WARNING("GWIN: GDISP_NEED_PIXMAP is required when GWIN_WIDGET_CACHE is GFXON. It has been turned on for you.")
+			#endif
+		#endif
+		#undef GDISP_NEED_PIXMAP
+		#define GDISP_NEED_PIXMAP	GFXON
+	#endif
+
 	// Objects require their super-class
 	#if GWIN_NEED_TABSET || GWIN_NEED_FRAME || GWIN_NEED_CONTAINER
 		#if !GWIN_NEED_CONTAINERS
@@ -104,6 +174,11 @@
 			#undef GDISP_NEED_MULTITHREAD
 			#define GDISP_NEED_MULTITHREAD	GFXON
 		#endif
+		#if !GWIN_FLAT_STYLING && !GDISP_NEED_GRADIENT
+			// No warning needed for this - only the built-in renderers use it
+			#undef GDISP_NEED_GRADIENT
+			#define GDISP_NEED_GRADIENT	GFXON
+		#endif
 	#endif
 	#if GWIN_NEED_WINDOWMANAGER
 		#if !GFX_USE_GQUEUE || !GQUEUE_NEED_ASYNC
@@ -130,6 +205,42 @@
 			#undef GFX_USE_GTIMER
 			#define GFX_USE_GTIMER		GFXON
 		#endif
+		#if GWIN_REDRAW_OCCLUSION && !GDISP_NEED_CLIP_REGION
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GDISP_NEED_CLIP_REGION is required when GWIN_REDRAW_OCCLUSION is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GDISP_NEED_CLIP_REGION is required when GWIN_REDRAW_OCCLUSION is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_CLIP_REGION
+			#define GDISP_NEED_CLIP_REGION	GFXON
+		#endif
+		#if GWIN_REDRAW_FRAMES && GWIN_REDRAW_IMMEDIATE
+			#error "GWIN: GWIN_REDRAW_FRAMES can't be used with GWIN_REDRAW_IMMEDIATE."
+		#endif
+		#if GWIN_MOVE_BLIT && !GDISP_NEED_SCROLL
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GDISP_NEED_SCROLL is required when GWIN_MOVE_BLIT is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GDISP_NEED_SCROLL is required when GWIN_MOVE_BLIT is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_SCROLL
+			#define GDISP_NEED_SCROLL	GFXON
+		#endif
+		#if GWIN_MOVE_BLIT && !GDISP_NEED_CLIP
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GDISP_NEED_CLIP is required when GWIN_MOVE_BLIT is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GDISP_NEED_CLIP is required when GWIN_MOVE_BLIT is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_CLIP
+			#define GDISP_NEED_CLIP	GFXON
+		#endif
 	#endif
 
 	// Rules for individual objects
@@ -159,6 +270,19 @@
 			#error "GWIN: GDISP_NEED_TEXT is required if GWIN_NEED_CONSOLE is GFXON."
 		#endif
 	#endif
+	#if GWIN_NEED_GRAPH && GWIN_GRAPH_STREAMING
+		#if !GDISP_NEED_CLIP
+			#if GFX_DISPLAY_RULE_WARNINGS
+				#if GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_DIRECT
+					#warning "GWIN: GDISP_NEED_CLIP is required when GWIN_GRAPH_STREAMING is GFXON. It has been turned on for you."
+				#elif GFX_COMPILER_WARNING_TYPE == GFX_COMPILER_WARNING_MACRO
+					COMPILER_WARNING("GWIN: GDISP_NEED_CLIP is required when GWIN_GRAPH_STREAMING is GFXON. It has been turned on for you.")
+				#endif
+			#endif
+			#undef GDISP_NEED_CLIP
+			#define GDISP_NEED_CLIP	GFXON
+		#endif
+	#endif
 	#if GWIN_NEED_TEXTEDIT
 		#if !GDISP_NEED_TEXT
 			#error "GWIN: GDISP_NEED_TEXT is required if GWIN_NEED_TEXTEDIT is GFXON."
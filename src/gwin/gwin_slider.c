@@ -90,6 +90,36 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		gsw->dpos = (gsw->w.g.width-1)*(gsw->pos-gsw->min)/(gsw->max-gsw->min);
 }
 
+// Redraw the slider after the display position has moved from odpos
+static void SliderUpdate(GSliderObject *gsw, gCoord odpos) {
+	gCoord		p0, p1;
+
+	// Only the built-in drawing routines are known to depend on nothing but the display position
+	if (gsw->w.fnDraw != gwinSliderDraw_Std
+			#if GDISP_NEED_IMAGE
+				&& gsw->w.fnDraw != gwinSliderDraw_Image
+			#endif
+			) {
+		_gwinUpdate(&gsw->w.g);
+		return;
+	}
+
+	// Just the part between the old and new thumb (which is up to 2 pixels either side of the position)
+	if (odpos == gsw->dpos)
+		return;
+	if (odpos < gsw->dpos) {
+		p0 = odpos;
+		p1 = gsw->dpos;
+	} else {
+		p0 = gsw->dpos;
+		p1 = odpos;
+	}
+	if (gsw->w.g.width < gsw->w.g.height)
+		_gwinUpdateArea(&gsw->w.g, 0, p0-2, gsw->w.g.width, p1-p0+5);
+	else
+		_gwinUpdateArea(&gsw->w.g, p0-2, 0, p1-p0+5, gsw->w.g.height);
+}
+
 #if GINPUT_NEED_MOUSE
 	// Set the display position from the mouse position
 	static void SetDisplayPosFromMouse(GSliderObject *gsw, gCoord x, gCoord y) {
@@ -102,13 +132,16 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 	// A mouse up event
 	static void SliderMouseUp(GWidgetObject *gw, gCoord x, gCoord y) {
 		#define gsw		((GSliderObject *)gw)
+		gCoord	odpos;
+
+		odpos = gsw->dpos;
 
 		#if !GWIN_BUTTON_LAZY_RELEASE
 			// Are we over the slider?
 			if (x < 0 || x >= gsw->w.g.width || y < 0 || y >= gsw->w.g.height) {
 				// No - restore the slider
 				SliderResetDisplayPos(gsw);
-				_gwinUpdate(&gsw->w.g);
+				SliderUpdate(gsw, odpos);
 				SendSliderEvent(gsw, GSLIDER_EVENT_CANCEL);
 				return;
 			}
@@ -135,7 +168,7 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 		#else
 			SliderResetDisplayPos(gsw);
 		#endif
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw, odpos);
 
 		// Generate the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_SET);
@@ -146,12 +179,14 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 	// A mouse down event
 	static void SliderMouseDown(GWidgetObject *gw, gCoord x, gCoord y) {
 		#define gsw		((GSliderObject *)gw)
+		gCoord	odpos;
 
 		// Determine the display position
+		odpos = gsw->dpos;
 		SetDisplayPosFromMouse(gsw, x, y);
 
 		// Update the display
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw, odpos);
 
 		// Send the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_START);
@@ -162,12 +197,14 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 	// A mouse move event
 	static void SliderMouseMove(GWidgetObject *gw, gCoord x, gCoord y) {
 		#define gsw		((GSliderObject *)gw)
+		gCoord	odpos;
 
 		// Determine the display position
+		odpos = gsw->dpos;
 		SetDisplayPosFromMouse(gsw, x, y);
 
 		// Update the display
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw, odpos);
 
 		// Send the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_MOVE);
@@ -207,13 +244,15 @@ static void SliderResetDisplayPos(GSliderObject *gsw) {
 	// A dial move event
 	static void SliderDialMove(GWidgetObject *gw, gU16 role, gU16 value, gU16 max) {
 		#define gsw		((GSliderObject *)gw)
+		gCoord			odpos;
 		(void)			role;
 
 		// Set the new position
 		gsw->pos = (gU16)((gU32)value*(gsw->max-gsw->min)/max + gsw->min);
 
+		odpos = gsw->dpos;
 		SliderResetDisplayPos(gsw);
-		_gwinUpdate(&gsw->w.g);
+		SliderUpdate(gsw, odpos);
 
 		// Generate the event
 		SendSliderEvent(gsw, GSLIDER_EVENT_SET);
@@ -307,6 +346,7 @@ void gwinSliderSetRange(GHandle gh, int min, int max) {
 
 void gwinSliderSetPosition(GHandle gh, int pos) {
 	#define gsw		((GSliderObject *)gh)
+	gCoord	odpos;
 
 	if (gh->vmt != (gwinVMT *)&sliderVMT)
 		return;
@@ -320,8 +360,9 @@ void gwinSliderSetPosition(GHandle gh, int pos) {
 		else if (pos < gsw->max) gsw->pos = gsw->max;
 		else gsw->pos = pos;
 	}
+	odpos = gsw->dpos;
 	SliderResetDisplayPos(gsw);
-	_gwinUpdate(gh);
+	SliderUpdate(gsw, odpos);
 
 	#undef gsw
 }
@@ -356,32 +397,32 @@ void gwinSliderDraw_Std(GWidgetObject *gw, void *param) {
 	// Vertical slider
 	if (gw->g.width < gw->g.height) {
 		if (gsw->dpos != gw->g.height-1)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y+gsw->dpos, gw->g.width, gw->g.height - gsw->dpos, pcol->progress);		// Active area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos, gw->g.width, gw->g.height - gsw->dpos, pcol->progress);		// Active area
 		if (gsw->dpos != 0)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gsw->dpos, pcol->fill);									// Inactive area
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);										// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos, pcol->edge);			// Thumb
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gsw->dpos, pcol->fill);									// Inactive area
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);										// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos, pcol->edge);			// Thumb
 		if (gsw->dpos >= 2)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos-2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos-2, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos-2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos-2, pcol->edge);	// Thumb
 		if (gsw->dpos <= gw->g.height-2)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos+2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos+2, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos+2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos+2, pcol->edge);	// Thumb
 
 	// Horizontal slider
 	} else {
 		if (gsw->dpos != gw->g.width-1)
-			gdispGFillArea(gw->g.display, gw->g.x+gsw->dpos, gw->g.y, gw->g.width-gsw->dpos, gw->g.height, pcol->fill);				// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y, gw->g.width-gsw->dpos, gw->g.height, pcol->fill);				// Inactive area
 		if (gsw->dpos != 0)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gsw->dpos, gw->g.height, pcol->progress);								// Active area
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);										// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos, gw->g.y, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-1, pcol->edge);			// Thumb
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gsw->dpos, gw->g.height, pcol->progress);								// Active area
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);										// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-1, pcol->edge);			// Thumb
 		if (gsw->dpos >= 2)
-			gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos-2, gw->g.y, gw->g.x+gsw->dpos-2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos-2, gw->g.y, gw->g.x+gsw->dpos-2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
 		if (gsw->dpos <= gw->g.width-2)
-			gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos+2, gw->g.y, gw->g.x+gsw->dpos+2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos+2, gw->g.y, gw->g.x+gsw->dpos+2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
 	}
 
 	// Draw the string
-	gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+	gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 
 	#undef gsw
 }
@@ -411,61 +452,61 @@ void gwinSliderDraw_Bars(GWidgetObject *gw, void *param) {
 	// Vertical slider
 	if (gw->g.width < gw->g.height) {
 		if (gsw->dpos != gw->g.height-1)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y+gsw->dpos, gw->g.width, gw->g.height - gsw->dpos, pcol->progress);		// Active area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos, gw->g.width, gw->g.height - gsw->dpos, pcol->progress);		// Active area
 		if (gsw->dpos != 0)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gsw->dpos, pcol->fill);									// Inactive area
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);										// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos, pcol->edge);			// Thumb
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gsw->dpos, pcol->fill);									// Inactive area
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);										// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos, pcol->edge);			// Thumb
 		if (gsw->dpos >= 2)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos-2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos-2, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos-2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos-2, pcol->edge);	// Thumb
 		if (gsw->dpos <= gw->g.height-2)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+gsw->dpos+2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos+2, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+gsw->dpos+2, gw->g.x+gw->g.width-1, gw->g.y+gsw->dpos+2, pcol->edge);	// Thumb
 
 	// Horizontal slider
 	} else {
 
 #if 0
 		if (gsw->dpos != gw->g.width-1)
-			gdispGFillArea(gw->g.display, gw->g.x+gsw->dpos, gw->g.y, gw->g.width-gsw->dpos, gw->g.height, HTML2COLOR(0x141414));				// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y, gw->g.width-gsw->dpos, gw->g.height, HTML2COLOR(0x141414));				// Inactive area
 
 		if (gsw->dpos != 0)
-			gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, gsw->dpos, gw->g.height, HTML2COLOR(0xEB9300));								// Active area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gsw->dpos, gw->g.height, HTML2COLOR(0xEB9300));								// Active area
 
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, HTML2COLOR(0x6c6c6c));							// Edge
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, HTML2COLOR(0x6c6c6c));							// Edge
 #else
 		for ( i = 0; i < total_dashes; i++) {
 			/* GREY Background lite off */
-			//gdispGFillArea(gw->g.display, gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0x161616));
+			//gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0x161616));
 			
-			gdispGFillArea(gw->g.display, gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0x000714));
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0x000714));
 		}
 
 		for ( i = 0; i < num_dashes + 1; i++) {
 
 			if ( i < 40 ) {
-				if (gsw->dpos != 0) gdispGFillArea(gw->g.display, gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0x004EEB));
+				if (gsw->dpos != 0) gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0x004EEB));
 			} else if ( i > 39 && i < 50 ) {
-				gdispGFillArea(gw->g.display, gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0xFFB20D));
+				gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0xFFB20D));
 			}
 			else {
-				gdispGFillArea(gw->g.display, gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0xF50076));
+				gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x + (i * (dash_width + dash_gap) + 1 ), gw->g.y, (dash_width) , gw->g.height, HTML2COLOR(0xF50076));
 			}
 		}
 #endif
 		
 		
 #if 0
-		gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos, gw->g.y, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-1, pcol->edge);			// Thumb
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-1, pcol->edge);			// Thumb
 		if (gsw->dpos >= 2)
-			gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos-2, gw->g.y, gw->g.x+gsw->dpos-2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos-2, gw->g.y, gw->g.x+gsw->dpos-2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
 		if (gsw->dpos <= gw->g.width-2)
-			gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos+2, gw->g.y, gw->g.x+gsw->dpos+2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos+2, gw->g.y, gw->g.x+gsw->dpos+2, gw->g.y+gw->g.height-1, pcol->edge);	// Thumb
 #endif
 
 	}
 
 	// Draw the string
-	gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, justifyCenter);
+	gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, justifyCenter);
 
 	#undef gsw
 }
@@ -488,7 +529,7 @@ void gwinSliderDraw_Image(GWidgetObject *gw, void *param) {
 
 	if (gw->g.width < gw->g.height) {			// Vertical slider
 		if (gsw->dpos != 0)							// The unfilled area
-			gdispGFillArea(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gsw->dpos-1, gw->pstyle->enabled.progress);	// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gsw->dpos-1, gw->pstyle->enabled.progress);	// Inactive area
 		if (gsw->dpos != gw->g.height-1) {			// The filled area
 			for(z=gw->g.height, v=gi->height; z > gsw->dpos;) {
 				z -= v;
@@ -496,27 +537,27 @@ void gwinSliderDraw_Image(GWidgetObject *gw, void *param) {
 					v -= gsw->dpos - z;
 					z = gsw->dpos;
 				}
-				gdispGImageDraw(gw->g.display, gi, gw->g.x+1, gw->g.y+z+1, gw->g.width-1, v-2, 0, gi->height-v);
+				gdispGImageDraw(gwinGetDrawDisplay(&gw->g), gi, gw->g.x+1, gw->g.y+z+1, gw->g.width-1, v-2, 0, gi->height-v);
 			}
 		}
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x+1, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-2, gw->g.y+gsw->dpos, pcol->edge);	// Thumb
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+gsw->dpos, gw->g.x+gw->g.width-2, gw->g.y+gsw->dpos, pcol->edge);	// Thumb
 
 	// Horizontal slider
 	} else {
 		if (gsw->dpos != gw->g.width-1)				// The unfilled area
-			gdispGFillArea(gw->g.display, gw->g.x+gsw->dpos+1, gw->g.y+1, gw->g.width-gsw->dpos-2, gw->g.height-2, gw->pstyle->enabled.progress);	// Inactive area
+			gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos+1, gw->g.y+1, gw->g.width-gsw->dpos-2, gw->g.height-2, gw->pstyle->enabled.progress);	// Inactive area
 		if (gsw->dpos != 0) {						// The filled area
 			for(z=0, v=gi->width; z < gsw->dpos; z += v) {
 				if (z+v > gsw->dpos)
 					v -= z+v - gsw->dpos;
-				gdispGImageDraw(gw->g.display, gi, gw->g.x+z+1, gw->g.y+1, v-1, gw->g.height-2, 0, 0);
+				gdispGImageDraw(gwinGetDrawDisplay(&gw->g), gi, gw->g.x+z+1, gw->g.y+1, v-1, gw->g.height-2, 0, 0);
 			}
 		}
-		gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
-		gdispGDrawLine(gw->g.display, gw->g.x+gsw->dpos, gw->g.y+1, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-2, pcol->edge);	// Thumb
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);								// Edge
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+gsw->dpos, gw->g.y+1, gw->g.x+gsw->dpos, gw->g.y+gw->g.height-2, pcol->edge);	// Thumb
 	}
-	gdispGDrawStringBox(gw->g.display, gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
+	gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+1, gw->g.width-2, gw->g.height-2, gw->text, gw->g.font, pcol->text, gJustifyCenter);
 
 	#undef gsw
 	#undef gi
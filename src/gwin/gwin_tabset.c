@@ -144,6 +144,9 @@ static void FixTabSizePos(GHandle gh) {
 	gCoord		w, h, oldth;
 	GHandle		vis, ph;
 
+	// The tabs have changed
+	_gwidgetCacheFlush(gh);
+
 	oldth = ((GTabsetObject *)gh)->border_top;
 	((GTabsetObject *)gh)->border_top = CalcTabHeight(gh);
 	oldth -= ((GTabsetObject *)gh)->border_top;
@@ -221,6 +224,7 @@ static gCoord TabSetBorderTop(GHandle gh)		{ return ((GTabsetObject *)gh)->borde
 		_gwinRippleVisibility();
 
 		// Force a redraw of the whole tabset
+		_gwidgetCacheFlush(&gw->g);
 		_gwinUpdate(&gw->g);
 
 		// Send the Tabset Event
@@ -392,6 +396,7 @@ void gwinTabsetSetTab(GHandle gh) {
 	_gwinRippleVisibility();
 
 	// Force a redraw of the tabset
+	_gwidgetCacheFlush(gh->parent);
 	gwinRedraw(gh->parent);
 }
 
@@ -405,25 +410,25 @@ void gwinTabsetSetTab(GHandle gh) {
 
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->pressed : &gw->pstyle->disabled;
 
-		gdispGDrawBox(gw->g.display, gw->g.x+x, gw->g.y+y, w, GWIN_TABSET_TABHEIGHT, pcol->edge);
-		gdispGFillStringBox(gw->g.display, gw->g.x+x+1, gw->g.y+y+1, w-2, GWIN_TABSET_TABHEIGHT-1, text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
+		gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y, w, GWIN_TABSET_TABHEIGHT, pcol->edge);
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+x+1, gw->g.y+y+1, w-2, GWIN_TABSET_TABHEIGHT-1, text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
 	}
 	static void bgarea(GWidgetObject *gw, const char *text, gCoord y, gCoord x, gCoord w) {
 		const GColorSet *	pcol;
 
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->enabled : &gw->pstyle->disabled;
 
-		gdispGFillStringBox(gw->g.display, gw->g.x+x, gw->g.y+y, w-1, GWIN_TABSET_TABHEIGHT, text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
-		gdispGDrawLine(gw->g.display, gw->g.x+x+w-1, gw->g.y+y, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
-		gdispGDrawLine(gw->g.display, gw->g.x+x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, gw->g.x+x+w-2, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y, w-1, GWIN_TABSET_TABHEIGHT, text, gw->g.font, pcol->text, pcol->fill, gJustifyCenter);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x+w-1, gw->g.y+y, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, gw->g.x+x+w-2, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
 	}
 	static void ntarea(GWidgetObject *gw, gCoord y, gCoord x, gCoord w) {
 		const GColorSet *	pcol;
 
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->pressed : &gw->pstyle->disabled;
 
-		gdispGFillArea(gw->g.display, gw->g.x+x, gw->g.y, w+y, GWIN_TABSET_TABHEIGHT-1, gw->g.bgcolor);
-		gdispGDrawLine(gw->g.display, gw->g.x+x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y, w+y, GWIN_TABSET_TABHEIGHT-1, gw->g.bgcolor);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
 	}
 #else
 	static void fgarea(GWidgetObject *gw, const char *text, gCoord y, gCoord x, gCoord w) {
@@ -433,17 +438,15 @@ void gwinTabsetSetTab(GHandle gh) {
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->pressed : &gw->pstyle->disabled;
 
 		tcol = gdispBlendColor(pcol->edge, gw->pstyle->background, GTABSET_OUTLINE_FADE);
-		gdispGFillStringBox(gw->g.display, gw->g.x+x, gw->g.y+y, w, GWIN_TABSET_TABHEIGHT, text, gw->g.font, pcol->text, gw->g.bgcolor, gJustifyCenter);
-		gdispGDrawLine(gw->g.display, gw->g.x+x, gw->g.y+y, gw->g.x+x+w-(GTABSET_TAB_CNR+1), gw->g.y+y, tcol);
-		gdispGDrawLine(gw->g.display, gw->g.x+x+w-(GTABSET_TAB_CNR+1), gw->g.y+y, gw->g.x+x+w-1, gw->g.y+y+GTABSET_TAB_CNR, tcol);
-		gdispGDrawLine(gw->g.display, gw->g.x+x+w-1, gw->g.y+y+GTABSET_TAB_CNR, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, tcol);
+		gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y, w, GWIN_TABSET_TABHEIGHT, text, gw->g.font, pcol->text, gw->g.bgcolor, gJustifyCenter);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y, gw->g.x+x+w-(GTABSET_TAB_CNR+1), gw->g.y+y, tcol);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x+w-(GTABSET_TAB_CNR+1), gw->g.y+y, gw->g.x+x+w-1, gw->g.y+y+GTABSET_TAB_CNR, tcol);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x+w-1, gw->g.y+y+GTABSET_TAB_CNR, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, tcol);
 		if (!x)
-			gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+y, gw->g.x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, tcol);
+			gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+y, gw->g.x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, tcol);
 	}
 	static void bgarea(GWidgetObject *gw, const char *text, gCoord y, gCoord x, gCoord w) {
 		const GColorSet *	pcol;
-		fixed				alpha;
-		gCoord				i;
 		gColor				tcol, bcol;
 
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->enabled : &gw->pstyle->disabled;
@@ -451,18 +454,17 @@ void gwinTabsetSetTab(GHandle gh) {
 		/* Fill the box blended from variants of the fill color */
 		tcol = gdispBlendColor(GFX_WHITE, pcol->fill, GTABSET_TOP_FADE);
 		bcol = gdispBlendColor(GFX_BLACK, pcol->fill, GTABSET_BOTTOM_FADE);
-		for(alpha = 0, i = 0; i < GWIN_TABSET_TABHEIGHT; i++, alpha += FIXED(255)/GWIN_TABSET_TABHEIGHT)
-			gdispGDrawLine(gw->g.display, gw->g.x+x, gw->g.y+y+i, gw->g.x+x+w-2, gw->g.y+y+i, gdispBlendColor(bcol, tcol, NONFIXED(alpha)));
-		gdispGDrawLine(gw->g.display, gw->g.x+x+w-1, gw->g.y+y, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
-		gdispGDrawStringBox(gw->g.display, gw->g.x+x+1, gw->g.y+y+1, w-2, GWIN_TABSET_TABHEIGHT-2, text, gw->g.font, pcol->text, gJustifyCenter);
+		gdispGFillGradient(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y, w-1, GWIN_TABSET_TABHEIGHT, gGradientVertical, tcol, bcol);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x+w-1, gw->g.y+y, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
+		gdispGDrawStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x+x+1, gw->g.y+y+1, w-2, GWIN_TABSET_TABHEIGHT-2, text, gw->g.font, pcol->text, gJustifyCenter);
 	}
 	static void ntarea(GWidgetObject *gw, gCoord y, gCoord x, gCoord w) {
 		const GColorSet *	pcol;
 
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->pressed : &gw->pstyle->disabled;
 
-		gdispGFillArea(gw->g.display, gw->g.x+x, gw->g.y+y, w, GWIN_TABSET_TABHEIGHT-1, gw->g.bgcolor);
-		gdispGDrawLine(gw->g.display, gw->g.x+x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y, w, GWIN_TABSET_TABHEIGHT-1, gw->g.bgcolor);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x+x, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, gw->g.x+x+w-1, gw->g.y+y+GWIN_TABSET_TABHEIGHT-1, pcol->edge);
 	}
 #endif
 
@@ -500,9 +502,9 @@ static void drawborder(GWidgetObject *gw, gCoord y) {
 		pcol = (gw->g.flags & GWIN_FLG_SYSENABLED) ? &gw->pstyle->enabled : &gw->pstyle->disabled;
 		x = gw->g.x+gw->g.width-1;
 		w = gw->g.y+gw->g.height-1;
-		gdispGDrawLine(gw->g.display, gw->g.x, gw->g.y+y, gw->g.x, w-1, pcol->edge);
-		gdispGDrawLine(gw->g.display, gw->g.x, w, x, w, pcol->edge);
-		gdispGDrawLine(gw->g.display, x, gw->g.y+y, x, w-1, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+y, gw->g.x, w-1, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), gw->g.x, w, x, w, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), x, gw->g.y+y, x, w-1, pcol->edge);
 	}
 }
 
@@ -530,9 +532,9 @@ void gwinTabsetDraw_Std(GWidgetObject *gw, void *param) {
 
 	// Draw the client area
 	if ((gw->g.flags & GWIN_CONTAINER_BORDER))
-		gdispGFillArea(gw->g.display, gw->g.x+1, gw->g.y+y, gw->g.width-2, gw->g.height-y-1, gw->pstyle->background);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x+1, gw->g.y+y, gw->g.width-2, gw->g.height-y-1, gw->pstyle->background);
 	else
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y+y, gw->g.width, gw->g.height-y, gw->pstyle->background);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y+y, gw->g.width, gw->g.height-y, gw->pstyle->background);
 }
 
 #if GDISP_NEED_IMAGE
@@ -563,7 +565,7 @@ void gwinTabsetDraw_Std(GWidgetObject *gw, void *param) {
 			for(iw = gi->width; x < mx; x += iw) {
 				if (iw > mx - x)
 					iw = mx - x;
-				gdispGImageDraw(gw->g.display, gi, x, y, iw, ih, 0, 0);
+				gdispGImageDraw(gwinGetDrawDisplay(&gw->g), gi, x, y, iw, ih, 0, 0);
 			}
 		}
 
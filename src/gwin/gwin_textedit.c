@@ -26,6 +26,57 @@
 #define gh2obj ((GTexteditObject *)gh)
 #define gw2obj ((GTexteditObject *)gw)
 
+// Get the first character shown so that the cursor fits in the window and the cursor position from there
+static const char *TextEditFirstShown(GWidgetObject *gw, gCoord *ptpos) {
+	const char	*p;
+	gCoord		cpos;
+
+	p = gw->text;
+	if (!gw2obj->cursorPos)
+		*ptpos = 0;
+	else {
+		for(cpos = gw2obj->cursorPos; ; p++, cpos--) {
+			*ptpos = gdispGetStringWidthCount(p, gw->g.font, cpos);
+			if (*ptpos < gw->g.width-(TEXT_PADDING_LEFT+CURSOR_PADDING_LEFT))
+				break;
+		}
+	}
+	return p;
+}
+
+#if GWIN_REDRAW_DAMAGE
+	// Redraw after an edit. If the text has not scrolled only the part to the right of the old or new cursor needs redrawing.
+	static void TextEditUpdate(GHandle gh, unsigned ofirst, gCoord otpos, gBool textchanged) {
+		const char	*p;
+		gCoord		tpos, x, m;
+
+		if (gh2obj->w.fnDraw != gwinTexteditDefaultDraw) {
+			_gwinUpdate(gh);
+			return;
+		}
+		p = TextEditFirstShown(&gh2obj->w, &tpos);
+		if ((unsigned)(p - gh2obj->w.text) != ofirst) {
+			_gwinUpdate(gh);
+			return;
+		}
+
+		// Allow for characters drawn outside their advance width
+		m = gdispGetFontMetric(gh->font, gFontMaxWidth);
+		if (tpos > otpos) {
+			x = otpos;
+			otpos = tpos;
+			tpos = x;
+		}
+		x = TEXT_PADDING_LEFT + CURSOR_PADDING_LEFT + tpos - m;
+
+		// The text to the right of the cursor moves if it has changed
+		if (textchanged)
+			_gwinUpdateArea(gh, x, 0, gh->width - x, gh->height);
+		else
+			_gwinUpdateArea(gh, x, 0, otpos - tpos + gdispGetFontMetric(gh->font, gFontBaselineX)/2 + 2*m + 1, gh->height);
+	}
+#endif
+
 static void TextEditRemoveChar(GHandle gh) {
 	char		*p;
 	const char	*q;
@@ -93,9 +144,17 @@ static gBool TextEditAddChars(GHandle gh, unsigned cnt) {
 // the string once.
 static void TextEditMouseDown(GWidgetObject* gw, gCoord x, gCoord y) {
 	gU16 i = 0;
+	#if GWIN_REDRAW_DAMAGE
+		unsigned	ofirst;
+		gCoord		otpos;
+	#endif
 
 	(void)y;
 
+	#if GWIN_REDRAW_DAMAGE
+		ofirst = TextEditFirstShown(gw, &otpos) - gw->text;
+	#endif
+
 	// Directly jump to the end of the string
 	if (x > gdispGetStringWidth(gw->text, gw->g.font)) {
 		gw2obj->cursorPos = strlen(gw->text);
@@ -110,7 +169,11 @@ static void TextEditMouseDown(GWidgetObject* gw, gCoord x, gCoord y) {
 		gw2obj->cursorPos = i-1;
 	}
 
-	_gwinUpdate((GHandle)gw);
+	#if GWIN_REDRAW_DAMAGE
+		TextEditUpdate((GHandle)gw, ofirst, otpos, gFalse);
+	#else
+		_gwinUpdate((GHandle)gw);
+	#endif
 }
 
 #if (GFX_USE_GINPUT && GINPUT_NEED_KEYBOARD) || GWIN_NEED_KEYBOARD
@@ -199,6 +262,10 @@ GHandle gwinGTexteditSetCursorPosition(GTexteditObject* wt, size_t position)
 #if (GFX_USE_GINPUT && GINPUT_NEED_KEYBOARD) || GWIN_NEED_KEYBOARD
 	void gwinTextEditSendSpecialKey(GHandle gh, gU8 key) {
 		unsigned sz;
+		#if GWIN_REDRAW_DAMAGE
+			unsigned	ofirst;
+			gCoord		otpos;
+		#endif
 
  		// Is it a valid handle?
  		if (gh->vmt != (gwinVMT*)&texteditVMT)
@@ -208,6 +275,9 @@ GHandle gwinGTexteditSetCursorPosition(GTexteditObject* wt, size_t position)
 		sz = strlen(gh2obj->w.text);
 		if (gh2obj->cursorPos > sz)
 			gh2obj->cursorPos = sz;
+		#if GWIN_REDRAW_DAMAGE
+			ofirst = TextEditFirstShown(&gh2obj->w, &otpos) - gh2obj->w.text;
+		#endif
 
 		// Arrow keys to move the cursor
 		switch (key) {
@@ -235,14 +305,27 @@ GHandle gwinGTexteditSetCursorPosition(GTexteditObject* wt, size_t position)
 			return;
 		}
 
-		_gwinUpdate(gh);
+		#if GWIN_REDRAW_DAMAGE
+			TextEditUpdate(gh, ofirst, otpos, gFalse);
+		#else
+			_gwinUpdate(gh);
+		#endif
 	}
 
 	void gwinTextEditSendKey(GHandle gh, char *key, unsigned len) {
+		#if GWIN_REDRAW_DAMAGE
+			unsigned	ofirst;
+			gCoord		otpos;
+		#endif
+
 		// Is it a valid handle?
 		if (gh->vmt != (gwinVMT*)&texteditVMT || !key || !len)
 			return;
 
+		#if GWIN_REDRAW_DAMAGE
+			ofirst = TextEditFirstShown(&gh2obj->w, &otpos) - gh2obj->w.text;
+		#endif
+
 		// Normal key press
 		switch((gU8)key[0]) {
 		case GKEY_BACKSPACE:
@@ -282,7 +365,11 @@ GHandle gwinGTexteditSetCursorPosition(GTexteditObject* wt, size_t position)
 			break;
 		}
 
-		_gwinUpdate(gh);
+		#if GWIN_REDRAW_DAMAGE
+			TextEditUpdate(gh, ofirst, otpos, gTrue);
+		#else
+			_gwinUpdate(gh);
+		#endif
 	}
 #endif
 
@@ -305,22 +392,13 @@ void gwinTexteditDefaultDraw(GWidgetObject* gw, void* param)
 		pcol = &gw->pstyle->disabled;
 
 	// Adjust the text position so the cursor fits in the window
-	p = gw->text;
-	if (!gw2obj->cursorPos)
-		tpos = 0;
-	else {
-		for(cpos = gw2obj->cursorPos; ; p++, cpos--) {
-			tpos = gdispGetStringWidthCount(p, gw->g.font, cpos);
-			if (tpos < gw->g.width-(TEXT_PADDING_LEFT+CURSOR_PADDING_LEFT))
-				break;
-		}
-	}
+	p = TextEditFirstShown(gw, &tpos);
 
 	// Render background and string
 	#if TEXT_PADDING_LEFT
-		gdispGFillArea(gw->g.display, gw->g.x, gw->g.y, TEXT_PADDING_LEFT, gw->g.height, pcol->fill);
+		gdispGFillArea(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, TEXT_PADDING_LEFT, gw->g.height, pcol->fill);
 	#endif
-	gdispGFillStringBox(gw->g.display, gw->g.x + TEXT_PADDING_LEFT, gw->g.y, gw->g.width-TEXT_PADDING_LEFT, gw->g.height, p, gw->g.font, pcol->text, pcol->fill, gJustifyLeft);
+	gdispGFillStringBox(gwinGetDrawDisplay(&gw->g), gw->g.x + TEXT_PADDING_LEFT, gw->g.y, gw->g.width-TEXT_PADDING_LEFT, gw->g.height, p, gw->g.font, pcol->text, pcol->fill, gJustifyLeft);
 
 	// Render cursor (if focused)
 	if (gwinGetFocus() == (GHandle)gw) {
@@ -329,11 +407,11 @@ void gwinTexteditDefaultDraw(GWidgetObject* gw, void* param)
 		// Draw cursor
 		tpos += gw->g.x + CURSOR_PADDING_LEFT + TEXT_PADDING_LEFT + gdispGetFontMetric(gw->g.font, gFontBaselineX)/2;
 		cpos = (gw->g.height - gdispGetFontMetric(gw->g.font, gFontHeight))/2 - CURSOR_EXTRA_HEIGHT;
-		gdispGDrawLine(gw->g.display, tpos, gw->g.y + cpos, tpos, gw->g.y + gw->g.height - cpos, pcol->edge);
+		gdispGDrawLine(gwinGetDrawDisplay(&gw->g), tpos, gw->g.y + cpos, tpos, gw->g.y + gw->g.height - cpos, pcol->edge);
 	}
 
 	// Render border
-	gdispGDrawBox(gw->g.display, gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);
+	gdispGDrawBox(gwinGetDrawDisplay(&gw->g), gw->g.x, gw->g.y, gw->g.width, gw->g.height, pcol->edge);
 
 	// Render highlighted border if focused
 	_gwidgetDrawFocusRect(gw, 0, 0, gw->g.width, gw->g.height);
@@ -92,6 +92,64 @@ static const GWidgetStyle *	defaultStyle = &BlackWidgetStyle;
 #define gw		((GWidgetObject *)gh)
 #define wvmt	((gwidgetVMT *)gh->vmt)
 
+#if GFX_USE_GINPUT && (GINPUT_NEED_TOGGLE || GINPUT_NEED_DIAL)
+	/**
+	 * The widget roles attached to each toggle or dial instance.
+	 * Events go straight to these rather than asking every widget about every role.
+	 */
+	typedef struct InstanceUser {
+		struct InstanceUser *	next;
+		GHandle					gh;
+		gU16					instance;
+		gU16					role;
+	} InstanceUser;
+
+	#define INSTANCE_HASH			8
+	#define InstanceFirst(map, i)	((map)[(i) & (INSTANCE_HASH-1)])
+
+	static gBool InstanceBind(InstanceUser **map, GHandle gh, gU16 role, gU16 instance) {
+		InstanceUser	*pu;
+
+		if (!(pu = gfxAlloc(sizeof(InstanceUser))))
+			return gFalse;
+		pu->gh = gh;
+		pu->instance = instance;
+		pu->role = role;
+		pu->next = InstanceFirst(map, instance);
+		InstanceFirst(map, instance) = pu;
+		return gTrue;
+	}
+
+	static void InstanceUnbind(InstanceUser **map, GHandle gh, gU16 role, gU16 instance) {
+		InstanceUser	**ppu, *pu;
+
+		for(ppu = &InstanceFirst(map, instance); (pu = *ppu); ppu = &pu->next) {
+			if (pu->gh == gh && pu->role == role && pu->instance == instance) {
+				*ppu = pu->next;
+				gfxFree(pu);
+				return;
+			}
+		}
+	}
+
+	static gBool InstanceUsed(InstanceUser **map, gU16 instance) {
+		InstanceUser	*pu;
+
+		for(pu = InstanceFirst(map, instance); pu; pu = pu->next) {
+			if (pu->instance == instance)
+				return gTrue;
+		}
+		return gFalse;
+	}
+#endif
+
+#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
+	static InstanceUser *	ToggleUsers[INSTANCE_HASH];
+#endif
+#if GFX_USE_GINPUT && GINPUT_NEED_DIAL
+	static InstanceUser *	DialUsers[INSTANCE_HASH];
+#endif
+
 // Process an event
 static void gwidgetEvent(void *param, GEvent *pe) {
 	#define pme		((GEventMouse *)pe)
@@ -106,8 +164,12 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 		#if GINPUT_NEED_MOUSE || GINPUT_NEED_TOGGLE || GINPUT_NEED_DIAL || GINPUT_NEED_KEYBOARD
 			GHandle			gh;
 		#endif
+		#if GINPUT_NEED_MOUSE && GWIN_NEED_HITGRID
+			GHandle *		pcapture;
+		#endif
 		#if GINPUT_NEED_TOGGLE || GINPUT_NEED_DIAL
-			gU16		role;
+			InstanceUser *	pu;
+			InstanceUser *	pnext;
 		#endif
 	#endif
 	
@@ -119,6 +181,27 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 	#if GFX_USE_GINPUT && GINPUT_NEED_MOUSE
 	case GEVENT_MOUSE:
 	case GEVENT_TOUCH:
+		#if GWIN_NEED_HITGRID
+			// Use the hit grid if we can track this display
+			if ((pcapture = _gwinHitCapture(pme->display))) {
+				// Is the mouse currently captured by a widget?
+				gh = *pcapture;
+				if (gh && (gh->flags & GWIN_FLG_SYSVISIBLE)) {
+					if ((pme->buttons & GMETA_MOUSE_UP)) {
+						gh->flags &= ~GWIN_FLG_MOUSECAPTURE;
+						*pcapture = 0;
+						if (wvmt->MouseUp)
+							wvmt->MouseUp(gw, pme->x - gh->x, pme->y - gh->y);
+					} else if (wvmt->MouseMove)
+						wvmt->MouseMove(gw, pme->x - gh->x, pme->y - gh->y);
+					break;
+				}
+
+				// Find the highest z-order window that the mouse is over
+				gh = _gwinHitTest(pme->display, pme->x, pme->y);
+			} else
+		#endif
+
 		// Cycle through all windows
 		for (gh = 0, h = gwinGetNextWindow(0); h; h = gwinGetNextWindow(h)) {
 
@@ -151,6 +234,14 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 		if (gh && (gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_SYSENABLED)) == (GWIN_FLG_WIDGET|GWIN_FLG_SYSENABLED)) {
 			if ((pme->buttons & GMETA_MOUSE_DOWN)) {
 				gh->flags |= GWIN_FLG_MOUSECAPTURE;
+				#if GWIN_NEED_HITGRID
+					if (pcapture) {
+						// Only one capture per display. Drop any hidden one left behind.
+						if (*pcapture && *pcapture != gh)
+							(*pcapture)->flags &= ~GWIN_FLG_MOUSECAPTURE;
+						*pcapture = gh;
+					}
+				#endif
 
 				#if (GFX_USE_GINPUT && GINPUT_NEED_KEYBOARD) || GWIN_NEED_KEYBOARD
 					// We should try and capture the focus on this window.
@@ -182,23 +273,21 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 
 	#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
 	case GEVENT_TOGGLE:
-		// Cycle through all windows
-		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+		// Cycle through the widget roles attached to this toggle
+		for(pu = InstanceFirst(ToggleUsers, pte->instance); pu; pu = pnext) {
+			pnext = pu->next;
+			gh = pu->gh;
 
-			// check if it a widget that is enabled and visible
-			if ((gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE)) != (GWIN_FLG_WIDGET|GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE))
+			// check if it is the right instance and the widget is enabled and visible
+			if (pu->instance != pte->instance || (gh->flags & (GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE)) != (GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE))
 				continue;
 
-			for(role = 0; role < wvmt->toggleroles; role++) {
-				if (wvmt->ToggleGet(gw, role) == pte->instance) {
-					if (pte->on) {
-						if (wvmt->ToggleOn)
-							wvmt->ToggleOn(gw, role);
-					} else {
-						if (wvmt->ToggleOff)
-							wvmt->ToggleOff(gw, role);
-					}
-				}
+			if (pte->on) {
+				if (wvmt->ToggleOn)
+					wvmt->ToggleOn(gw, pu->role);
+			} else {
+				if (wvmt->ToggleOff)
+					wvmt->ToggleOff(gw, pu->role);
 			}
 		}
 		break;
@@ -206,19 +295,17 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 
 	#if GFX_USE_GINPUT && GINPUT_NEED_DIAL
 	case GEVENT_DIAL:
-		// Cycle through all windows
-		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+		// Cycle through the widget roles attached to this dial
+		for(pu = InstanceFirst(DialUsers, pde->instance); pu; pu = pnext) {
+			pnext = pu->next;
+			gh = pu->gh;
 
-			// check if it a widget that is enabled and visible
-			if ((gh->flags & (GWIN_FLG_WIDGET|GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE)) != (GWIN_FLG_WIDGET|GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE))
+			// check if it is the right instance and the widget is enabled and visible
+			if (pu->instance != pde->instance || (gh->flags & (GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE)) != (GWIN_FLG_SYSENABLED|GWIN_FLG_SYSVISIBLE))
 				continue;
 
-			for(role = 0; role < wvmt->dialroles; role++) {
-				if (wvmt->DialGet(gw, role) == pte->instance) {
-					if (wvmt->DialMove)
-						wvmt->DialMove(gw, role, pde->value, pde->maxvalue);
-				}
-			}
+			if (wvmt->DialMove)
+				wvmt->DialMove(gw, pu->role, pde->value, pde->maxvalue);
 		}
 		break;
 	#endif
@@ -307,6 +394,9 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 				_widgetInFocus = gh;
 
 				// This new window still needs to be marked for redraw (but don't actually do it yet).
+				#if GWIN_NEED_WINDOWMANAGER && GWIN_REDRAW_DAMAGE
+					gh->dmgcx = 0;
+				#endif
 				gh->flags |= GWIN_FLG_NEEDREDRAW;
 				// RedrawPending |= DOREDRAW_VISIBLES;			- FIX LATER
 				return;
@@ -326,7 +416,7 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 
 		// Use the very simplest possible focus rectangle for now
 		for (i = 0; i < GWIN_FOCUS_HIGHLIGHT_WIDTH; i++) {
-			gdispGDrawBox(gx->g.display, gx->g.x+x+i, gx->g.y+y+i, cx-2*i, cy-2*i, gx->pstyle->focus);
+			gdispGDrawBox(gwinGetDrawDisplay(&gx->g), gx->g.x+x+i, gx->g.y+y+i, cx-2*i, cy-2*i, gx->pstyle->focus);
 		}
 	}
 
@@ -339,45 +429,140 @@ static void gwidgetEvent(void *param, GEvent *pe) {
 				return;
 
 			for (i = 0; i < GWIN_FOCUS_HIGHLIGHT_WIDTH; i++) {
-				gdispGDrawCircle(gx->g.display, gx->g.x + radius, gx->g.y + radius, radius + i, gx->pstyle->focus);
+				gdispGDrawCircle(gwinGetDrawDisplay(&gx->g), gx->g.x + radius, gx->g.y + radius, radius + i, gx->pstyle->focus);
 			}
 		}
 	#endif
 #endif
 
-#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
-	static GHandle FindToggleUser(gU16 instance) {
-		GHandle			gh;
-		gU16		role;
+#if GWIN_WIDGET_CACHE
+	/**
+	 * A rendering of a widget in one state.
+	 * The list is kept most recently used first so the least recently used renderings are freed first.
+	 */
+	typedef struct WidgetCache {
+		struct WidgetCache *	next;
+		GHandle					gh;
+		GDisplay *				pixmap;
+		gCoord					width, height;		// The widget size it was rendered at
+		gU32					state;				// The widget state it was rendered in
+	} WidgetCache;
+
+	static gMutex			cacheMutex;
+	static WidgetCache *	cacheList;
+	static gU32				cacheUsed;				// The pixmap bytes used by the cache
+
+	// The flags that make up the state of a widget - the control flags hold things like pressed and checked
+	#define CACHE_STATE_FLAGS	(0x000000FF|GWIN_FLG_SYSENABLED|GWIN_FLG_MINIMIZED|GWIN_FLG_MAXIMIZED)
+	#define CACHE_FOCUSED		GWIN_FLG_VISIBLE	// Not a state flag so its bit can be borrowed for the focus
+
+	static gU32 CacheState(GHandle gh) {
+		gU32	state;
+
+		state = gh->flags & CACHE_STATE_FLAGS;
+		#if (GFX_USE_GINPUT && GINPUT_NEED_KEYBOARD) || GWIN_NEED_KEYBOARD
+			if (gh == _widgetInFocus)
+				state |= CACHE_FOCUSED;
+		#endif
+		return state;
+	}
 
-		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
-			if (!(gh->flags & GWIN_FLG_WIDGET))		// check if it a widget
-				continue;
+	static void CacheFree(WidgetCache **ppc) {
+		WidgetCache *	pc;
 
-			for(role = 0; role < wvmt->toggleroles; role++) {
-				if (wvmt->ToggleGet(gw, role) == instance)
-					return gh;
-			}
-		}
-		return 0;
+		pc = *ppc;
+		*ppc = pc->next;
+		cacheUsed -= (gU32)pc->width * pc->height * sizeof(gColor);
+		gdispPixmapDelete(pc->pixmap);
+		gfxFree(pc);
 	}
-#endif
 
-#if GFX_USE_GINPUT && GINPUT_NEED_DIAL
-	static GHandle FindDialUser(gU16 instance) {
-		GHandle			gh;
-		gU16		role;
+	// Draw a widget by copying its rendering for the current state, rendering it first if needed
+	static gBool CacheDraw(GHandle gh) {
+		WidgetCache **	ppc;
+		WidgetCache *	pc;
+		GDisplay *		g;
+		gU32			state, size;
 
-		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
-			if (!(gh->flags & GWIN_FLG_WIDGET))		// check if it a widget
-				continue;
+		size = (gU32)gh->width * gh->height * sizeof(gColor);
+		if (!size || size > GWIN_WIDGET_CACHE_SIZE)
+			return gFalse;
+		state = CacheState(gh);
+
+		gfxMutexEnter(&cacheMutex);
+
+		// Find it - renderings at an old size are no longer any use
+		for(ppc = &cacheList; (pc = *ppc); ) {
+			if (pc->gh == gh) {
+				if (pc->width != gh->width || pc->height != gh->height) {
+					CacheFree(ppc);
+					continue;
+				}
+				if (pc->state == state)
+					break;
+			}
+			ppc = &pc->next;
+		}
 
-			for(role = 0; role < wvmt->dialroles; role++) {
-				if (wvmt->DialGet(gw, role) == instance)
-					return gh;
+		if (pc)
+			*ppc = pc->next;
+		else {
+			// Free the least recently used renderings until it fits
+			while (cacheUsed + size > GWIN_WIDGET_CACHE_SIZE) {
+				for(ppc = &cacheList; (*ppc)->next; ppc = &(*ppc)->next);
+				CacheFree(ppc);
 			}
+			if (!(pc = gfxAlloc(sizeof(WidgetCache)))) {
+				gfxMutexExit(&cacheMutex);
+				return gFalse;
+			}
+			if (!(pc->pixmap = gdispPixmapCreate(gh->width, gh->height))) {
+				gfxFree(pc);
+				gfxMutexExit(&cacheMutex);
+				return gFalse;
+			}
+			pc->gh = gh;
+			pc->width = gh->width;
+			pc->height = gh->height;
+			pc->state = state;
+			cacheUsed += size;
+
+			// Render it with its normal coordinates. Anything it leaves unpainted is the style background.
+			gdispPixmapSetOrigin(pc->pixmap, gh->x, gh->y);
+			gdispGFillArea(pc->pixmap, gh->x, gh->y, gh->width, gh->height, gw->pstyle->background);
+			g = gh->drawdisplay;
+			gh->drawdisplay = pc->pixmap;
+			gw->fnDraw(gw, gw->fnParam);
+			gh->drawdisplay = g;
 		}
-		return 0;
+		pc->next = cacheList;
+		cacheList = pc;
+
+		gdispGBlitArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, 0, 0, gh->width, gdispPixmapGetBits(pc->pixmap));
+		gfxMutexExit(&cacheMutex);
+		return gTrue;
+	}
+
+	void _gwidgetCacheFlush(GHandle gh) {
+		WidgetCache **	ppc;
+
+		gfxMutexEnter(&cacheMutex);
+		for(ppc = &cacheList; *ppc; ) {
+			if ((*ppc)->gh == gh)
+				CacheFree(ppc);
+			else
+				ppc = &(*ppc)->next;
+		}
+		gfxMutexExit(&cacheMutex);
+	}
+
+	void gwinSetCached(GHandle gh, gBool cached) {
+		if (!(gh->flags & GWIN_FLG_WIDGET))
+			return;
+
+		gw->cached = cached;
+		if (!cached)
+			_gwidgetCacheFlush(gh);
 	}
 #endif
 
@@ -391,11 +576,18 @@ void _gwidgetInit(void)
 	#if GINPUT_NEED_KEYBOARD || GWIN_NEED_KEYBOARD
 		geventAttachSource(&gl, ginputGetKeyboard(GKEYBOARD_ALL_INSTANCES), GLISTEN_KEYUP);
 	#endif
+	#if GWIN_WIDGET_CACHE
+		gfxMutexInit(&cacheMutex);
+	#endif
 }
 
 void _gwidgetDeinit(void)
 {
-	/* ToDo */
+	#if GWIN_WIDGET_CACHE
+		while (cacheList)
+			CacheFree(&cacheList);
+		gfxMutexDestroy(&cacheMutex);
+	#endif
 }
 
 GHandle _gwidgetCreate(GDisplay *g, GWidgetObject *pgw, const GWidgetInit *pInit, const gwidgetVMT *vmt) {
@@ -414,6 +606,9 @@ GHandle _gwidgetCreate(GDisplay *g, GWidgetObject *pgw, const GWidgetInit *pInit
 	#if GWIN_WIDGET_TAGS
 			pgw->tag = pInit->tag;
 	#endif
+	#if GWIN_WIDGET_CACHE
+		pgw->cached = gFalse;
+	#endif
 
 	return 	&pgw->g;
 }
@@ -432,6 +627,7 @@ void _gwidgetDestroy(GHandle gh) {
 		gh->flags &= ~GWIN_FLG_ALLOCTXT;
 		gfxFree((void *)gw->text);
 	}
+	_gwidgetCacheFlush(gh);
 
 	#if GFX_USE_GINPUT && GINPUT_NEED_TOGGLE
 		// Detach any toggles from this object
@@ -439,7 +635,8 @@ void _gwidgetDestroy(GHandle gh) {
 			instance = wvmt->ToggleGet(gw, role);
 			if (instance != GWIDGET_NO_INSTANCE) {
 				wvmt->ToggleAssign(gw, role, GWIDGET_NO_INSTANCE);
-				if (!FindToggleUser(instance))
+				InstanceUnbind(ToggleUsers, gh, role, instance);
+				if (!InstanceUsed(ToggleUsers, instance))
 					geventDetachSource(&gl, ginputGetToggle(instance));
 			}
 		}
@@ -451,12 +648,23 @@ void _gwidgetDestroy(GHandle gh) {
 			instance = wvmt->DialGet(gw, role);
 			if (instance != GWIDGET_NO_INSTANCE) {
 				wvmt->DialAssign(gw, role, GWIDGET_NO_INSTANCE);
-				if (!FindDialUser(instance))
+				InstanceUnbind(DialUsers, gh, role, instance);
+				if (!InstanceUsed(DialUsers, instance))
 					geventDetachSource(&gl, ginputGetDial(instance));
 			}
 		}
 	#endif
 
+	#if GWIN_NEED_HITGRID && GFX_USE_GINPUT && GINPUT_NEED_MOUSE
+		// Release any mouse capture
+		if ((gh->flags & GWIN_FLG_MOUSECAPTURE)) {
+			GHandle	*	pcapture;
+
+			if ((pcapture = _gwinHitCapture(gh->display)) && *pcapture == gh)
+				*pcapture = 0;
+		}
+	#endif
+
 	// Remove any listeners on this object.
 	geventDetachSourceListeners((GSourceHandle)gh);
 }
@@ -465,6 +673,11 @@ void _gwidgetRedraw(GHandle gh) {
 	if (!(gh->flags & GWIN_FLG_SYSVISIBLE))
 		return;
 
+	#if GWIN_WIDGET_CACHE
+		// A flashing widget changes without its state changing
+		if (gw->cached && !(gh->flags & GWIN_FLG_FLASHING) && CacheDraw(gh))
+			return;
+	#endif
 	gw->fnDraw(gw, gw->fnParam);
 }
 
@@ -522,9 +735,20 @@ const GWidgetStyle *gwinGetDefaultStyle(void) {
 }
 
 void gwinSetText(GHandle gh, const char *text, gBool useAlloc) {
+	#if GWIN_NEED_LABEL && GWIN_REDRAW_DAMAGE
+		gCoord	x0, cx0, x1, cx1;
+		gBool	label;
+	#endif
+
 	if (!(gh->flags & GWIN_FLG_WIDGET))
 		return;
 
+	#if GWIN_NEED_LABEL && GWIN_REDRAW_DAMAGE
+		// Where a label draws its old text
+		label = _gwinLabelTextArea(gh, &x0, &cx0);
+	#endif
+	_gwidgetCacheFlush(gh);
+
 	// Dispose of the old string
 	if ((gh->flags & GWIN_FLG_ALLOCTXT)) {
 		gh->flags &= ~GWIN_FLG_ALLOCTXT;
@@ -547,6 +771,20 @@ void gwinSetText(GHandle gh, const char *text, gBool useAlloc) {
 		gw->text = (const char *)str;
 	} else
 		gw->text = text;
+
+	#if GWIN_NEED_LABEL && GWIN_REDRAW_DAMAGE
+		// A label only needs its old and new text redrawn
+		if (label && _gwinLabelTextArea(gh, &x1, &cx1)) {
+			if (x1 + cx1 < x0 + cx0)
+				cx1 = x0 + cx0 - x1;
+			if (x1 > x0) {
+				cx1 += x1 - x0;
+				x1 = x0;
+			}
+			_gwinUpdateArea(gh, x1, 0, cx1, gh->height);
+			return;
+		}
+	#endif
 	_gwinUpdate(gh);
 }
 
@@ -560,6 +798,7 @@ void gwinSetText(GHandle gh, const char *text, gBool useAlloc) {
 		
 		if (!(gh->flags & GWIN_FLG_WIDGET))
 			return;
+		_gwidgetCacheFlush(gh);
 
 		// Dispose of the old string
 		if ((gh->flags & GWIN_FLG_ALLOCTXT)) {
@@ -610,6 +849,7 @@ void gwinSetStyle(GHandle gh, const GWidgetStyle *pstyle) {
 	gw->pstyle = pstyle ? pstyle : defaultStyle;
 	gh->bgcolor = gw->pstyle->background;
 	gh->color = gw->pstyle->enabled.text;
+	_gwidgetCacheFlush(gh);
 
 	_gwinUpdate(gh);
 }
@@ -627,6 +867,7 @@ void gwinSetCustomDraw(GHandle gh, CustomWidgetDrawFunction fn, void *param) {
 
 	gw->fnDraw = fn ? fn : wvmt->DefaultDraw;
 	gw->fnParam = param;
+	_gwidgetCacheFlush(gh);
 	_gwinUpdate(gh);
 }
 
@@ -664,10 +905,15 @@ gBool gwinAttachListener(GListener *pl) {
 		if (instance == oi)
 			return gTrue;
 
+		// Record the new user
+		if (!InstanceBind(ToggleUsers, gh, role, instance))
+			return gFalse;
+
 		// Remove the old instance
 		if (oi != GWIDGET_NO_INSTANCE) {
 			wvmt->ToggleAssign(gw, role, GWIDGET_NO_INSTANCE);
-			if (!FindToggleUser(oi))
+			InstanceUnbind(ToggleUsers, gh, role, oi);
+			if (!InstanceUsed(ToggleUsers, oi))
 				geventDetachSource(&gl, ginputGetToggle(oi));
 		}
 
@@ -692,7 +938,8 @@ gBool gwinAttachListener(GListener *pl) {
 		// Remove the instance
 		if (oi != GWIDGET_NO_INSTANCE) {
 			((gwidgetVMT *)gh->vmt)->ToggleAssign(gw, role, GWIDGET_NO_INSTANCE);
-			if (!FindToggleUser(oi))
+			InstanceUnbind(ToggleUsers, gh, role, oi);
+			if (!InstanceUsed(ToggleUsers, oi))
 				geventDetachSource(&gl, ginputGetToggle(oi));
 		}
 		return gTrue;
@@ -721,10 +968,15 @@ gBool gwinAttachListener(GListener *pl) {
 		if (instance == oi)
 			return gTrue;
 
+		// Record the new user
+		if (!InstanceBind(DialUsers, gh, role, instance))
+			return gFalse;
+
 		// Remove the old instance
 		if (oi != GWIDGET_NO_INSTANCE) {
 			wvmt->DialAssign(gw, role, GWIDGET_NO_INSTANCE);
-			if (!FindDialUser(oi))
+			InstanceUnbind(DialUsers, gh, role, oi);
+			if (!InstanceUsed(DialUsers, oi))
 				geventDetachSource(&gl, ginputGetDial(oi));
 		}
 
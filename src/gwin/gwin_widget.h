@@ -124,6 +124,9 @@ typedef struct GWidgetObject {
 	#if GWIN_WIDGET_TAGS || defined(__DOXYGEN__)
 		WidgetTag				tag;				/**< The widget tag */
 	#endif
+	#if GWIN_WIDGET_CACHE || defined(__DOXYGEN__)
+		gBool					cached;				/**< The widget is drawn from cached renderings */
+	#endif
 } GWidgetObject;
 /** @} */
 
@@ -322,6 +325,31 @@ const GWidgetStyle *gwinGetStyle(GHandle gh);
  */
 void gwinSetCustomDraw(GHandle gh, CustomWidgetDrawFunction fn, void *param);
 
+#if GWIN_WIDGET_CACHE || defined(__DOXYGEN__)
+	/**
+	 * @brief   Draw a widget from a cached rendering of each of its states
+	 *
+	 * @param[in] gh		The widget handle
+	 * @param[in] cached	gTrue to use the cache, gFalse to draw the widget every time
+	 *
+	 * @note				The widget is rendered into a pixmap the first time it is drawn in each state
+	 * 						(normal, pressed, disabled, focused etc). Later redraws in that state just copy
+	 * 						the pixmap to the display. This suits widgets with expensive chrome such as
+	 * 						buttons, checkboxes, radio buttons, frames and tabsets.
+	 * @note				The renderings are thrown away when the widget text, style, font, draw routine
+	 * 						or size changes.
+	 * @note				The draw routine must only depend on those things and the state flags. Don't use this
+	 * 						for widgets like sliders and lists that draw things not held in their flags. Anything
+	 * 						the draw routine leaves unpainted is filled with the style background color so
+	 * 						transparent renderings don't show what is underneath.
+	 * @note				Non-widgets will ignore this call.
+	 * @pre					GWIN_WIDGET_CACHE must be GFXON
+	 *
+	 * @api
+	 */
+	void gwinSetCached(GHandle gh, gBool cached);
+#endif
+
 /**
  * @brief	Attach a Listener to listen for widget events
  * @return	gTrue on success
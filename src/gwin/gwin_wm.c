@@ -83,6 +83,29 @@
 		gh->flags &= ~(GWIN_FLG_NEEDREDRAW|GWIN_FLG_BGREDRAW);
 	}
 
+	#if GWIN_REDRAW_DAMAGE
+		void _gwinUpdateArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+			if (!(gh->flags & GWIN_FLG_SYSVISIBLE) || !gh->vmt->Redraw) {
+				_gwinUpdate(gh);
+				return;
+			}
+
+			// Keep it within the window
+			if (x < 0) { cx += x; x = 0; }
+			if (y < 0) { cy += y; y = 0; }
+			if (cx > gh->width - x) cx = gh->width - x;
+			if (cy > gh->height - y) cy = gh->height - y;
+			if (cx <= 0 || cy <= 0)
+				return;
+
+			// Redraw just that area
+			gfxMutexEnter(&gmutex);
+			gdispGSetClip(gh->display, gh->x + x, gh->y + y, cx, cy);
+			gh->vmt->Redraw(gh);
+			exitLock(gh);
+		}
+	#endif
+
 	gBool _gwinDrawStart(GHandle gh) {
 		if (!(gh->flags & GWIN_FLG_SYSVISIBLE))
 			return gFalse;
@@ -171,11 +194,308 @@ static gfxQueueASync		_GWINList;
 	static GTimer			RedrawTimer;
 	static void				RedrawTimerFn(void *param);
 #endif
+#if GWIN_REDRAW_FRAMES
+	static gTicks				FrameStart;			// When the last frame started
+	static gBool				FrameRunning;
+	static GWindowRedrawStats	FrameStats;
+
+	// The window can be put off to a later frame
+	#define GWIN_FLG_DEFERRABLE		(GWIN_FIRST_WM_FLAG << 2)
+#endif
 static volatile gU8		RedrawPending;
 	#define DOREDRAW_INVISIBLES		0x01
 	#define DOREDRAW_VISIBLES		0x02
 	#define DOREDRAW_FLASHRUNNING	0x04
 
+#if GWIN_REDRAW_OCCLUSION
+	/**
+	 * Clip drawing on the display to the part of an area that is not covered by a window above gh.
+	 * The window list is in z-order so every window after gh is above it. If gh is NULL every
+	 * window on the display is removed from the area.
+	 * Containers nested within gh are not removed as they may rely on gh to draw their background.
+	 * If nested is gTrue no window nested within gh is removed.
+	 * Returns gFalse if the display can't clip to a region.
+	 */
+	static gBool wmClipVisible(GDisplay *g, GHandle gh, gBool nested, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gdispRegion		rgn;
+		GHandle			gx;
+		#if GWIN_NEED_CONTAINERS
+			GHandle		gp;
+		#endif
+
+		gdispRegionInit(&rgn, x, y, cx, cy);
+		for(gx = gwinGetNextWindow(gh); gx && rgn.cnt; gx = gwinGetNextWindow(gx)) {
+			if (!(gx->flags & GWIN_FLG_SYSVISIBLE) || gx->display != g)
+				continue;
+
+			#if GWIN_NEED_CONTAINERS
+				if (gh && (nested || (gx->flags & GWIN_FLG_CONTAINER))) {
+					for(gp = gx->parent; gp && gp != gh; gp = gp->parent);
+					if (gp)
+						continue;
+				}
+			#endif
+
+			// If the region gets too complex this window will be drawn over so it must be redrawn afterwards
+			if (!gdispRegionSubtract(&rgn, gx->x, gx->y, gx->width, gx->height)) {
+				#if GWIN_REDRAW_DAMAGE
+					gx->dmgcx = 0;
+				#endif
+				gx->flags |= GWIN_FLG_NEEDREDRAW;
+				RedrawPending |= DOREDRAW_VISIBLES;
+			}
+		}
+		return gdispGSetClipRegion(g, &rgn);
+	}
+#endif
+
+#if GWIN_NEED_HITGRID
+	#define HITCELL			(1<<GWIN_HITGRID_SHIFT)
+
+	/**
+	 * The hit grid for a display.
+	 * Each cell lists the windows that overlap it in z-order. The window handles for all cells are
+	 * stored in one array with start[] giving the first entry for each cell (start[cells] is the total).
+	 */
+	typedef struct HitGrid {
+		struct HitGrid *	next;
+		GDisplay *			g;
+		GHandle				capture;		// The window that has captured the mouse on this display
+		GHandle *			list;			// The window handles followed by the cell start indexes
+		unsigned *			start;
+		gCoord				width, height;	// The display size the grid was built for
+		gU16				cols, rows;
+		gU16				gen;
+	} HitGrid;
+
+	static HitGrid *			HitGrids;
+	static gU16					HitGen;
+
+	void _gwinHitInvalidate(void) {
+		HitGen++;
+	}
+
+	static HitGrid *HitFind(GDisplay *g) {
+		HitGrid *	hg;
+		GHandle		gh;
+
+		for(hg = HitGrids; hg; hg = hg->next) {
+			if (hg->g == g)
+				return hg;
+		}
+		if (!(hg = gfxAlloc(sizeof(HitGrid))))
+			return 0;
+		hg->g = g;
+		hg->capture = 0;
+		hg->list = 0;
+		hg->start = 0;
+
+		// Pick up any capture that happened before we were tracking this display
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if (gh->display == g && (gh->flags & GWIN_FLG_MOUSECAPTURE))
+				hg->capture = gh;
+		}
+
+		hg->next = HitGrids;
+		HitGrids = hg;
+		return hg;
+	}
+
+	// Get the cell range a window covers. Returns gFalse if it is not on the display.
+	static gBool HitCells(HitGrid *hg, GHandle gh, gCoord *cx0, gCoord *cy0, gCoord *cx1, gCoord *cy1) {
+		gCoord	x0, y0, x1, y1;
+
+		x0 = gh->x; y0 = gh->y;
+		x1 = x0 + gh->width; y1 = y0 + gh->height;
+		if (x0 < 0) x0 = 0;
+		if (y0 < 0) y0 = 0;
+		if (x1 > hg->width) x1 = hg->width;
+		if (y1 > hg->height) y1 = hg->height;
+		if (x0 >= x1 || y0 >= y1)
+			return gFalse;
+		*cx0 = x0 >> GWIN_HITGRID_SHIFT;
+		*cy0 = y0 >> GWIN_HITGRID_SHIFT;
+		*cx1 = (x1-1) >> GWIN_HITGRID_SHIFT;
+		*cy1 = (y1-1) >> GWIN_HITGRID_SHIFT;
+		return gTrue;
+	}
+
+	static void HitBuild(HitGrid *hg) {
+		GHandle		gh;
+		unsigned	cells, refs, c;
+		gCoord		cx0, cy0, cx1, cy1, cx, cy;
+
+		if (hg->list) {
+			gfxFree(hg->list);
+			hg->list = 0;
+		}
+		hg->gen = HitGen;
+		hg->width = gdispGGetWidth(hg->g);
+		hg->height = gdispGGetHeight(hg->g);
+		hg->cols = (hg->width + HITCELL - 1) >> GWIN_HITGRID_SHIFT;
+		hg->rows = (hg->height + HITCELL - 1) >> GWIN_HITGRID_SHIFT;
+		cells = (unsigned)hg->cols * hg->rows;
+
+		// Count the cell entries we need
+		refs = 0;
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if (gh->display == hg->g && HitCells(hg, gh, &cx0, &cy0, &cx1, &cy1))
+				refs += (unsigned)(cx1-cx0+1) * (cy1-cy0+1);
+		}
+		if (!(hg->list = gfxAlloc(refs * sizeof(GHandle) + (cells+1) * sizeof(unsigned))))
+			return;
+		hg->start = (unsigned *)(hg->list + refs);
+
+		// Count the entries in each cell (shifted up by one) and turn them into start indexes
+		for(c = 0; c <= cells; c++)
+			hg->start[c] = 0;
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if (gh->display != hg->g || !HitCells(hg, gh, &cx0, &cy0, &cx1, &cy1))
+				continue;
+			for(cy = cy0; cy <= cy1; cy++) {
+				for(cx = cx0; cx <= cx1; cx++)
+					hg->start[cy * hg->cols + cx + 1]++;
+			}
+		}
+		for(c = 1; c <= cells; c++)
+			hg->start[c] += hg->start[c-1];
+
+		// Fill the cells in z-order. This uses start[] as the insert position so shift it back afterwards.
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if (gh->display != hg->g || !HitCells(hg, gh, &cx0, &cy0, &cx1, &cy1))
+				continue;
+			for(cy = cy0; cy <= cy1; cy++) {
+				for(cx = cx0; cx <= cx1; cx++)
+					hg->list[hg->start[cy * hg->cols + cx]++] = gh;
+			}
+		}
+		for(c = cells; c > 0; c--)
+			hg->start[c] = hg->start[c-1];
+		hg->start[0] = 0;
+	}
+
+	GHandle _gwinHitTest(GDisplay *g, gCoord x, gCoord y) {
+		HitGrid *	hg;
+		GHandle		gh, h;
+		unsigned	i, c;
+
+		// Off-screen drawing changes a window's display so wait until nobody is drawing
+		#if GWIN_NEED_OFFSCREEN
+			gfxSemWait(&gwinsem, gDelayForever);
+		#endif
+
+		if ((hg = HitFind(g)) && (hg->gen != HitGen || !hg->list || hg->width != gdispGGetWidth(g) || hg->height != gdispGGetHeight(g)))
+			HitBuild(hg);
+
+		// Off the display (or out of memory) we have to look at every window
+		if (!hg || !hg->list || x < 0 || y < 0 || x >= hg->width || y >= hg->height) {
+			for(gh = 0, h = gwinGetNextWindow(0); h; h = gwinGetNextWindow(h)) {
+				if (h->display == g && (h->flags & GWIN_FLG_SYSVISIBLE)
+						&& x >= h->x && x < h->x + h->width && y >= h->y && y < h->y + h->height)
+					gh = h;
+			}
+		} else {
+			// The cell is in z-order so the first match from the end is the top most
+			c = (y >> GWIN_HITGRID_SHIFT) * hg->cols + (x >> GWIN_HITGRID_SHIFT);
+			for(gh = 0, i = hg->start[c+1]; i > hg->start[c]; ) {
+				h = hg->list[--i];
+				if ((h->flags & GWIN_FLG_SYSVISIBLE)
+						&& x >= h->x && x < h->x + h->width && y >= h->y && y < h->y + h->height) {
+					gh = h;
+					break;
+				}
+			}
+		}
+
+		#if GWIN_NEED_OFFSCREEN
+			gfxSemSignal(&gwinsem);
+		#endif
+		return gh;
+	}
+
+	GHandle *_gwinHitCapture(GDisplay *g) {
+		HitGrid *	hg;
+
+		return (hg = HitFind(g)) ? &hg->capture : 0;
+	}
+#endif
+
+#if GWIN_NEED_OFFSCREEN
+	// The window is an off-screen container
+	#define GWIN_FLG_OFFSCREEN		(GWIN_FIRST_WM_FLAG << 1)
+
+	/**
+	 * The pixmap for an off-screen container.
+	 * The pixmap origin is the container position so windows draw into it with their normal coordinates.
+	 */
+	typedef struct Offscreen {
+		struct Offscreen *	next;
+		GHandle				gh;					// The container
+		GDisplay *			display;			// The real display
+		GDisplay *			pixmap;
+		gCoord				x, y, width, height;	// The container area the pixmap is set up for
+		gBool				valid;				// The pixmap holds a complete image of the container
+	} Offscreen;
+
+	static Offscreen *			OffscreenList;
+
+	static void wmOffscreenValidate(Offscreen *po);
+	static void wmOffscreenAbove(Offscreen *po, GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy);
+
+	/**
+	 * Get the pixmap a window is drawn into - that of its outer most off-screen container.
+	 * Returns NULL if there isn't one or the container can't be seen.
+	 */
+	static Offscreen *wmOffscreen(GHandle gh) {
+		Offscreen *	po;
+		GHandle		gx;
+
+		for(gx = 0; gh; gh = gh->parent) {
+			if ((gh->flags & GWIN_FLG_OFFSCREEN))
+				gx = gh;
+		}
+		if (!gx)
+			return 0;
+		for(po = OffscreenList; po->gh != gx; po = po->next);
+
+		// Nothing is drawn while the container is hidden so the pixmap is out of date
+		if (!(gx->flags & GWIN_FLG_SYSVISIBLE)) {
+			po->valid = gFalse;
+			return 0;
+		}
+
+		// Keep the pixmap the same size and position as the container
+		if (!po->pixmap || po->width != gx->width || po->height != gx->height) {
+			if (po->pixmap)
+				gdispPixmapDelete(po->pixmap);
+			po->valid = gFalse;
+			po->width = gx->width;
+			po->height = gx->height;
+			po->x = po->y = 0;
+			if (!(po->pixmap = gdispPixmapCreate(po->width, po->height)))
+				return 0;
+		}
+		if (po->x != gx->x || po->y != gx->y) {
+			po->x = gx->x;
+			po->y = gx->y;
+			po->valid = gFalse;
+			gdispPixmapSetOrigin(po->pixmap, po->x, po->y);
+		}
+		return po;
+	}
+
+	// Copy part of the pixmap to the real display
+	static void wmOffscreenBlit(Offscreen *po, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		if (x < po->x) { cx -= po->x - x; x = po->x; }
+		if (y < po->y) { cy -= po->y - y; y = po->y; }
+		if (cx > po->x + po->width - x)		cx = po->x + po->width - x;
+		if (cy > po->y + po->height - y)	cy = po->y + po->height - y;
+		if (cx <= 0 || cy <= 0)
+			return;
+		gdispGBlitArea(po->display, x, y, cx, cy, x - po->x, y - po->y, po->width, gdispPixmapGetBits(po->pixmap));
+	}
+#endif
+
 
 /*-----------------------------------------------
  * Window Routines
@@ -188,7 +508,9 @@ void _gwmInit(void)
 	#if GWIN_NEED_FLASHING
 		gtimerInit(&FlashTimer);
 	#endif
-	#if !GWIN_REDRAW_IMMEDIATE
+	#if GWIN_REDRAW_FRAMES
+		gtimerInit(&RedrawTimer);
+	#elif !GWIN_REDRAW_IMMEDIATE
 		gtimerInit(&RedrawTimer);
 		gtimerStart(&RedrawTimer, RedrawTimerFn, 0, gTrue, gDelayForever);
 	#endif
@@ -207,12 +529,37 @@ void _gwmDeinit(void)
 	#if !GWIN_REDRAW_IMMEDIATE
 		gtimerDeinit(&RedrawTimer);
 	#endif
+	#if GWIN_NEED_HITGRID
+		{
+			HitGrid *	hg;
+
+			while((hg = HitGrids)) {
+				HitGrids = hg->next;
+				if (hg->list)
+					gfxFree(hg->list);
+				gfxFree(hg);
+			}
+		}
+	#endif
 	gfxQueueASyncDeinit(&_GWINList);
 	gfxSemDestroy(&gwinsem);
 }
 
 #if GWIN_REDRAW_IMMEDIATE
 	#define TriggerRedraw(void) _gwinFlushRedraws(REDRAW_NOWAIT);
+#elif GWIN_REDRAW_FRAMES
+	#define TriggerRedraw()		FrameSchedule()
+
+	// Start the timer for the next frame if it isn't already going
+	static void FrameSchedule(void) {
+		gTicks	since, period;
+
+		if (FrameRunning || gtimerIsActive(&RedrawTimer))
+			return;
+		since = gfxSystemTicks() - FrameStart;
+		period = gfxMillisecondsToTicks(GWIN_REDRAW_FRAME_PERIOD);
+		gtimerStart(&RedrawTimer, RedrawTimerFn, 0, gFalse, since >= period ? gDelayNone : (gDelay)(((period - since) * 1000) / gfxMillisecondsToTicks(1000)));
+	}
 #else
 	#define TriggerRedraw()		gtimerJab(&RedrawTimer);
 
@@ -306,12 +653,124 @@ void _gwinFlushRedraws(GRedrawMethod how) {
 		gfxSemSignal(&gwinsem);
 }
 
+#if GWIN_REDRAW_FRAMES
+	// Draw a frame
+	static void RedrawTimerFn(void *param) {
+		GHandle		gh;
+		GDisplay *	g;
+		gTicks		t;
+		gBool		didDeferrable;
+		#if !GWIN_REDRAW_OCCLUSION
+			gCoord	x0, y0, x1, y1;		// The area covered by windows that have been put off
+		#endif
+		(void)		param;
+
+		// Someone is drawing - try again next frame
+		if (!gfxSemWait(&gwinsem, gDelayNone)) {
+			FrameStart = gfxSystemTicks();
+			TriggerRedraw();
+			return;
+		}
+		FrameStart = gfxSystemTicks();
+		FrameRunning = gTrue;
+		RedrawPending &= ~(DOREDRAW_INVISIBLES|DOREDRAW_VISIBLES);
+
+		// Do loss of visibility first. It is never put off as the area under it must be redrawn before anything goes on top.
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if ((gh->flags & (GWIN_FLG_NEEDREDRAW|GWIN_FLG_SYSVISIBLE)) != GWIN_FLG_NEEDREDRAW)
+				continue;
+			#if GDISP_NEED_CLIP
+				gdispGSetClip(gh->display, gh->x, gh->y, gh->width, gh->height);
+				_GWINwm->vmt->Redraw(gh);
+				gdispGUnsetClip(gh->display);
+			#else
+				_GWINwm->vmt->Redraw(gh);
+			#endif
+			FrameStats.windows++;
+		}
+
+		// Now the visible windows in z-order
+		g = 0;
+		didDeferrable = gFalse;
+		#if !GWIN_REDRAW_OCCLUSION
+			x0 = y0 = x1 = y1 = 0;
+		#endif
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if ((gh->flags & (GWIN_FLG_NEEDREDRAW|GWIN_FLG_SYSVISIBLE)) != (GWIN_FLG_NEEDREDRAW|GWIN_FLG_SYSVISIBLE))
+				continue;
+
+			// Put off deferrable windows once the budget is used up. Anything over a window
+			//	that has been put off must wait too or it would be drawn over next frame.
+			if (((gh->flags & GWIN_FLG_DEFERRABLE) && didDeferrable && gfxSystemTicks() - FrameStart >= gfxMillisecondsToTicks(GWIN_REDRAW_FRAME_BUDGET))
+				#if !GWIN_REDRAW_OCCLUSION
+					|| (gh->x < x1 && gh->y < y1 && gh->x+gh->width > x0 && gh->y+gh->height > y0)
+				#endif
+					) {
+				#if !GWIN_REDRAW_OCCLUSION
+					if (x0 >= x1) {
+						x0 = gh->x; y0 = gh->y;
+						x1 = gh->x+gh->width; y1 = gh->y+gh->height;
+					} else {
+						if (gh->x < x0) x0 = gh->x;
+						if (gh->y < y0) y0 = gh->y;
+						if (gh->x+gh->width > x1) x1 = gh->x+gh->width;
+						if (gh->y+gh->height > y1) y1 = gh->y+gh->height;
+					}
+				#endif
+				FrameStats.deferred++;
+				continue;
+			}
+			if ((gh->flags & GWIN_FLG_DEFERRABLE))
+				didDeferrable = gTrue;
+
+			#if GDISP_NEED_CLIP
+				gdispGSetClip(gh->display, gh->x, gh->y, gh->width, gh->height);
+				_GWINwm->vmt->Redraw(gh);
+				gdispGUnsetClip(gh->display);
+			#else
+				_GWINwm->vmt->Redraw(gh);
+			#endif
+			FrameStats.windows++;
+
+			// Flush each display once when we have finished with it
+			if (g && g != gh->display)
+				gdispGFlush(g);
+			g = gh->display;
+		}
+		if (g)
+			gdispGFlush(g);
+
+		// Statistics
+		t = gfxSystemTicks() - FrameStart;
+		FrameStats.frames++;
+		FrameStats.lastTime = (gU32)((t * 1000) / gfxMillisecondsToTicks(1000));
+		if (FrameStats.lastTime > FrameStats.maxTime)
+			FrameStats.maxTime = FrameStats.lastTime;
+		if (t > gfxMillisecondsToTicks(GWIN_REDRAW_FRAME_BUDGET))
+			FrameStats.overruns++;
+
+		// Anything left over (or asked for while we were drawing) goes in the next frame
+		FrameRunning = gFalse;
+		RedrawPending &= ~(DOREDRAW_INVISIBLES|DOREDRAW_VISIBLES);
+		for(gh = gwinGetNextWindow(0); gh; gh = gwinGetNextWindow(gh)) {
+			if ((gh->flags & GWIN_FLG_NEEDREDRAW))
+				RedrawPending |= (gh->flags & GWIN_FLG_SYSVISIBLE) ? DOREDRAW_VISIBLES : DOREDRAW_INVISIBLES;
+		}
+		if ((RedrawPending & (DOREDRAW_INVISIBLES|DOREDRAW_VISIBLES)))
+			TriggerRedraw();
+		gfxSemSignal(&gwinsem);
+	}
+#endif
+
 void _gwinUpdate(GHandle gh) {
 	// Only redraw if visible
 	if (!(gh->flags & GWIN_FLG_SYSVISIBLE))
 		return;
 
 	// Mark for redraw
+	#if GWIN_REDRAW_DAMAGE
+		gh->dmgcx = 0;
+	#endif
 	gh->flags |= GWIN_FLG_NEEDREDRAW;
 	RedrawPending |= DOREDRAW_VISIBLES;
 
@@ -319,6 +778,51 @@ void _gwinUpdate(GHandle gh) {
 	TriggerRedraw();
 }
 
+#if GWIN_REDRAW_DAMAGE
+	void _gwinUpdateArea(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gCoord	x1, y1;
+
+		// Only redraw if visible
+		if (!(gh->flags & GWIN_FLG_SYSVISIBLE))
+			return;
+
+		// Keep it within the window
+		x1 = x + cx;
+		y1 = y + cy;
+		if (x < 0) x = 0;
+		if (y < 0) y = 0;
+		if (x1 > gh->width) x1 = gh->width;
+		if (y1 > gh->height) y1 = gh->height;
+		if (x >= x1 || y >= y1)
+			return;
+
+		if (!(gh->flags & GWIN_FLG_NEEDREDRAW)) {
+			// Only this area needs redrawing
+			gh->dmgx = x;
+			gh->dmgy = y;
+			gh->dmgcx = x1 - x;
+			gh->dmgcy = y1 - y;
+		} else if (gh->dmgcx) {
+			// Merge it with the area that is already waiting
+			if (x1 < gh->dmgx + gh->dmgcx) x1 = gh->dmgx + gh->dmgcx;
+			if (y1 < gh->dmgy + gh->dmgcy) y1 = gh->dmgy + gh->dmgcy;
+			if (x > gh->dmgx) x = gh->dmgx;
+			if (y > gh->dmgy) y = gh->dmgy;
+			gh->dmgx = x;
+			gh->dmgy = y;
+			gh->dmgcx = x1 - x;
+			gh->dmgcy = y1 - y;
+		}
+
+		// Mark for redraw
+		gh->flags |= GWIN_FLG_NEEDREDRAW;
+		RedrawPending |= DOREDRAW_VISIBLES;
+
+		// Asynchronous redraw
+		TriggerRedraw();
+	}
+#endif
+
 #if GWIN_NEED_CONTAINERS
 	void _gwinRippleVisibility(void) {
 		GHandle		gh;
@@ -385,17 +889,59 @@ gBool _gwinDrawStart(GHandle gh) {
 	#if GDISP_NEED_CLIP
 		gdispGSetClip(gh->display, gh->x, gh->y, gh->width, gh->height);
 	#endif
+	#if GWIN_REDRAW_OCCLUSION
+		wmClipVisible(gh->display, gh, gFalse, gh->x, gh->y, gh->width, gh->height);
+	#endif
+	#if GWIN_NEED_OFFSCREEN
+		{
+			Offscreen *	po;
+
+			// Draw into the pixmap instead. It is copied to the display when drawing ends.
+			if ((po = wmOffscreen(gh))) {
+				wmOffscreenValidate(po);
+				gdispGSetClip(po->pixmap, gh->x, gh->y, gh->width, gh->height);
+				gh->drawdisplay = po->pixmap;
+			}
+		}
+	#endif
 	return gTrue;
 }
 
 void _gwinDrawEnd(GHandle gh) {
+	#if GWIN_NEED_OFFSCREEN
+		{
+			Offscreen *	po;
+
+			// Put the real display back and copy what was drawn to it
+			for(po = OffscreenList; po; po = po->next) {
+				if (gh->drawdisplay == po->pixmap) {
+					gh->drawdisplay = gh->display;
+
+					// Anything above us in the pixmap may have been drawn over
+					wmOffscreenAbove(po, gh, gh->x, gh->y, gh->width, gh->height);
+					wmOffscreenBlit(po, gh->x, gh->y, gh->width, gh->height);
+					break;
+				}
+			}
+		}
+	#endif
+
 	// Ensure there is no clip set
+	#if GWIN_REDRAW_OCCLUSION
+		gdispGSetClipRegion(gh->display, 0);
+	#endif
 	#if GDISP_NEED_CLIP
 		gdispGUnsetClip(gh->display);
 	#endif
 
 	// Look for something to redraw
-	_gwinFlushRedraws(REDRAW_INSESSION);
+	#if GWIN_REDRAW_FRAMES
+		// Leave it for the next frame
+		if ((RedrawPending & (DOREDRAW_INVISIBLES|DOREDRAW_VISIBLES)))
+			TriggerRedraw();
+	#else
+		_gwinFlushRedraws(REDRAW_INSESSION);
+	#endif
 
 	// Release the lock
 	gfxSemSignal(&gwinsem);
@@ -414,6 +960,9 @@ gBool _gwinWMAdd(GHandle gh, const GWindowInit *pInit) {
 	// Add to the window manager
 	if (!_GWINwm->vmt->Add(gh, pInit))
 		return gFalse;
+	#if GWIN_NEED_HITGRID
+		_gwinHitInvalidate();
+	#endif
 
 	#if GWIN_NEED_CONTAINERS
 		// Notify the parent it has been added
@@ -440,6 +989,9 @@ void gwinRedraw(GHandle gh) {
 		return;
 
 	// Mark for redraw
+	#if GWIN_REDRAW_DAMAGE
+		gh->dmgcx = 0;
+	#endif
 	gh->flags |= GWIN_FLG_NEEDREDRAW;
 	RedrawPending |= DOREDRAW_VISIBLES;
 
@@ -447,6 +999,71 @@ void gwinRedraw(GHandle gh) {
 	_gwinFlushRedraws(REDRAW_WAIT);
 }
 
+#if GWIN_NEED_OFFSCREEN
+	gBool gwinSetOffscreen(GHandle gh, gBool offscreen) {
+		Offscreen *	po;
+		Offscreen **ppo;
+
+		if (!(gh->flags & GWIN_FLG_CONTAINER))
+			return gFalse;
+
+		gfxSemWait(&gwinsem, gDelayForever);
+		if (offscreen) {
+			if (!(gh->flags & GWIN_FLG_OFFSCREEN)) {
+				if (!(po = gfxAlloc(sizeof(Offscreen)))) {
+					gfxSemSignal(&gwinsem);
+					return gFalse;
+				}
+				if (!(po->pixmap = gdispPixmapCreate(gh->width, gh->height))) {
+					gfxFree(po);
+					gfxSemSignal(&gwinsem);
+					return gFalse;
+				}
+
+				// The pixmap is filled from the display contents the next time the container is drawn
+				po->gh = gh;
+				po->display = gh->display;
+				po->x = po->y = 0;
+				po->width = gh->width;
+				po->height = gh->height;
+				po->valid = gFalse;
+				po->next = OffscreenList;
+				OffscreenList = po;
+				gh->flags |= GWIN_FLG_OFFSCREEN;
+			}
+		} else if ((gh->flags & GWIN_FLG_OFFSCREEN)) {
+			gh->flags &= ~GWIN_FLG_OFFSCREEN;
+			for(ppo = &OffscreenList; (*ppo)->gh != gh; ppo = &(*ppo)->next);
+			po = *ppo;
+			*ppo = po->next;
+			if (po->pixmap)
+				gdispPixmapDelete(po->pixmap);
+			gfxFree(po);
+		}
+		gfxSemSignal(&gwinsem);
+		return gTrue;
+	}
+#endif
+
+#if GWIN_REDRAW_FRAMES
+	void gwinSetRedrawDeferrable(GHandle gh, gBool deferrable) {
+		if (deferrable)
+			gh->flags |= GWIN_FLG_DEFERRABLE;
+		else
+			gh->flags &= ~GWIN_FLG_DEFERRABLE;
+	}
+
+	void gwinGetRedrawStats(GWindowRedrawStats *pstats, gBool reset) {
+		gfxSemWait(&gwinsem, gDelayForever);
+		*pstats = FrameStats;
+		if (reset) {
+			FrameStats.frames = FrameStats.windows = FrameStats.deferred = FrameStats.overruns = 0;
+			FrameStats.lastTime = FrameStats.maxTime = 0;
+		}
+		gfxSemSignal(&gwinsem);
+	}
+#endif
+
 #if GWIN_NEED_CONTAINERS
 	void gwinSetVisible(GHandle gh, gBool visible) {
 		if (visible) {
@@ -555,18 +1172,30 @@ void gwinRedraw(GHandle gh) {
 
 void gwinMove(GHandle gh, gCoord x, gCoord y) {
 	_GWINwm->vmt->Move(gh, x, y);
+	#if GWIN_NEED_HITGRID
+		_gwinHitInvalidate();
+	#endif
 }
 
 void gwinResize(GHandle gh, gCoord width, gCoord height) {
 	_GWINwm->vmt->Size(gh, width, height);
+	#if GWIN_NEED_HITGRID
+		_gwinHitInvalidate();
+	#endif
 }
 
 void gwinSetMinMax(GHandle gh, GWindowMinMax minmax) {
 	_GWINwm->vmt->MinMax(gh, minmax);
+	#if GWIN_NEED_HITGRID
+		_gwinHitInvalidate();
+	#endif
 }
 
 void gwinRaise(GHandle gh) {
 	_GWINwm->vmt->Raise(gh);
+	#if GWIN_NEED_HITGRID
+		_gwinHitInvalidate();
+	#endif
 }
 
 GWindowMinMax gwinGetMinMax(GHandle gh) {
@@ -586,7 +1215,7 @@ void gwinRedrawDisplay(GDisplay *g, gBool preserve) {
 		if (g && gh->display != g)
 			continue;
 
-		#if GWIN_NEED_CONTAINERS
+		#if GWIN_NEED_CONTAINERS && !GWIN_REDRAW_OCCLUSION
 			// Skip if it is not a top level window (parents internally take care of their children)
 			if (gh->parent)
 				continue;
@@ -745,40 +1374,188 @@ static void WM_Delete(GHandle gh) {
 	gfxSemWait(&gwinsem, gDelayForever);
 	gfxQueueASyncRemove(&_GWINList, &gh->wmq);
 	gfxSemSignal(&gwinsem);
+
+	// Free any off-screen pixmap
+	#if GWIN_NEED_OFFSCREEN
+		if ((gh->flags & GWIN_FLG_OFFSCREEN))
+			gwinSetOffscreen(gh, gFalse);
+	#endif
+}
+
+// Draw a window where the caller has set the clipping
+static void wmDrawWindow(GHandle gh, gU32 flags) {
+	if (gh->vmt->Redraw)
+		gh->vmt->Redraw(gh);
+	else if ((flags & GWIN_FLG_BGREDRAW)) {
+		// We can't redraw but we want full coverage so just clear the area
+		gdispGFillArea(gwinGetDrawDisplay(gh), gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+
+		// Only do an after clear if this is not a parent reveal
+		if (!(flags & GWIN_FLG_PARENTREVEAL) && gh->vmt->AfterClear)
+			gh->vmt->AfterClear(gh);
+	}
 }
 
+#if GWIN_NEED_OFFSCREEN
+	// Draw the part of a window within an area into its pixmap
+	static void wmOffscreenDraw(Offscreen *po, GHandle gh, gU32 flags, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		gCoord	x0, y0, x1, y1;
+
+		x0 = x > gh->x ? x : gh->x;
+		y0 = y > gh->y ? y : gh->y;
+		x1 = x+cx < gh->x+gh->width ? x+cx : gh->x+gh->width;
+		y1 = y+cy < gh->y+gh->height ? y+cy : gh->y+gh->height;
+		if (x0 >= x1 || y0 >= y1)
+			return;
+
+		// Drawing all of it means any pending redraw has been done
+		if (x0 == gh->x && y0 == gh->y && x1 == gh->x+gh->width && y1 == gh->y+gh->height)
+			gh->flags &= ~(GWIN_FLG_NEEDREDRAW|GWIN_FLG_BGREDRAW);
+
+		gdispGSetClip(po->pixmap, x0, y0, x1-x0, y1-y0);
+		gh->drawdisplay = po->pixmap;
+		wmDrawWindow(gh, flags);
+		gh->drawdisplay = gh->display;
+	}
+
+	// Redraw the windows in the pixmap that are above gh within an area
+	static void wmOffscreenAbove(Offscreen *po, GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		GHandle		gx, gp;
+
+		for(gx = gwinGetNextWindow(gh); gx; gx = gwinGetNextWindow(gx)) {
+			if (!(gx->flags & GWIN_FLG_SYSVISIBLE))
+				continue;
+			for(gp = gx->parent; gp && gp != po->gh; gp = gp->parent);
+			if (gp)
+				wmOffscreenDraw(po, gx, gx->flags|GWIN_FLG_BGREDRAW|GWIN_FLG_PARENTREVEAL, x, y, cx, cy);
+		}
+	}
+
+	// Make sure the pixmap holds a complete image of the container
+	static void wmOffscreenValidate(Offscreen *po) {
+		if (po->valid)
+			return;
+		wmOffscreenDraw(po, po->gh, po->gh->flags|GWIN_FLG_BGREDRAW|GWIN_FLG_PARENTREVEAL, po->x, po->y, po->width, po->height);
+		wmOffscreenAbove(po, po->gh, po->x, po->y, po->width, po->height);
+		po->valid = gTrue;
+	}
+
+	/**
+	 * Uncover part of a window on the display.
+	 * An off-screen container is copied from its pixmap which covers all the windows inside it as well.
+	 * Returns gFalse if the window is not drawn off-screen and needs to be redrawn.
+	 */
+	static gBool wmOffscreenExpose(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		Offscreen *	po;
+
+		if (!(po = wmOffscreen(gh)))
+			return gFalse;
+		if (po->gh == gh) {
+			#if GWIN_REDRAW_OCCLUSION
+				wmClipVisible(po->display, gh, gTrue, x, y, cx, cy);
+			#endif
+			wmOffscreenValidate(po);
+			wmOffscreenBlit(po, x, y, cx, cy);
+		}
+		return gTrue;
+	}
+#endif
+
 static void WM_Redraw(GHandle gh) {
 	gU32	flags;
     gU32    parents = 0;    // Used to indicate whether the window (gh) has parent(s).
+	gCoord	x, y, cx, cy;
+	#if GWIN_REDRAW_OCCLUSION
+		gBool	clipped;
+	#endif
+	#if GWIN_NEED_OFFSCREEN
+		Offscreen *	po;
+	#endif
 	
 	flags = gh->flags;
 	gh->flags &= ~(GWIN_FLG_NEEDREDRAW|GWIN_FLG_BGREDRAW|GWIN_FLG_PARENTREVEAL);
+
+	// The area to redraw
+	x = gh->x; y = gh->y;
+	cx = gh->width; cy = gh->height;
+	#if GWIN_REDRAW_DAMAGE
+		// Just the damaged part if that is all that has changed
+		if ((flags & (GWIN_FLG_NEEDREDRAW|GWIN_FLG_BGREDRAW)) == GWIN_FLG_NEEDREDRAW && gh->dmgcx) {
+			x += gh->dmgx; y += gh->dmgy;
+			cx = gh->dmgcx; cy = gh->dmgcy;
+		}
+	#endif
 	
 	#if GWIN_NEED_CONTAINERS
 		redo_redraw:
 	#endif
 	if ((flags & GWIN_FLG_SYSVISIBLE)) {
-		if (gh->vmt->Redraw)
-			gh->vmt->Redraw(gh);
-		else if ((flags & GWIN_FLG_BGREDRAW)) {
-			// We can't redraw but we want full coverage so just clear the area
-			gdispGFillArea(gh->display, gh->x, gh->y, gh->width, gh->height, gh->bgcolor);
+		#if GWIN_NEED_OFFSCREEN
+			po = wmOffscreen(gh);
+		#endif
+		#if GWIN_REDRAW_OCCLUSION
+			// Only draw the part of the window that can be seen
+			#if GWIN_NEED_OFFSCREEN
+				// Windows nested within an off-screen window are copied with it
+				clipped = wmClipVisible(gh->display, gh, po ? gTrue : gFalse, x, y, cx, cy);
+			#else
+				clipped = wmClipVisible(gh->display, gh, gFalse, x, y, cx, cy);
+			#endif
+		#endif
 
-			// Only do an after clear if this is not a parent reveal
-			if (!(flags & GWIN_FLG_PARENTREVEAL) && gh->vmt->AfterClear)
-				gh->vmt->AfterClear(gh);
-		}
+		#if GWIN_NEED_OFFSCREEN
+			// Draw the window and everything above it in the pixmap and then copy it to the display in one go
+			if (po) {
+				if (po->valid) {
+					wmOffscreenDraw(po, gh, flags, x, y, cx, cy);
+					wmOffscreenAbove(po, gh, x, y, cx, cy);
+				} else {
+					wmOffscreenValidate(po);
+					x = gh->x; y = gh->y;
+					cx = gh->width; cy = gh->height;
+				}
+				wmOffscreenBlit(po, x, y, cx, cy);
+				#if GWIN_REDRAW_OCCLUSION
+					if (clipped)
+						gdispGSetClipRegion(gh->display, 0);
+				#endif
+				return;
+			}
+		#endif
+
+		#if GWIN_REDRAW_DAMAGE
+			// A clip region already covers just the area to redraw
+			#if GWIN_REDRAW_OCCLUSION
+				if (!clipped)
+			#endif
+					gdispGSetClip(gh->display, x, y, cx, cy);
+		#endif
+		wmDrawWindow(gh, flags);
+
+		#if GWIN_REDRAW_OCCLUSION
+			if (clipped)
+				gdispGSetClipRegion(gh->display, 0);
+		#endif
 
 		#if GWIN_NEED_CONTAINERS
 			// If this is container but not a parent reveal, mark any visible children for redraw
-			//	We redraw our children here as we have overwritten them in redrawing the parent
-			//	as GDISP/GWIN doesn't support complex clipping regions.
+			//	We redraw our children here as we have overwritten them in redrawing the parent.
+			//	With a clip region only child containers have been overwritten.
 			if ((flags & (GWIN_FLG_CONTAINER|GWIN_FLG_PARENTREVEAL)) == GWIN_FLG_CONTAINER) {
 
 				// Container redraw is done
 
-				for(gh = gwinGetFirstChild(gh); gh; gh = gwinGetSibling(gh))
-					_gwinUpdate(gh);
+				for(gh = gwinGetFirstChild(gh); gh; gh = gwinGetSibling(gh)) {
+					#if GWIN_REDRAW_OCCLUSION
+						if (clipped && !(gh->flags & GWIN_FLG_CONTAINER))
+							continue;
+					#endif
+
+					// Only children in the redrawn area have been drawn over
+					if (gh->x >= x+cx || gh->y >= y+cy || gh->x+gh->width <= x || gh->y+gh->height <= y)
+						continue;
+					_gwinUpdateArea(gh, x - gh->x, y - gh->y, cx, cy);
+				}
 				return;
 			}
 		#endif
@@ -787,6 +1564,63 @@ static void WM_Redraw(GHandle gh) {
 		if ((flags & GWIN_FLG_BGREDRAW)) {
 			GHandle		gx;
 
+			#if GWIN_NEED_OFFSCREEN
+				// A window inside a visible off-screen container has gone - redraw what is under it in the pixmap
+				if ((po = wmOffscreen(gh))) {
+					if (po->valid) {
+						wmOffscreenDraw(po, po->gh, po->gh->flags|GWIN_FLG_BGREDRAW|GWIN_FLG_PARENTREVEAL, gh->x, gh->y, gh->width, gh->height);
+						wmOffscreenAbove(po, po->gh, gh->x, gh->y, gh->width, gh->height);
+					} else
+						wmOffscreenValidate(po);
+
+					// Copy it without drawing over the windows above the container
+					#if GWIN_REDRAW_OCCLUSION
+						if (wmClipVisible(po->display, po->gh, gTrue, gh->x, gh->y, gh->width, gh->height)) {
+							wmOffscreenBlit(po, gh->x, gh->y, gh->width, gh->height);
+							gdispGSetClipRegion(po->display, 0);
+							return;
+						}
+					#endif
+					wmOffscreenBlit(po, gh->x, gh->y, gh->width, gh->height);
+					for(gx = gwinGetNextWindow(po->gh); gx; gx = gwinGetNextWindow(gx)) {
+						if ((gx->flags & GWIN_FLG_SYSVISIBLE)
+								&& gx->display == po->display
+								&& gx->x < gh->x+gh->width && gx->y < gh->y+gh->height && gx->x+gx->width > gh->x && gx->y+gx->height > gh->y
+								&& !wmOffscreenExpose(gx, gh->x, gh->y, gh->width, gh->height))
+							wmDrawWindow(gx, gx->flags|GWIN_FLG_BGREDRAW|GWIN_FLG_PARENTREVEAL);
+					}
+					return;
+				}
+			#endif
+
+			#if GWIN_REDRAW_OCCLUSION
+				// Fill the part of the exposed area that no window covers with the background color
+				if (wmClipVisible(gh->display, 0, gFalse, gh->x, gh->y, gh->width, gh->height)) {
+					gdispGFillArea(gh->display, gh->x, gh->y, gh->width, gh->height, gwinGetDefaultBgColor());
+
+					// Now get each window under the exposed area to redraw just its visible part of it.
+					//	Windows already marked for redraw will do so shortly anyway.
+					for(gx = gwinGetNextWindow(0); gx; gx = gwinGetNextWindow(gx)) {
+						if ((gx->flags & (GWIN_FLG_SYSVISIBLE|GWIN_FLG_NEEDREDRAW)) != GWIN_FLG_SYSVISIBLE
+								|| gx->display != gh->display
+								|| gx->x >= gh->x+gh->width || gx->y >= gh->y+gh->height || gx->x+gx->width <= gh->x || gx->y+gx->height <= gh->y)
+							continue;
+						#if GWIN_NEED_OFFSCREEN
+							if (wmOffscreenExpose(gx, gh->x, gh->y, gh->width, gh->height))
+								continue;
+						#endif
+						wmClipVisible(gx->display, gx, gFalse, gh->x, gh->y, gh->width, gh->height);
+						if (gx->vmt->Redraw)
+							gx->vmt->Redraw(gx);
+						else
+							// We can't redraw this window but we want full coverage so just clear the area
+							gdispGFillArea(gx->display, gx->x, gx->y, gx->width, gx->height, gx->bgcolor);
+					}
+					gdispGSetClipRegion(gh->display, 0);
+					return;
+				}
+			#endif
+
 			#if GWIN_NEED_CONTAINERS
 				if (gh->parent) {
 					// Child redraw is done
@@ -819,6 +1653,10 @@ static void WM_Redraw(GHandle gh) {
 				if ((gx->flags & GWIN_FLG_SYSVISIBLE)
 						&& gx->display == gh->display
 						&& gx->x < gh->x+gh->width && gx->y < gh->y+gh->height && gx->x+gx->width >= gh->x && gx->y+gx->height >= gh->y) {
+					#if GWIN_NEED_OFFSCREEN
+						if (wmOffscreenExpose(gx, gh->x, gh->y, gh->width, gh->height))
+							continue;
+					#endif
 					if (gx->vmt->Redraw)
 						gx->vmt->Redraw(gx);
 					else
@@ -904,6 +1742,131 @@ static void WM_Size(GHandle gh, gCoord w, gCoord h) {
 	}
 }
 
+#if GWIN_MOVE_BLIT
+	/**
+	 * Redraw the windows from gx onwards within an area. The window gh and the windows inside it are skipped.
+	 * The caller must have set the clipping to the area.
+	 */
+	static void wmMoveRedraw(GHandle gh, GHandle gx, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		GHandle		gp;
+
+		for(; gx; gx = gwinGetNextWindow(gx)) {
+			if (!(gx->flags & GWIN_FLG_SYSVISIBLE)
+					|| gx->display != gh->display
+					|| gx->x >= x+cx || gx->y >= y+cy || gx->x+gx->width <= x || gx->y+gx->height <= y)
+				continue;
+			for(gp = gx; gp && gp != gh; gp = gp->parent);
+			if (gp)
+				continue;
+			#if GWIN_NEED_OFFSCREEN
+				if (wmOffscreenExpose(gx, x, y, cx, cy)) {
+					#if GWIN_REDRAW_OCCLUSION
+						gdispGSetClipRegion(gx->display, 0);
+					#endif
+					continue;
+				}
+			#endif
+			wmDrawWindow(gx, gx->flags|GWIN_FLG_BGREDRAW|GWIN_FLG_PARENTREVEAL);
+		}
+	}
+
+	// Repaint a strip of the display uncovered by moving gh
+	static void wmMoveExpose(GHandle gh, gCoord x, gCoord y, gCoord cx, gCoord cy) {
+		if (cx <= 0 || cy <= 0)
+			return;
+		gdispGSetClip(gh->display, x, y, cx, cy);
+		gdispGFillArea(gh->display, x, y, cx, cy, gwinGetDefaultBgColor());
+		wmMoveRedraw(gh, gwinGetNextWindow(0), x, y, cx, cy);
+	}
+
+	/**
+	 * Move a visible window by copying its pixels to the new position.
+	 * Returns gFalse if the window is covered by another window or its pixels can't be copied.
+	 * Nothing has been changed in that case.
+	 */
+	static gBool wmMoveBlit(GHandle gh, gCoord x, gCoord y) {
+		GHandle		gx, gp;
+		gCoord		u, v, w, h, t, sy, sh;
+		#if GWIN_NEED_OFFSCREEN
+			Offscreen *	po;
+		#endif
+
+		// What is on the display must be up to date before we copy it
+		_gwinFlushRedraws(REDRAW_WAIT);
+		gfxSemWait(&gwinsem, gDelayForever);
+
+		u = gh->x; v = gh->y;
+		w = gh->width; h = gh->height;
+
+		// Any window above this one covering it would be copied along with it
+		for(gx = gwinGetNextWindow(gh); gx; gx = gwinGetNextWindow(gx)) {
+			if (!(gx->flags & GWIN_FLG_SYSVISIBLE)
+					|| gx->display != gh->display
+					|| gx->x >= u+w || gx->y >= v+h || gx->x+gx->width <= u || gx->y+gx->height <= v)
+				continue;
+			for(gp = gx->parent; gp && gp != gh; gp = gp->parent);
+			if (!gp)
+				goto fail;
+		}
+
+		gdispGSetClip(gh->display, 0, 0, gdispGGetWidth(gh->display), gdispGGetHeight(gh->display));
+		#if GWIN_NEED_OFFSCREEN
+			// An off-screen container is copied from its pixmap which simply moves with it.
+			//	A window inside one has to be redrawn into the pixmap anyway.
+			if ((po = wmOffscreen(gh))) {
+				if (po->gh != gh)
+					goto fail;
+				wmOffscreenValidate(po);
+				po->x = x;
+				po->y = y;
+				gdispPixmapSetOrigin(po->pixmap, x, y);
+				wmOffscreenBlit(po, x, y, w, h);
+			} else
+		#endif
+		if (!gdispGCopyArea(gh->display, x, y, w, h, u, v))
+			goto fail;
+
+		// Move the window and everything inside it
+		for(gx = gh; gx; gx = gwinGetNextWindow(gx)) {
+			for(gp = gx; gp && gp != gh; gp = gp->parent);
+			if (gp) {
+				gx->x += x - u;
+				gx->y += y - v;
+			}
+		}
+
+		// Redraw any windows above that the copy has drawn over
+		gdispGSetClip(gh->display, x, y, w, h);
+		wmMoveRedraw(gh, gwinGetNextWindow(gh), x, y, w, h);
+
+		// Repaint the uncovered strips - above or below the new position and then beside it
+		if (y > v)
+			wmMoveExpose(gh, u, v, w, y-v < h ? y-v : h);
+		else if (y < v) {
+			t = y+h > v ? y+h : v;
+			wmMoveExpose(gh, u, t, w, v+h-t);
+		}
+		sy = y > v ? y : v;
+		sh = (y < v ? y : v) + h - sy;
+		if (sh > 0) {
+			if (x > u)
+				wmMoveExpose(gh, u, sy, x-u < w ? x-u : w, sh);
+			else if (x < u) {
+				t = x+w > u ? x+w : u;
+				wmMoveExpose(gh, t, sy, u+w-t, sh);
+			}
+		}
+
+		gdispGUnsetClip(gh->display);
+		gfxSemSignal(&gwinsem);
+		return gTrue;
+
+	fail:
+		gfxSemSignal(&gwinsem);
+		return gFalse;
+	}
+#endif
+
 static void WM_Move(GHandle gh, gCoord x, gCoord y) {
 	gCoord		u, v;
 
@@ -946,6 +1909,12 @@ static void WM_Move(GHandle gh, gCoord x, gCoord y) {
 	if (gh->x == x && gh->y == y)
 		return;
 
+	// Copy the window to its new position if we can
+	#if GWIN_MOVE_BLIT
+		if ((gh->flags & GWIN_FLG_SYSVISIBLE) && wmMoveBlit(gh, x, y))
+			return;
+	#endif
+
 	// Clear the old area and then redraw
 	if ((gh->flags & GWIN_FLG_SYSVISIBLE)) {
 		// We need to make this window invisible and ensure that has been drawn
@@ -205,6 +205,9 @@ void write_source(std::ostream &out, std::string name, const DataFile &datafile)
     // Fonts in this format are always black & white
     int flags = datafile.GetFontInfo().flags | DataFile::FLAG_BW;
 
+    // Write out the table of ASCII character widths for fast measurement
+    write_ascii_widths_table(out, datafile, "mf_bwfont_" + name + "_ascii_widths");
+
     // Pull it all together in the rlefont_s structure.
     out << "const struct mf_bwfont_s mf_bwfont_" << name << " = {" << std::endl;
     out << "    {" << std::endl;
@@ -221,6 +224,7 @@ void write_source(std::ostream &out, std::string name, const DataFile &datafile)
     out << "    " << select_fallback_char(datafile) << ", /* fallback character */" << std::endl;
     out << "    " << "&mf_bwfont_character_width," << std::endl;
     out << "    " << "&mf_bwfont_render_character," << std::endl;
+    out << "    " << "mf_bwfont_" << name << "_ascii_widths," << std::endl;
     out << "    }," << std::endl;
 
     out << "    " << BWFONT_FORMAT_VERSION << ", /* version */" << std::endl;
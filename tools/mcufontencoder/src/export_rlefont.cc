@@ -132,6 +132,9 @@ void write_source(std::ostream &out, std::string name, const DataFile &datafile)
     out << "};" << std::endl;
     out << std::endl;
 
+    // Write out the table of ASCII character widths for fast measurement
+    write_ascii_widths_table(out, datafile, "mf_rlefont_" + name + "_ascii_widths");
+
     // Pull it all together in the rlefont_s structure.
     out << "const struct mf_rlefont_s mf_rlefont_" << name << " = {" << std::endl;
     out << "    {" << std::endl;
@@ -148,6 +151,7 @@ void write_source(std::ostream &out, std::string name, const DataFile &datafile)
     out << "    " << select_fallback_char(datafile) << ", /* fallback character */" << std::endl;
     out << "    " << "&mf_rlefont_character_width," << std::endl;
     out << "    " << "&mf_rlefont_render_character," << std::endl;
+    out << "    " << "mf_rlefont_" << name << "_ascii_widths," << std::endl;
     out << "    }," << std::endl;
 
     out << "    " << RLEFONT_FORMAT_VERSION << ", /* version */" << std::endl;
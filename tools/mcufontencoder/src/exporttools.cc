@@ -116,6 +116,32 @@ int select_fallback_char(const DataFile &datafile)
     return ' ';
 }
 
+// Write the table of tracking widths for the printable ASCII characters.
+// Missing characters get the width of the fallback character.
+void write_ascii_widths_table(std::ostream &out, const DataFile &datafile,
+                              const std::string &tablename)
+{
+    std::map<size_t, size_t> char_to_glyph = datafile.GetCharToGlyphMap();
+    std::vector<unsigned> widths;
+    int fallback = select_fallback_char(datafile);
+    unsigned fallback_width = 0;
+
+    if (char_to_glyph.count(fallback))
+        fallback_width = datafile.GetGlyphEntry(char_to_glyph[fallback]).width;
+
+    for (size_t c = 0x20; c < 0x7F; c++)
+    {
+        unsigned width = 0;
+
+        if (char_to_glyph.count(c))
+            width = datafile.GetGlyphEntry(char_to_glyph[c]).width;
+
+        widths.push_back(width ? width : fallback_width);
+    }
+
+    write_const_table(out, widths, "gU8", tablename, 1);
+}
+
 // Decide how to best divide the characters in the font into ranges.
 // Limitations are:
 //  - Gaps longer than minimum_gap should result in separate ranges.
@@ -30,6 +30,11 @@ int get_max_x_advance(const DataFile &datafile);
 // Select the character to use as a fallback.
 int select_fallback_char(const DataFile &datafile);
 
+// Write the table of tracking widths for the printable ASCII characters.
+// Missing characters get the width of the fallback character.
+void write_ascii_widths_table(std::ostream &out, const DataFile &datafile,
+                              const std::string &tablename);
+
 // Structure to represent one consecutive range of characters.
 struct char_range_t
 {